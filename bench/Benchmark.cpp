@@ -0,0 +1,126 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** Benchmark
+*/
+
+#include "Benchmark.hpp"
+#include <sys/resource.h>
+#include <fstream>
+#include <iomanip>
+#include <regex>
+#include <sstream>
+#include "GlobalException.hpp"
+
+namespace Raytracer {
+
+void BenchmarkReport::add(BenchmarkResult result)
+{
+    m_results.push_back(std::move(result));
+}
+
+const std::vector<BenchmarkResult>& BenchmarkReport::getResults() const
+{
+    return m_results;
+}
+
+void BenchmarkReport::writeJson(std::ostream& out, const BenchmarkOptions& options) const
+{
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << std::setprecision(9);
+
+    out << "{\n  \"resolution\": [" << options.width << ", " << options.height << "],\n"
+        << "  \"threads\": " << options.threads << ",\n"
+        << "  \"mode\": \"" << (options.mode == Renderer::WAVEFRONT ? "wavefront" : "recursive") << "\",\n"
+        << "  \"repetitions\": " << options.repetitions << ",\n"
+        << "  \"peak_rss_kb\": " << getPeakRss() << ",\n"
+        << "  \"benchmarks\": [\n";
+    // Le nom et time_ns en tête de ligne : readBaseline() ne lit que ces deux champs
+    for (size_t i = 0; i < m_results.size(); ++i) {
+        const BenchmarkResult& result = m_results[i];
+        out << "    {\"name\": \"" << result.name << "\", \"time_ns\": " << result.timeNs;
+        for (const auto& [key, value] : result.metrics)
+            out << ", \"" << key << "\": " << value;
+        if (!result.phasesMs.empty()) {
+            out << ", \"phases_ms\": {";
+            bool first = true;
+            for (const auto& [phase, ms] : result.phasesMs) {
+                out << (first ? "" : ", ") << '"' << phase << "\": " << ms;
+                first = false;
+            }
+            out << '}';
+        }
+        out << '}' << (i + 1 < m_results.size() ? "," : "") << '\n';
+    }
+    out << "  ]\n}" << std::endl;
+    out.flags(flags);
+    out.precision(precision);
+}
+
+std::map<std::string, double> BenchmarkReport::readBaseline(const std::string& filename)
+{
+    std::ifstream file(filename);
+    if (!file)
+        throw GlobalException("BenchmarkReport: Cannot open baseline " + filename);
+    std::stringstream content;
+    content << file.rdbuf();
+
+    static const std::regex entry(R"re(\{"name": "([^"]+)", "time_ns": ([-+0-9.eE]+))re");
+    std::map<std::string, double> times;
+    std::string text = content.str();
+    for (auto it = std::sregex_iterator(text.begin(), text.end(), entry); it != std::sregex_iterator(); ++it)
+        times[(*it)[1].str()] = std::stod((*it)[2].str());
+    if (times.empty())
+        throw GlobalException("BenchmarkReport: No benchmark in baseline " + filename);
+    return times;
+}
+
+int BenchmarkReport::compare(const std::map<std::string, double>& baseline, double defaultTolerance,
+    const std::map<std::string, double>& tolerances, std::ostream& out) const
+{
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(1);
+
+    int regressions = 0;
+    for (const BenchmarkResult& result : m_results) {
+        auto found = baseline.find(result.name);
+        out << "  " << std::left << std::setw(40) << result.name << std::right;
+        if (found == baseline.end() || found->second <= 0.0) {
+            out << "  (not in baseline)" << std::endl;
+            continue;
+        }
+        double tolerance = defaultTolerance;
+        size_t matched = 0;
+        for (const auto& [prefix, value] : tolerances) {
+            if (result.name.compare(0, prefix.size(), prefix) == 0 && prefix.size() >= matched) {
+                tolerance = value;
+                matched = prefix.size();
+            }
+        }
+        double change = result.timeNs / found->second - 1.0;
+        bool regressed = change > tolerance;
+        regressions += regressed;
+        out << std::setw(9) << std::showpos << change * 100.0 << std::noshowpos << "%  (tolerance "
+            << tolerance * 100.0 << "%)" << (regressed ? "  REGRESSION" : "") << std::endl;
+    }
+    out.flags(flags);
+    out.precision(precision);
+    return regressions;
+}
+
+long BenchmarkReport::getPeakRss()
+{
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+}
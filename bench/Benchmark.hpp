@@ -0,0 +1,171 @@
+/**
+ * @file Benchmark.hpp
+ * @brief Timing harness, JSON report and baseline comparison of raytracer_bench
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains what the micro-benchmarks (one primitive, solver or
+ * vector operation in a loop) and the scene benchmarks (full renders of the
+ * files of scenes/) share: the options, the timing loop, and the report that
+ * is written to JSON and checked against a previous report.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Renderer/Renderer.hpp"
+
+namespace Raytracer {
+    /**
+     * @struct BenchmarkOptions
+     * @brief Settings of a benchmark run
+     */
+    struct BenchmarkOptions {
+        std::string filter;              ///< Only benchmarks whose name contains this text
+        std::string sceneDirectory = "scenes"; ///< Scene files rendered by the scene benchmarks
+        int width = 320;                 ///< Resolution of the scene benchmarks
+        int height = 240;                ///< Resolution of the scene benchmarks
+        unsigned int threads = 1;        ///< Rendering threads, 1 for steady timings
+        Renderer::Mode mode = Renderer::RECURSIVE; ///< Integrator of the scene benchmarks
+        int repetitions = 5;             ///< Timed samples per benchmark, the median is kept
+        double minSampleSeconds = 0.02;  ///< Minimal duration of one micro-benchmark sample
+        bool micro = true;               ///< Run the micro-benchmarks
+        bool scenes = true;              ///< Run the scene benchmarks
+    };
+
+    /**
+     * @struct BenchmarkResult
+     * @brief Measures of one benchmark
+     *
+     * time_ns is the compared value: time of one operation for the
+     * micro-benchmarks, of one frame for the scene benchmarks.
+     */
+    struct BenchmarkResult {
+        std::string name;                            ///< "micro/..." or "scene/..."
+        double timeNs = 0.0;                         ///< Median time of one operation
+        std::vector<std::pair<std::string, double>> metrics; ///< Other values, in output order
+        std::map<std::string, double> phasesMs;      ///< Time per phase, scene benchmarks only
+    };
+
+    /**
+     * @class BenchmarkReport
+     * @brief Results of a run, written to JSON and compared with a baseline
+     */
+    class BenchmarkReport {
+    public:
+      /**
+       * @brief Adds the result of a benchmark
+       *
+       * @param result The result
+       */
+      void add(BenchmarkResult result);
+
+      /**
+       * @brief Gets the results, in the order they were added
+       *
+       * @return const std::vector<BenchmarkResult>& The results
+       */
+      const std::vector<BenchmarkResult>& getResults() const;
+
+      /**
+       * @brief Writes the report as JSON, one benchmark per line
+       *
+       * @param out Destination stream
+       * @param options Settings of the run, recorded with the results
+       */
+      void writeJson(std::ostream& out, const BenchmarkOptions& options) const;
+
+      /**
+       * @brief Reads the time_ns of every benchmark of a report written by writeJson()
+       *
+       * @param filename Path of the report
+       * @return std::map<std::string, double> Time by benchmark name
+       * @throws GlobalException If the file cannot be read or holds no benchmark
+       */
+      static std::map<std::string, double> readBaseline(const std::string& filename);
+
+      /**
+       * @brief Compares the results with a baseline and prints the differences
+       *
+       * A benchmark regresses when its time exceeds the baseline by more than
+       * its tolerance: the one of the longest prefix of its name found in
+       * tolerances, or defaultTolerance.
+       *
+       * @param baseline Times of the baseline, from readBaseline()
+       * @param defaultTolerance Allowed slowdown, 0.1 for 10%
+       * @param tolerances Allowed slowdown by name prefix
+       * @param out Destination of the comparison table
+       * @return int Number of regressions
+       */
+      int compare(const std::map<std::string, double>& baseline, double defaultTolerance,
+          const std::map<std::string, double>& tolerances, std::ostream& out) const;
+
+      /**
+       * @brief Gets the peak resident set size of the process
+       *
+       * @return long Kilobytes, 0 if unknown
+       */
+      static long getPeakRss();
+
+    private:
+      std::vector<BenchmarkResult> m_results; ///< Results, in run order
+  };
+
+    /**
+     * @brief Times a batch of operations
+     *
+     * The batch runs once untimed, then in timed samples each repeating it until
+     * minSampleSeconds have passed. Its return values are kept in a volatile so
+     * that the measured work cannot be optimized out.
+     *
+     * @param batch Callable running opsPerBatch operations and returning a value
+     * @param opsPerBatch Operations done by one call of batch
+     * @param options Number of samples and their minimal duration
+     * @return double Median time of one operation, in nanoseconds
+     */
+    template <typename Batch>
+    double measureNs(Batch&& batch, size_t opsPerBatch, const BenchmarkOptions& options)
+    {
+        using Clock = std::chrono::steady_clock;
+        static volatile double sink;
+        sink = static_cast<double>(batch());
+
+        std::vector<double> samples;
+        for (int i = 0; i < std::max(options.repetitions, 1); ++i) {
+            size_t batches = 0;
+            double seconds = 0.0;
+            Clock::time_point start = Clock::now();
+            do {
+                sink = sink + static_cast<double>(batch());
+                ++batches;
+                seconds = std::chrono::duration<double>(Clock::now() - start).count();
+            } while (seconds < options.minSampleSeconds);
+            samples.push_back(seconds * 1e9 / static_cast<double>(batches * opsPerBatch));
+        }
+        std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+        return samples[samples.size() / 2];
+    }
+
+    /**
+     * @brief Runs the micro-benchmarks selected by the options
+     *
+     * @param options Settings of the run
+     * @param report Receives one result per benchmark
+     */
+    void runMicroBenchmarks(const BenchmarkOptions& options, BenchmarkReport& report);
+
+    /**
+     * @brief Renders every scene file of the options' directory
+     *
+     * @param options Settings of the run
+     * @param report Receives one result per scene
+     */
+    void runSceneBenchmarks(const BenchmarkOptions& options, BenchmarkReport& report);
+}
@@ -0,0 +1,228 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** MicroBenchmarks
+*/
+
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <random>
+#include "Benchmark.hpp"
+#include "Parser/ObjParser.hpp"
+#include "Primitives/Cone.hpp"
+#include "Primitives/Cylinder.hpp"
+#include "Primitives/MeshInstance.hpp"
+#include "Primitives/Plane.hpp"
+#include "Primitives/Sphere.hpp"
+#include "Primitives/TangleCube.hpp"
+#include "Primitives/Torus.hpp"
+#include "Primitives/Triangle.hpp"
+#include "Primitives/TriangleMesh.hpp"
+#include "Utils/PolynomialSolver.hpp"
+
+namespace Raytracer {
+
+// Entrées tirées d'un générateur à graine fixe : mêmes données à chaque exécution
+static constexpr size_t BATCH_SIZE = 1024;
+static constexpr unsigned int SEED = 2025;
+static constexpr const char* OBJ_FILE = "obj/small_tree.obj";
+
+// Rayons partant d'une sphère de rayon 10 vers un point proche de l'origine : environ moitié d'impacts
+static std::vector<Ray> makeRays()
+{
+    std::mt19937 rng(SEED);
+    std::normal_distribution<float> gauss(0.0f, 1.0f);
+    std::uniform_real_distribution<float> target(-2.0f, 2.0f);
+    std::vector<Ray> rays;
+    rays.reserve(BATCH_SIZE);
+    while (rays.size() < BATCH_SIZE) {
+        Vector3 origin(gauss(rng), gauss(rng), gauss(rng));
+        if (origin.length() < 1e-3f)
+            continue;
+        origin = origin.normalized() * 10.0f;
+        Vector3 aim(target(rng), target(rng), target(rng));
+        rays.emplace_back(origin, (aim - origin).normalized());
+    }
+    return rays;
+}
+
+// Sphère UV triangulée, pour mesurer un maillage avec sa BVH
+static std::shared_ptr<TriangleMesh> makeMesh(int rings, int segments)
+{
+    std::vector<Vector3> vertices;
+    std::vector<uint32_t> indices;
+    for (int i = 0; i <= rings; ++i) {
+        float theta = static_cast<float>(M_PI) * i / rings;
+        for (int j = 0; j < segments; ++j) {
+            float phi = 2.0f * static_cast<float>(M_PI) * j / segments;
+            vertices.emplace_back(1.5f * std::sin(theta) * std::cos(phi), 1.5f * std::cos(theta), 1.5f * std::sin(theta) * std::sin(phi));
+        }
+    }
+    for (int i = 0; i < rings; ++i) {
+        for (int j = 0; j < segments; ++j) {
+            uint32_t a = i * segments + j;
+            uint32_t b = i * segments + (j + 1) % segments;
+            uint32_t c = a + segments;
+            uint32_t d = b + segments;
+            indices.insert(indices.end(), {a, c, b, b, c, d});
+        }
+    }
+    return std::make_shared<TriangleMesh>(std::move(vertices), std::move(indices), Material());
+}
+
+static bool selected(const BenchmarkOptions& options, const std::string& name)
+{
+    return options.filter.empty() || name.find(options.filter) != std::string::npos;
+}
+
+static void record(BenchmarkReport& report, const std::string& name, double timeNs)
+{
+    std::cout << "  " << name << ": " << timeNs << " ns/op" << std::endl;
+    report.add({name, timeNs, {{"ops_per_second", 1e9 / timeNs}}, {}});
+}
+
+static void benchPrimitives(const BenchmarkOptions& options, BenchmarkReport& report)
+{
+    const std::vector<Ray> rays = makeRays();
+    const Material material;
+    const std::vector<std::pair<std::string, std::shared_ptr<IPrimitive>>> primitives = {
+        {"sphere", std::make_shared<Sphere>(Vector3(0.0f, 0.0f, 0.0f), 1.5f, material)},
+        {"plane", std::make_shared<Plane>(Vector3(0.0f, 1.0f, 0.0f), 0.5f, material)},
+        {"triangle", std::make_shared<Triangle>(Vector3(-2.0f, -1.0f, 0.0f), Vector3(2.0f, -1.0f, 0.0f), Vector3(0.0f, 2.0f, 0.0f), material)},
+        {"cylinder", std::make_shared<Cylinder>(Vector3(0.0f, -1.5f, 0.0f), 1.0f, 3.0f, Vector3(20.0f, 0.0f, 10.0f), material)},
+        {"cone", std::make_shared<Cone>(Vector3(0.0f, -1.5f, 0.0f), 1.0f, 3.0f, Vector3(20.0f, 0.0f, 10.0f), material)},
+        {"torus", std::make_shared<Torus>(Vector3(0.0f, 0.0f, 0.0f), 1.5f, 0.5f, Vector3(60.0f, 0.0f, 0.0f), material)},
+        {"tanglecube", std::make_shared<TangleCube>(Vector3(0.0f, 0.0f, 0.0f), 0.6f, material)},
+        {"mesh", makeMesh(48, 96)},
+        {"instance", std::make_shared<MeshInstance>(makeMesh(48, 96), Transform::fromPlacement(0.75f, Vector3(20.0f, 30.0f, 0.0f),
+            Vector3(0.0f, 0.2f, 0.0f)), material)},
+    };
+    for (const auto& [shape, primitive] : primitives) {
+        const std::string name = "micro/" + shape + ".intersect";
+        if (!selected(options, name))
+            continue;
+        // Appel virtuel, comme le reste du code qui passe par IPrimitive
+        const IPrimitive& target = *primitive;
+        record(report, name, measureNs([&] {
+            float sum = 0.0f;
+            for (const Ray& ray : rays) {
+                float t;
+                if (target.intersect(ray, t))
+                    sum += t;
+            }
+            return sum;
+        }, rays.size(), options));
+    }
+}
+
+static void benchSolvers(const BenchmarkOptions& options, BenchmarkReport& report)
+{
+    // Coefficients de polynômes unitaires aux racines connues, réelles ou non
+    std::mt19937 rng(SEED);
+    std::uniform_real_distribution<double> root(-5.0, 5.0);
+    std::vector<std::array<double, 5>> coefficients(BATCH_SIZE);
+    for (auto& c : coefficients) {
+        double r1 = root(rng), r2 = root(rng), r3 = root(rng), r4 = root(rng);
+        double offset = rng() % 2 ? 0.0 : 4.0;
+        // (x - r1)(x - r2)(x - r3)(x - r4) + offset
+        double s1 = r1 + r2, p1 = r1 * r2, s2 = r3 + r4, p2 = r3 * r4;
+        c = {1.0, -(s1 + s2), p1 + p2 + s1 * s2, -(s1 * p2 + s2 * p1), p1 * p2 + offset};
+    }
+
+    if (selected(options, "micro/solver.quadratic")) {
+        record(report, "micro/solver.quadratic", measureNs([&] {
+            double sum = 0.0, roots[2];
+            for (const auto& c : coefficients)
+                sum += PolynomialSolver::solveQuadratic(c[0], c[1], c[2], roots);
+            return sum;
+        }, coefficients.size(), options));
+    }
+    if (selected(options, "micro/solver.cubic")) {
+        record(report, "micro/solver.cubic", measureNs([&] {
+            double sum = 0.0, roots[3];
+            for (const auto& c : coefficients)
+                sum += PolynomialSolver::solveCubic(c[0], c[1], c[2], c[3], roots);
+            return sum;
+        }, coefficients.size(), options));
+    }
+    if (selected(options, "micro/solver.quartic")) {
+        record(report, "micro/solver.quartic", measureNs([&] {
+            double sum = 0.0, roots[4];
+            for (const auto& c : coefficients)
+                sum += PolynomialSolver::solveQuartic(c[0], c[1], c[2], c[3], c[4], roots);
+            return sum;
+        }, coefficients.size(), options));
+    }
+}
+
+static void benchVectors(const BenchmarkOptions& options, BenchmarkReport& report)
+{
+    std::mt19937 rng(SEED);
+    std::uniform_real_distribution<float> value(-10.0f, 10.0f);
+    std::vector<Vector3> a(BATCH_SIZE), b(BATCH_SIZE);
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        a[i] = Vector3(value(rng), value(rng), value(rng));
+        b[i] = Vector3(value(rng), value(rng), value(rng));
+    }
+
+    if (selected(options, "micro/vector3.dot")) {
+        record(report, "micro/vector3.dot", measureNs([&] {
+            float sum = 0.0f;
+            for (size_t i = 0; i < BATCH_SIZE; ++i)
+                sum += a[i].dot(b[i]);
+            return sum;
+        }, BATCH_SIZE, options));
+    }
+    if (selected(options, "micro/vector3.cross")) {
+        record(report, "micro/vector3.cross", measureNs([&] {
+            Vector3 sum;
+            for (size_t i = 0; i < BATCH_SIZE; ++i)
+                sum += a[i].cross(b[i]);
+            return sum.x + sum.y + sum.z;
+        }, BATCH_SIZE, options));
+    }
+    if (selected(options, "micro/vector3.normalized")) {
+        record(report, "micro/vector3.normalized", measureNs([&] {
+            Vector3 sum;
+            for (size_t i = 0; i < BATCH_SIZE; ++i)
+                sum += a[i].normalized();
+            return sum.x + sum.y + sum.z;
+        }, BATCH_SIZE, options));
+    }
+    if (selected(options, "micro/vector3.arithmetic")) {
+        record(report, "micro/vector3.arithmetic", measureNs([&] {
+            Vector3 sum;
+            for (size_t i = 0; i < BATCH_SIZE; ++i)
+                sum += (a[i] + b[i]) * 0.5f - a[i] / 3.0f;
+            return sum.x + sum.y + sum.z;
+        }, BATCH_SIZE, options));
+    }
+}
+
+static void benchObjParser(const BenchmarkOptions& options, BenchmarkReport& report)
+{
+    const std::string name = "micro/objparser.loadFromFile";
+    if (!selected(options, name))
+        return;
+    if (!std::filesystem::exists(OBJ_FILE)) {
+        std::cerr << "raytracer_bench: " << OBJ_FILE << " not found, " << name << " skipped" << std::endl;
+        return;
+    }
+    record(report, name, measureNs([] {
+        return ObjParser::loadFromFile(OBJ_FILE).size();
+    }, 1, options));
+}
+
+void runMicroBenchmarks(const BenchmarkOptions& options, BenchmarkReport& report)
+{
+    benchPrimitives(options, report);
+    benchSolvers(options, report);
+    benchVectors(options, report);
+    benchObjParser(options, report);
+}
+
+}
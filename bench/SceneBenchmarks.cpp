@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** SceneBenchmarks
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include "Benchmark.hpp"
+#include "Core/Scene.hpp"
+#include "GlobalException.hpp"
+#include "Parser/SceneParser.hpp"
+#include "Utils/RenderStats.hpp"
+
+namespace Raytracer {
+
+// Fichiers .cfg du dossier, dans l'ordre alphabétique pour un rapport stable
+static std::vector<std::filesystem::path> listScenes(const std::string& directory)
+{
+    std::vector<std::filesystem::path> scenes;
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".cfg")
+            scenes.push_back(entry.path());
+    }
+    std::sort(scenes.begin(), scenes.end());
+    return scenes;
+}
+
+static bool benchScene(const std::filesystem::path& path, const BenchmarkOptions& options, BenchmarkResult& result)
+{
+    using Clock = std::chrono::steady_clock;
+    RenderStats::reset();
+    Scene scene;
+    {
+        RenderStats::ScopedPhase phase(RenderStats::PARSE);
+        SceneParser parser(path.string(), scene);
+        if (!parser.parse())
+            return false;
+    }
+    // Résolution imposée : les temps ne dépendent que de la scène
+    Camera camera = scene.getCamera();
+    camera.setResolution(options.width, options.height);
+    scene.setCamera(camera);
+
+    const int repetitions = std::max(options.repetitions, 1);
+    std::vector<double> seconds;
+    for (int i = 0; i < repetitions; ++i) {
+        Renderer renderer(scene, options.width, options.height);
+        renderer.setThreadCount(options.threads);
+        renderer.setMode(options.mode);
+        Clock::time_point start = Clock::now();
+        renderer.render();
+        seconds.push_back(std::chrono::duration<double>(Clock::now() - start).count());
+    }
+    std::nth_element(seconds.begin(), seconds.begin() + repetitions / 2, seconds.end());
+    const double median = seconds[repetitions / 2];
+
+    // Lecture une fois, construction et rendu à chaque répétition : moyennes par image
+    const RenderStats::Snapshot stats = RenderStats::collect();
+    const double rays = static_cast<double>(stats.counters[RenderStats::PRIMARY_RAYS]
+        + stats.counters[RenderStats::SHADOW_RAYS] + stats.counters[RenderStats::REFLECTION_RAYS]) / repetitions;
+    result.timeNs = median * 1e9;
+    result.metrics = {
+        {"rays_per_second", rays / median},
+        {"rays_per_frame", rays},
+        {"peak_rss_kb", static_cast<double>(BenchmarkReport::getPeakRss())},
+    };
+    for (int phase = 0; phase < RenderStats::PHASE_COUNT; ++phase) {
+        double ms = stats.seconds[phase] * 1000.0;
+        if (phase == RenderStats::BUILD || phase == RenderStats::RENDER)
+            ms /= repetitions;
+        if (phase != RenderStats::WRITE)
+            result.phasesMs[RenderStats::getName(static_cast<RenderStats::Phase>(phase))] = ms;
+    }
+    return true;
+}
+
+void runSceneBenchmarks(const BenchmarkOptions& options, BenchmarkReport& report)
+{
+    for (const std::filesystem::path& path : listScenes(options.sceneDirectory)) {
+        BenchmarkResult result;
+        result.name = "scene/" + path.stem().string();
+        if (!options.filter.empty() && result.name.find(options.filter) == std::string::npos)
+            continue;
+        try {
+            if (!benchScene(path, options, result)) {
+                std::cerr << "raytracer_bench: " << path.string() << " could not be parsed, skipped" << std::endl;
+                continue;
+            }
+        } catch (const GlobalException& e) {
+            std::cerr << "raytracer_bench: " << path.string() << ": " << e.what() << ", skipped" << std::endl;
+            continue;
+        }
+        std::cout << "  " << result.name << ": " << result.timeNs / 1e6 << " ms/frame, "
+                  << result.metrics[0].second / 1e6 << " Mrays/s" << std::endl;
+        report.add(std::move(result));
+    }
+}
+
+}
@@ -0,0 +1,152 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** raytracer_bench
+*/
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include "Benchmark.hpp"
+#include "GlobalException.hpp"
+#include "Parser/MeshCache.hpp"
+
+static constexpr const char *USAGE = "USAGE: ./raytracer_bench [--micro|--scenes] [-f FILTER] [-d SCENE_DIR] "
+    "[-r WIDTHxHEIGHT] [-t THREADS] [-m recursive|wavefront] [-n REPETITIONS] [-o RESULTS.json] "
+    "[--baseline BASELINE.json] [--tolerance PERCENT|PREFIX=PERCENT]...";
+
+struct Options {
+    Raytracer::BenchmarkOptions bench;
+    std::string output = "bench_results.json";
+    std::string baseline;
+    double tolerance = 0.10;
+    std::map<std::string, double> tolerances;
+};
+
+// Lit un entier strictement positif, sans caractère en trop
+static bool parsePositive(const char *text, int &value) {
+    try {
+        size_t end = 0;
+        value = std::stoi(text, &end);
+        return text[end] == '\0' && value > 0;
+    } catch (const std::exception &) {
+        return false;
+    }
+}
+
+// Lit un pourcentage positif ou nul, rendu en fraction
+static bool parsePercent(const std::string &text, double &value) {
+    try {
+        size_t end = 0;
+        value = std::stod(text, &end) / 100.0;
+        return end == text.size() && value >= 0.0;
+    } catch (const std::exception &) {
+        return false;
+    }
+}
+
+// Lit "--micro" / "--scenes" : une seule des deux familles de mesures
+// Lit "-f TEXTE" : seulement les mesures dont le nom contient TEXTE
+// Lit "-r LxH" : résolution des scènes, 320x240 par défaut ; "-t N" : threads de rendu, 1 par défaut
+// Lit "--tolerance P" : ralentissement toléré (10 % par défaut) ; "--tolerance PREFIXE=P" : pour les noms qui commencent par PREFIXE
+static bool parseArguments(const int argc, const char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        const std::string flag = argv[i];
+        int value;
+        if (flag == "--micro") {
+            options.bench.scenes = false;
+        } else if (flag == "--scenes") {
+            options.bench.micro = false;
+        } else if (!hasValue) {
+            return false;
+        } else if (flag == "-f" || flag == "--filter") {
+            options.bench.filter = argv[++i];
+        } else if (flag == "-d" || flag == "--scene-dir") {
+            options.bench.sceneDirectory = argv[++i];
+        } else if (flag == "-r" || flag == "--resolution") {
+            int width, height;
+            char separator;
+            std::string rest;
+            std::istringstream resolution(argv[++i]);
+            if (!(resolution >> width >> separator >> height) || separator != 'x' || width <= 0 || height <= 0
+                || (resolution >> rest))
+                return false;
+            options.bench.width = width;
+            options.bench.height = height;
+        } else if (flag == "-t" || flag == "--threads") {
+            if (!parsePositive(argv[++i], value))
+                return false;
+            options.bench.threads = static_cast<unsigned int>(value);
+        } else if (flag == "-m" || flag == "--mode") {
+            const std::string mode = argv[++i];
+            if (mode != "recursive" && mode != "wavefront")
+                return false;
+            options.bench.mode = mode == "wavefront" ? Raytracer::Renderer::WAVEFRONT : Raytracer::Renderer::RECURSIVE;
+        } else if (flag == "-n" || flag == "--repetitions") {
+            if (!parsePositive(argv[++i], options.bench.repetitions))
+                return false;
+        } else if (flag == "-o" || flag == "--output") {
+            options.output = argv[++i];
+        } else if (flag == "--baseline") {
+            options.baseline = argv[++i];
+        } else if (flag == "--tolerance") {
+            const std::string text = argv[++i];
+            const size_t equal = text.find('=');
+            double tolerance;
+            if (!parsePercent(equal == std::string::npos ? text : text.substr(equal + 1), tolerance))
+                return false;
+            if (equal == std::string::npos)
+                options.tolerance = tolerance;
+            else
+                options.tolerances[text.substr(0, equal)] = tolerance;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(const int argc, const char **argv) {
+    Options options;
+    if (!parseArguments(argc, argv, options))
+        return std::cerr << USAGE << std::endl, 84;
+
+    try {
+        // Sans cache de maillages : chaque lecture d'OBJ est mesurée pour de vrai
+        Raytracer::MeshCache::setDirectory("");
+        Raytracer::BenchmarkReport report;
+        if (options.bench.micro) {
+            std::cout << "Micro-benchmarks" << std::endl;
+            Raytracer::runMicroBenchmarks(options.bench, report);
+        }
+        if (options.bench.scenes) {
+            std::cout << "Scenes (" << options.bench.width << "x" << options.bench.height << ", "
+                      << options.bench.threads << " thread(s))" << std::endl;
+            Raytracer::runSceneBenchmarks(options.bench, report);
+        }
+
+        std::ofstream file(options.output);
+        report.writeJson(file, options.bench);
+        if (!file)
+            throw GlobalException("Error [bench] Failed to write results to " + options.output + ".");
+        std::cout << "Results saved as " << options.output << std::endl;
+
+        if (options.baseline.empty())
+            return 0;
+        std::cout << "Against " << options.baseline << std::endl;
+        int regressions = report.compare(Raytracer::BenchmarkReport::readBaseline(options.baseline),
+            options.tolerance, options.tolerances, std::cout);
+        if (regressions > 0) {
+            std::cout << regressions << " regression(s)" << std::endl;
+            return 1;
+        }
+    } catch (GlobalException &e) {
+        std::cerr << "raytracer_bench: " << e.what() << std::endl;
+        return 84;
+    }
+    return 0;
+}
@@ -0,0 +1,353 @@
+/**
+ * @file BVH.hpp
+ * @brief Bounding volume hierarchy built with the surface area heuristic
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the BVH class which organises a set of bounding boxes into
+ * a binary tree so that closest-hit queries only test the primitives whose boxes
+ * are actually crossed by the ray. The tree is built top-down with a binned
+ * surface area heuristic (SAH) and stored as a flat array of nodes.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Maths/AABB.hpp"
+#include "Maths/Ray.hpp"
+#include "Maths/RayPacket.hpp"
+#include "Utils/RenderStats.hpp"
+
+namespace Raytracer {
+    /**
+     * @class BVH
+     * @brief Flat, SAH-built bounding volume hierarchy over primitive indices
+     *
+     * The hierarchy does not own any primitive: it is built from one bounding box
+     * per primitive and only stores indices into the caller's array. Queries take a
+     * callback that intersects a single primitive, which keeps the structure usable
+     * for any kind of primitive container.
+     */
+    class BVH {
+    public:
+      /**
+       * @struct Node
+       * @brief A node of the hierarchy (32 bytes)
+       *
+       * Interior nodes have count == 0 and their children are stored at leftFirst and
+       * leftFirst + 1. Leaves reference count indices starting at leftFirst.
+       */
+      struct Node {
+        AABB bounds;        ///< Bounds of everything below this node
+        uint32_t leftFirst; ///< Left child index, or first primitive index for leaves
+        uint32_t count;     ///< Number of primitives in a leaf, 0 for interior nodes
+      };
+
+      /**
+       * @brief Builds the hierarchy over a set of primitive bounds
+       *
+       * Any previous content is discarded. Index i in the leaves refers to
+       * primitiveBounds[i].
+       *
+       * @param primitiveBounds One world-space bounding box per primitive
+       */
+      void build(const std::vector<AABB>& primitiveBounds);
+
+      /**
+       * @brief Restores a hierarchy previously obtained with getNodes() and getIndices()
+       *
+       * Used to reload a BVH from a cache file instead of rebuilding it. The arrays
+       * are checked so that a corrupted cache cannot make traversal read out of bounds.
+       *
+       * @param nodes Flat node array, root at index 0
+       * @param indices Primitive indices referenced by the leaves
+       * @param primitiveCount Number of primitives the hierarchy was built over
+       * @return true If the arrays describe a valid hierarchy, false (and empty BVH) otherwise
+       */
+      bool assign(std::vector<Node> nodes, std::vector<uint32_t> indices, uint32_t primitiveCount);
+
+      /**
+       * @brief Gets the flat node array, root at index 0
+       *
+       * @return const std::vector<Node>& The nodes
+       */
+      const std::vector<Node>& getNodes() const;
+
+      /**
+       * @brief Gets the primitive indices referenced by the leaves
+       *
+       * @return const std::vector<uint32_t>& The indices
+       */
+      const std::vector<uint32_t>& getIndices() const;
+
+      /**
+       * @brief Removes every node of the hierarchy
+       */
+      void clear();
+
+      /**
+       * @brief Checks whether the hierarchy contains at least one primitive
+       *
+       * @return true If the hierarchy has not been built or is empty
+       */
+      bool empty() const;
+
+      /**
+       * @brief Gets the bounding box of the whole hierarchy
+       *
+       * @return AABB The bounds of the root node, empty if the BVH is empty
+       */
+      AABB getBounds() const;
+
+      /**
+       * @brief Gets the number of nodes in the hierarchy
+       *
+       * @return size_t The node count
+       */
+      size_t getNodeCount() const;
+
+      /**
+       * @brief Finds the closest primitive hit by a ray
+       *
+       * Nodes are visited front to back and skipped as soon as their entry distance
+       * is beyond the closest hit found so far.
+       *
+       * @param ray The ray to trace
+       * @param tMax In: upper bound of the search. Out: distance to the closest hit
+       * @param intersectPrimitive Callable bool(uint32_t index, float& tMax) that tests
+       *        one primitive and lowers tMax when it finds a closer hit
+       * @return true If at least one primitive reported a hit
+       */
+      template <typename IntersectFn>
+      bool intersect(const Ray& ray, float& tMax, IntersectFn&& intersectPrimitive) const;
+
+      /**
+       * @brief Tells whether any primitive is hit by a ray before a distance
+       *
+       * Any-hit variant of intersect() for shadow rays: the traversal stops at the
+       * first primitive that reports a hit, and the order of the children is not
+       * sorted since any hit will do.
+       *
+       * @param ray The ray to trace
+       * @param tMax Upper bound of the search
+       * @param occludedBy Callable bool(uint32_t index) that tells whether one
+       *        primitive is hit before tMax
+       * @return true If a primitive reported a hit
+       */
+      template <typename OccludeFn>
+      bool occluded(const Ray& ray, float tMax, OccludeFn&& occludedBy) const;
+
+      /**
+       * @brief Finds the closest primitives hit by the rays of a packet
+       *
+       * The whole packet walks the tree together: a node is entered when at
+       * least one active ray crosses its box before its current closest hit, and
+       * the leaf callback only receives those rays. Children are visited nearest
+       * first along the direction of the first active ray, so the packet should
+       * be coherent (see RayPacket::isCoherent()).
+       *
+       * @param packet The rays
+       * @param mask Lanes to trace
+       * @param tMax Closest hit distance of each lane, lowered by the callback
+       * @param intersectPrimitive Callable void(uint32_t index, uint32_t mask) that
+       *        tests one primitive against the given lanes and lowers tMax
+       */
+      template <typename IntersectFn>
+      void intersectPacket(const RayPacket& packet, uint32_t mask, const float* tMax, IntersectFn&& intersectPrimitive) const;
+
+      /**
+       * @brief Finds which rays of a packet hit any primitive before their bound
+       *
+       * @param packet The rays
+       * @param mask Lanes to test
+       * @param tMax Upper bound of each lane
+       * @param occludedBy Callable uint32_t(uint32_t index, uint32_t mask) returning
+       *        the lanes of mask for which one primitive is hit before tMax
+       * @return uint32_t Lanes of mask that hit something
+       */
+      template <typename OccludeFn>
+      uint32_t occludedPacket(const RayPacket& packet, uint32_t mask, const float* tMax, OccludeFn&& occludedBy) const;
+
+    private:
+      static constexpr int BIN_COUNT = 16;      ///< Number of SAH buckets per split
+      static constexpr uint32_t MAX_LEAF = 4;   ///< Largest leaf created without a SAH check
+      static constexpr int STACK_SIZE = 64;     ///< Traversal stack depth
+
+      std::vector<Node> m_nodes;      ///< Flat node array, root at index 0
+      std::vector<uint32_t> m_indices; ///< Primitive indices referenced by the leaves
+
+      /**
+       * @brief Recursively splits a node using the binned SAH
+       *
+       * @param nodeIndex Index of the node to split
+       * @param bounds Bounds of every primitive
+       * @param centroids Centroids of every primitive
+       * @param depth Depth of the node, used to keep the traversal stack bounded
+       */
+      void subdivide(uint32_t nodeIndex, const std::vector<AABB>& bounds, const std::vector<Vector3>& centroids, int depth);
+  };
+
+  template <typename IntersectFn>
+  bool BVH::intersect(const Ray& ray, float& tMax, IntersectFn&& intersectPrimitive) const
+  {
+      if (m_nodes.empty())
+          return false;
+      const Vector3& origin = ray.getOrigin();
+      const Vector3& dir = ray.getDirection();
+      Vector3 invDir(1.0f / dir.x, 1.0f / dir.y, 1.0f / dir.z);
+      float tEntry;
+      if (!m_nodes[0].bounds.intersect(origin, invDir, tMax, tEntry))
+          return false;
+
+      uint32_t stack[STACK_SIZE];
+      int top = 0;
+      uint32_t current = 0;
+      bool hit = false;
+      RenderStats::Tally visited(RenderStats::BVH_NODES);
+      while (true) {
+          ++visited;
+          const Node& node = m_nodes[current];
+          if (node.count > 0) {
+              for (uint32_t i = 0; i < node.count; ++i) {
+                  if (intersectPrimitive(m_indices[node.leftFirst + i], tMax))
+                      hit = true;
+              }
+          } else {
+              uint32_t near = node.leftFirst;
+              uint32_t far = node.leftFirst + 1;
+              float tNear, tFar;
+              bool hitNear = m_nodes[near].bounds.intersect(origin, invDir, tMax, tNear);
+              bool hitFar = m_nodes[far].bounds.intersect(origin, invDir, tMax, tFar);
+              if (hitNear && hitFar) {
+                  if (tFar < tNear) {
+                      std::swap(near, far);
+                      std::swap(tNear, tFar);
+                  }
+                  stack[top++] = far;
+                  current = near;
+                  continue;
+              }
+              if (hitNear || hitFar) {
+                  current = hitNear ? near : far;
+                  continue;
+              }
+          }
+          // Pop the next node, dropping those now farther than the closest hit
+          bool found = false;
+          while (top > 0) {
+              current = stack[--top];
+              if (m_nodes[current].bounds.intersect(origin, invDir, tMax, tEntry)) {
+                  found = true;
+                  break;
+              }
+          }
+          if (!found)
+              break;
+      }
+      return hit;
+  }
+
+  template <typename OccludeFn>
+  bool BVH::occluded(const Ray& ray, float tMax, OccludeFn&& occludedBy) const
+  {
+      if (m_nodes.empty())
+          return false;
+      const Vector3& origin = ray.getOrigin();
+      const Vector3& dir = ray.getDirection();
+      Vector3 invDir(1.0f / dir.x, 1.0f / dir.y, 1.0f / dir.z);
+      float tEntry;
+      if (!m_nodes[0].bounds.intersect(origin, invDir, tMax, tEntry))
+          return false;
+
+      uint32_t stack[STACK_SIZE];
+      int top = 0;
+      stack[top++] = 0;
+      RenderStats::Tally visited(RenderStats::BVH_NODES);
+      while (top > 0) {
+          ++visited;
+          const Node& node = m_nodes[stack[--top]];
+          if (node.count > 0) {
+              for (uint32_t i = 0; i < node.count; ++i) {
+                  if (occludedBy(m_indices[node.leftFirst + i]))
+                      return true;
+              }
+              continue;
+          }
+          for (uint32_t child = node.leftFirst; child < node.leftFirst + 2; ++child) {
+              if (m_nodes[child].bounds.intersect(origin, invDir, tMax, tEntry))
+                  stack[top++] = child;
+          }
+      }
+      return false;
+  }
+
+  template <typename IntersectFn>
+  void BVH::intersectPacket(const RayPacket& packet, uint32_t mask, const float* tMax, IntersectFn&& intersectPrimitive) const
+  {
+      if (m_nodes.empty() || mask == 0)
+          return;
+      int lead = 0;
+      while (!(mask & (1u << lead)))
+          ++lead;
+      const Vector3& leadDir = packet.rays[lead].getDirection();
+
+      uint32_t stack[STACK_SIZE];
+      int top = 0;
+      stack[top++] = 0;
+      RenderStats::Tally visited(RenderStats::BVH_NODES);
+      while (top > 0) {
+          ++visited;
+          const Node& node = m_nodes[stack[--top]];
+          // Les distances ont pu baisser depuis l'empilement : le test est refait ici
+          uint32_t nodeMask = node.bounds.intersect(packet, FloatV::load(tMax), mask);
+          if (nodeMask == 0)
+              continue;
+          if (node.count > 0) {
+              for (uint32_t i = 0; i < node.count; ++i)
+                  intersectPrimitive(m_indices[node.leftFirst + i], nodeMask);
+              continue;
+          }
+          // Enfant le plus lointain empilé en premier, le plus proche est traité ensuite
+          uint32_t near = node.leftFirst;
+          uint32_t far = node.leftFirst + 1;
+          Vector3 between = m_nodes[far].bounds.centroid() - m_nodes[near].bounds.centroid();
+          if (between.dot(leadDir) < 0.0f)
+              std::swap(near, far);
+          stack[top++] = far;
+          stack[top++] = near;
+      }
+  }
+
+  template <typename OccludeFn>
+  uint32_t BVH::occludedPacket(const RayPacket& packet, uint32_t mask, const float* tMax, OccludeFn&& occludedBy) const
+  {
+      if (m_nodes.empty() || mask == 0)
+          return 0;
+      const FloatV bound = FloatV::load(tMax);
+      uint32_t occluded = 0;
+      uint32_t stack[STACK_SIZE];
+      int top = 0;
+      stack[top++] = 0;
+      RenderStats::Tally visited(RenderStats::BVH_NODES);
+      while (top > 0 && occluded != mask) {
+          ++visited;
+          const Node& node = m_nodes[stack[--top]];
+          uint32_t nodeMask = node.bounds.intersect(packet, bound, mask & ~occluded);
+          if (nodeMask == 0)
+              continue;
+          if (node.count > 0) {
+              for (uint32_t i = 0; i < node.count && nodeMask != 0; ++i) {
+                  uint32_t hit = occludedBy(m_indices[node.leftFirst + i], nodeMask);
+                  occluded |= hit;
+                  nodeMask &= ~hit;
+              }
+              continue;
+          }
+          stack[top++] = node.leftFirst;
+          stack[top++] = node.leftFirst + 1;
+      }
+      return occluded;
+  }
+}
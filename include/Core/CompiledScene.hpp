@@ -0,0 +1,256 @@
+/**
+ * @file CompiledScene.hpp
+ * @brief Render-ready, type-segregated copy of the primitives of a scene
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the CompiledScene class. Before a frame, the primitives
+ * of the scene are classified once by type: spheres, planes and triangles are
+ * copied into structure-of-arrays tables intersected by plain loops, the other
+ * types are kept in one array per concrete (final) class so that their calls
+ * are resolved at compile time. Materials are interned into a MaterialPalette
+ * and referenced by 16-bit index. Placed groups are compiled once each, and
+ * their copies expanded into a table of transforms.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Acceleration/BVH.hpp"
+#include "Core/Placement.hpp"
+#include "Material/MaterialPalette.hpp"
+#include "Maths/HitRecord.hpp"
+#include "Maths/Ray.hpp"
+#include "Maths/RayPacket.hpp"
+#include "Maths/Transform.hpp"
+#include "Primitives/IPrimitive.hpp"
+#include "Utils/Vector3.hpp"
+
+namespace Raytracer {
+    class Cone;
+    class Cylinder;
+    class MeshInstance;
+    class TangleCube;
+    class Torus;
+    class TriangleMesh;
+
+    /**
+     * @class CompiledScene
+     * @brief Frozen, devirtualized copy of the primitives that rendering needs
+     *
+     * Answers the same queries as the root CompositePrimitive, with the same
+     * results. Composite primitives are flattened into their leaves. Bounded
+     * primitives share one BVH whose leaves hold (type, index) references, laid
+     * out in traversal order; unbounded ones are tested first, one by one.
+     * Hit records keep pointing at the original primitive and also carry the
+     * index of its material. The compiled scene must not outlive the scene.
+     *
+     * Each placed group gets a compiled scene of its own (the bottom level);
+     * every copy of the group is one entry of the GROUP table, a transform
+     * into group space, and one leaf of the hierarchy of this scene (the top
+     * level). A hit on a copy points at the leaf primitive of the group.
+     */
+    class CompiledScene {
+    public:
+      /**
+       * @brief Primitive tables, in the order of the type field of a reference
+       */
+      enum PrimitiveType {
+        SPHERE,      ///< Structure of arrays: center, radius
+        PLANE,       ///< Structure of arrays: normal, distance
+        TRIANGLE,    ///< Structure of arrays: vertex, edges, normal
+        CYLINDER,    ///< Pointers to Cylinder, called without virtual dispatch
+        CONE,        ///< Pointers to Cone, called without virtual dispatch
+        TORUS,       ///< Pointers to Torus, called without virtual dispatch
+        TANGLECUBE,  ///< Pointers to TangleCube, called without virtual dispatch
+        MESH,        ///< Pointers to TriangleMesh, each with its own BVH
+        INSTANCE,    ///< Pointers to MeshInstance, shared meshes placed by a transform
+        GROUP,       ///< Copies of placed groups: group number and transform into group space
+        OTHER,       ///< Any other type, called through IPrimitive
+        TYPE_COUNT
+      };
+
+      /**
+       * @brief Creates an empty scene that nothing hits
+       */
+      CompiledScene() = default;
+
+      /**
+       * @brief Classifies primitives, expands placements and builds the hierarchy over the bounded ones
+       *
+       * @param primitives Primitives of the scene, composites included
+       * @param groups Groups that placements refer to
+       * @param placements Copies of groups, expanded here
+       * @throws GlobalException If the scene holds more than MaterialPalette::MAX_SIZE distinct materials,
+       * a group holds an unbounded primitive, a placement refers to no group or a table overflows
+       */
+      explicit CompiledScene(const std::vector<std::shared_ptr<IPrimitive>>& primitives,
+          const std::vector<PrimitiveGroup>& groups = {}, const std::vector<Placement>& placements = {});
+
+      /**
+       * @brief Finds the closest hit of a ray
+       *
+       * @param ray The ray
+       * @param hit Filled with the closest hit beyond OCCLUSION_EPSILON
+       * @return true If the ray hits anything
+       */
+      bool intersect(const Ray& ray, HitRecord& hit) const;
+
+      /**
+       * @brief Tells whether anything lies on a segment
+       *
+       * @param ray The ray
+       * @param tMax End of the segment
+       * @return true If a hit exists with OCCLUSION_EPSILON < t < tMax
+       */
+      bool occludes(const Ray& ray, float tMax) const;
+
+      /**
+       * @brief Finds the closest hits of a packet of rays
+       *
+       * @param packet The rays
+       * @param mask Lanes to trace
+       * @param hits Closest hits found so far, updated in place
+       */
+      void intersectPacket(const RayPacket& packet, uint32_t mask, PacketHit& hits) const;
+
+      /**
+       * @brief Tells which rays of a packet are blocked before their end
+       *
+       * @param packet The rays
+       * @param mask Lanes to test
+       * @param tMax End of the segment of each lane
+       * @return uint32_t Lanes of mask with a hit between OCCLUSION_EPSILON and tMax
+       */
+      uint32_t occludesPacket(const RayPacket& packet, uint32_t mask, const float* tMax) const;
+
+      /**
+       * @brief Gets the materials of the scene
+       *
+       * @return const MaterialPalette& Palette indexed by HitRecord::material
+       */
+      const MaterialPalette& getPalette() const
+      {
+          return m_palette;
+      }
+
+      /**
+       * @brief Gets the number of primitives of a type
+       *
+       * @param type The table
+       * @return size_t Primitives of that table
+       */
+      size_t getCount(PrimitiveType type) const;
+
+      /**
+       * @brief Gets the number of primitives in every table
+       *
+       * @return size_t Leaf primitives of the scene, one per copy of a group
+       */
+      size_t getCount() const;
+
+      /**
+       * @brief Gets the number of compiled groups
+       *
+       * @return size_t Groups, each shared by all its copies
+       */
+      size_t getGroupCount() const;
+
+    private:
+      static constexpr uint32_t TYPE_SHIFT = 28;                      ///< Type field of a reference
+      static constexpr uint32_t INDEX_MASK = (1u << TYPE_SHIFT) - 1;  ///< Index field of a reference
+      static_assert(Placement::MAX_COUNT == INDEX_MASK, "a valid grid must fit in the index field");
+
+      std::vector<Vector3> m_sphereCenter;     ///< Sphere centers
+      std::vector<float> m_sphereRadius;       ///< Sphere radii
+      std::vector<Vector3> m_planeNormal;      ///< Plane unit normals
+      std::vector<float> m_planeDistance;      ///< Plane distances from the origin
+      std::vector<Vector3> m_triangleA;        ///< Triangle first vertices
+      std::vector<Vector3> m_triangleEdge1;    ///< Triangle second minus first vertex
+      std::vector<Vector3> m_triangleEdge2;    ///< Triangle third minus first vertex
+      std::vector<Vector3> m_triangleNormal;   ///< Triangle unit normals
+      std::vector<const Cylinder*> m_cylinders;     ///< Cylinders
+      std::vector<const Cone*> m_cones;             ///< Cones
+      std::vector<const Torus*> m_tori;             ///< Tori
+      std::vector<const TangleCube*> m_tangleCubes; ///< Tangle cubes
+      std::vector<const TriangleMesh*> m_meshes;    ///< Meshes
+      std::vector<const MeshInstance*> m_instances; ///< Mesh instances
+      std::vector<uint32_t> m_copyGroup;            ///< Group of each copy
+      std::vector<Transform> m_copyToGroup;         ///< From world space to the space of the group, by copy
+
+      std::vector<std::unique_ptr<CompiledScene>> m_groups; ///< Compiled groups
+      std::vector<std::vector<uint16_t>> m_groupMaterials;  ///< Palette index of each material of each group
+      std::vector<const IPrimitive*> m_others;      ///< Primitives of other types
+
+      std::vector<const IPrimitive*> m_source[TYPE_COUNT]; ///< Original primitive of each entry, by table
+      std::vector<uint16_t> m_material[TYPE_COUNT];        ///< Material index of each entry, by table
+      MaterialPalette m_palette;                           ///< Distinct materials of the scene
+
+      BVH m_bvh;                         ///< Hierarchy over the bounded primitives
+      std::vector<uint32_t> m_bounded;   ///< References of the bounded primitives, in BVH order
+      std::vector<uint32_t> m_unbounded; ///< References of the primitives tested on every ray
+
+      /**
+       * @brief Appends a primitive to its table
+       *
+       * @param primitive Leaf primitive
+       * @return uint32_t Reference (type and index) of the new entry
+       */
+      uint32_t add(const IPrimitive* primitive);
+
+      /**
+       * @brief Appends a copy of a group to the GROUP table
+       *
+       * @param group Index of the group
+       * @param toGroup From world space to the space of the group
+       * @return uint32_t Reference (type and index) of the new entry
+       */
+      uint32_t addCopy(uint32_t group, const Transform& toGroup);
+
+      /**
+       * @brief Compiles every group and interns its materials
+       *
+       * @param groups The groups
+       * @return std::vector<AABB> Bounds of each group, in its own space
+       */
+      std::vector<AABB> compileGroups(const std::vector<PrimitiveGroup>& groups);
+
+      /**
+       * @brief Moves a hit found in the space of a group back to world space
+       *
+       * @param copy Index of the copy in the GROUP table
+       * @param ray The world-space ray
+       * @param t World-space distance of the hit
+       * @param hit Record filled by the group, updated in place
+       */
+      void toWorld(uint32_t copy, const Ray& ray, float t, HitRecord& hit) const;
+
+      /**
+       * @brief Intersects one primitive, without the epsilon and distance checks
+       */
+      bool intersectOne(uint32_t reference, const Ray& ray, HitRecord& hit) const;
+
+      /**
+       * @brief Occlusion test of one primitive
+       */
+      bool occludesOne(uint32_t reference, const Ray& ray, float tMax) const;
+
+      /**
+       * @brief Packet intersection of one primitive
+       */
+      void intersectPacketOne(uint32_t reference, const RayPacket& packet, uint32_t mask, PacketHit& hits) const;
+
+      /**
+       * @brief Packet intersection of one copy of a group
+       */
+      void intersectPacketCopy(uint32_t copy, const RayPacket& packet, uint32_t mask, PacketHit& hits) const;
+
+      /**
+       * @brief Packet occlusion test of one primitive
+       */
+      uint32_t occludesPacketOne(uint32_t reference, const RayPacket& packet, uint32_t mask, const float* tMax) const;
+  };
+}
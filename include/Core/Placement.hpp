@@ -0,0 +1,151 @@
+/**
+ * @file Placement.hpp
+ * @brief Named primitive groups and the placements that repeat them
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the PrimitiveGroup structure and the Placement class.
+ * A placement is a few numbers describing one copy, a grid of copies or a
+ * random scatter of copies of a group. Scene files stay small and parsing
+ * stays cheap: the transform of each copy is only computed when the scene
+ * is compiled, and every copy shares the compiled group.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Maths/Transform.hpp"
+#include "Primitives/IPrimitive.hpp"
+#include "Utils/Vector3.hpp"
+
+namespace Raytracer {
+    /**
+     * @struct PrimitiveGroup
+     * @brief Bounded primitives described once in their own space
+     */
+    struct PrimitiveGroup {
+        std::string name;                                   ///< Name used by placements
+        std::vector<std::shared_ptr<IPrimitive>> primitives; ///< Members, in group space
+    };
+
+    /**
+     * @class Placement
+     * @brief Copies of a group, generated one by one on demand
+     *
+     * Scatters draw each copy from a hash of the seed and the copy number,
+     * so any copy can be generated alone and the result does not depend on
+     * the order of generation.
+     */
+    class Placement {
+    public:
+      static constexpr size_t MAX_COUNT = (size_t(1) << 28) - 1; ///< Most copies of one grid, CompiledScene::INDEX_MASK
+
+      /**
+       * @brief Ways of laying out copies
+       */
+      enum Kind {
+        SINGLE,  ///< One copy
+        GRID,    ///< Copies at regular steps along X, Y and Z
+        SCATTER  ///< Copies at random positions, rotations and scales
+      };
+
+      /**
+       * @brief Places one copy of a group
+       *
+       * @param group Index of the group in the scene
+       * @param transform From group space to world space
+       */
+      Placement(size_t group, const Transform& transform);
+
+      /**
+       * @brief Places a grid of copies
+       *
+       * Copy (i, j, k) is moved by (i * spacing.x, j * spacing.y, k * spacing.z),
+       * then the whole grid goes through transform.
+       *
+       * @param group Index of the group in the scene
+       * @param transform Placement of the whole grid
+       * @param countX Copies along X
+       * @param countY Copies along Y
+       * @param countZ Copies along Z
+       * @param spacing Step between two copies along each axis
+       * @return Placement The grid
+       * @throws GlobalException If a count is negative or the grid holds more than MAX_COUNT copies
+       */
+      static Placement makeGrid(size_t group, const Transform& transform, int countX, int countY, int countZ,
+          const Vector3& spacing);
+
+      /**
+       * @brief Tells whether a grid holds at most MAX_COUNT copies, without overflowing
+       *
+       * @param countX Copies along X, not negative
+       * @param countY Copies along Y, not negative
+       * @param countZ Copies along Z, not negative
+       * @return true If countX * countY * countZ <= MAX_COUNT
+       */
+      static bool isGridSizeValid(int countX, int countY, int countZ);
+
+      /**
+       * @brief Scatters copies at random inside a box
+       *
+       * @param group Index of the group in the scene
+       * @param count Number of copies
+       * @param seed Seed of the random draw
+       * @param min Lower corner of the box holding the origins of the copies
+       * @param max Upper corner of the box
+       * @param rotation Largest angle in degrees about X, Y and Z, each drawn from [0, angle]
+       * @param minScale Smallest uniform scale
+       * @param maxScale Largest uniform scale
+       * @return Placement The scatter
+       * @throws GlobalException If count is negative or a scale is not positive
+       */
+      static Placement makeScatter(size_t group, int count, uint64_t seed, const Vector3& min, const Vector3& max,
+          const Vector3& rotation, float minScale, float maxScale);
+
+      /**
+       * @brief Gets the layout
+       *
+       * @return Kind The layout
+       */
+      Kind getKind() const;
+
+      /**
+       * @brief Gets the placed group
+       *
+       * @return size_t Index of the group in the scene
+       */
+      size_t getGroup() const;
+
+      /**
+       * @brief Gets the number of copies
+       *
+       * @return size_t Copies described by this placement
+       */
+      size_t getCount() const;
+
+      /**
+       * @brief Computes the transform of one copy
+       *
+       * @param index Copy number, below getCount()
+       * @return Transform From group space to world space
+       */
+      Transform getTransform(size_t index) const;
+
+    private:
+      Kind m_kind;            ///< Layout
+      size_t m_group;         ///< Index of the group
+      Transform m_transform;  ///< Single copy, or placement of the whole grid
+      size_t m_counts[3];     ///< Grid copies along each axis; scatter count in m_counts[0]
+      Vector3 m_spacing;      ///< Grid step
+      uint64_t m_seed;        ///< Scatter seed
+      Vector3 m_min;          ///< Scatter box lower corner
+      Vector3 m_max;          ///< Scatter box upper corner
+      Vector3 m_rotation;     ///< Scatter largest angles
+      float m_minScale;       ///< Scatter smallest scale
+      float m_maxScale;       ///< Scatter largest scale
+  };
+}
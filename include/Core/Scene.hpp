@@ -8,12 +8,16 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <vector>
 #include "Core/Camera.hpp"
+#include "Core/CompiledScene.hpp"
+#include "Core/Placement.hpp"
 #include "Lights/ILight.hpp"
 #include "Primitives/IPrimitive.hpp"
 #include "Primitives/CompositePrimitive.hpp"
 #include "Lights/CompositeLight.hpp"
+#include "Lights/LightTable.hpp"
 
 namespace Raytracer {
     /**
@@ -33,13 +37,26 @@ namespace Raytracer {
       void addPrimitive(std::shared_ptr<IPrimitive> primitive);
       const std::vector<std::shared_ptr<IPrimitive>>& getPrimitives() const;
       
+      // Groupes nommés, décrits une fois dans leur propre repère et copiés par les placements
+      size_t addGroup(const std::string& name, std::vector<std::shared_ptr<IPrimitive>> primitives);
+      bool findGroup(const std::string& name, size_t& index) const;
+      const std::vector<PrimitiveGroup>& getGroups() const;
+      void addPlacement(const Placement& placement);
+      const std::vector<Placement>& getPlacements() const;
+
       // Accès au composite principal des primitives
-      std::shared_ptr<CompositePrimitive> getRootCompositePrimitive() const;
+      const std::shared_ptr<CompositePrimitive>& getRootCompositePrimitive() const;
+
+      // Primitives rangées par type pour le rendu, à reconstruire si la scène change
+      CompiledScene compile() const;
       
       // Méthodes pour ajouter des lumières
       void addLight(std::shared_ptr<ILight> light);
       const std::vector<std::shared_ptr<ILight>>& getLights() const;
       
+      // Table figée des lumières, à reconstruire si la scène change
+      LightTable createLightTable() const;
+
       // Accès au composite principal des lumières
       std::shared_ptr<CompositeLight> getRootCompositeLight() const;
       
@@ -51,6 +68,8 @@ namespace Raytracer {
       Camera m_camera;
       std::vector<std::shared_ptr<IPrimitive>> m_primitives;
       std::shared_ptr<CompositePrimitive> m_rootCompositePrimitive;
+      std::vector<PrimitiveGroup> m_groups;
+      std::vector<Placement> m_placements;
       std::vector<std::shared_ptr<ILight>> m_lights;
       std::shared_ptr<CompositeLight> m_rootCompositeLight;
       float m_ambientIntensity = 0.0f;
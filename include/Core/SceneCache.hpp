@@ -0,0 +1,90 @@
+/**
+ * @file SceneCache.hpp
+ * @brief Parsed and compiled scenes kept between renders
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the SceneCache class used by long-running processes.
+ * A scene file is parsed, and its primitives and lights compiled, only the
+ * first time it is asked for; later requests reuse the result as long as
+ * neither the scene file nor any OBJ file it loads has changed on disk.
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Core/CompiledScene.hpp"
+#include "Core/Scene.hpp"
+#include "Lights/LightTable.hpp"
+
+namespace Raytracer {
+    /**
+     * @struct PreparedScene
+     * @brief A parsed scene and the tables the renderer builds from it
+     *
+     * Never modified once built: renderers share the tables through
+     * Renderer::setCompiled() and replace the camera with Renderer::setCamera().
+     */
+    struct PreparedScene {
+        Scene scene;                                ///< Parsed scene, with the camera of the file
+        std::shared_ptr<const CompiledScene> geometry; ///< Compiled primitives and top-level BVH
+        std::shared_ptr<const LightTable> lights;   ///< Frozen lights
+    };
+
+    /**
+     * @class SceneCache
+     * @brief Scenes by path, reloaded when one of their files changes
+     *
+     * A file counts as changed when its modification time differs from the
+     * one seen at load time, or when it can no longer be read. Not thread
+     * safe: a single thread asks for scenes.
+     */
+    class SceneCache {
+    public:
+      /**
+       * @brief Gets a scene ready to render
+       *
+       * @param filename Path to the scene file
+       * @param reused Set to true if the scene came from the cache, false if it was loaded
+       * @return std::shared_ptr<const PreparedScene> The scene, valid even if the cache reloads it later
+       * @throws GlobalException If the scene cannot be parsed or compiled; the cache then keeps no entry for it
+       */
+      std::shared_ptr<const PreparedScene> get(const std::string& filename, bool& reused);
+
+      /**
+       * @brief Drops every scene
+       */
+      void clear();
+
+      /**
+       * @brief Gets the number of scenes kept
+       *
+       * @return size_t Scenes loaded and not dropped
+       */
+      size_t getSize() const;
+
+    private:
+      /**
+       * @brief A scene and the state of its files when it was loaded
+       */
+      struct Entry {
+          std::vector<std::pair<std::string, std::filesystem::file_time_type>> files; ///< Scene file, then OBJ files
+          std::shared_ptr<const PreparedScene> scene;                                 ///< The prepared scene
+      };
+
+      /**
+       * @brief Tells whether the files of an entry are unchanged
+       *
+       * @param entry The entry
+       * @return true If every file still has its modification time
+       */
+      static bool isFresh(const Entry& entry);
+
+      std::map<std::string, Entry> m_entries; ///< Scenes by normalized absolute path
+  };
+}
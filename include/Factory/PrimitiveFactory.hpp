@@ -7,9 +7,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 #include "Material/Material.hpp"
+#include "Maths/Transform.hpp"
 #include "Primitives/IPrimitive.hpp"
+#include "Primitives/TriangleMesh.hpp"
 #include "Utils/Vector3.hpp"
 
 namespace Raytracer {
@@ -32,6 +36,10 @@ namespace Raytracer {
       static std::shared_ptr<IPrimitive> createCone(const Vector3& baseCenter, float radius, float height, const Vector3& rotation, const Material& material);
 
       static std::shared_ptr<IPrimitive> createTriangle(const Vector3& a, const Vector3& b, const Vector3& c, const Material& material);
+
+      static std::shared_ptr<IPrimitive> createTriangleMesh(std::vector<Vector3> vertices, std::vector<uint32_t> indices, const Material& material);
+
+      static std::shared_ptr<IPrimitive> createMeshInstance(std::shared_ptr<const TriangleMesh> mesh, const Transform& transform, const Material& material);
   
       static std::shared_ptr<IPrimitive> createTorus(const Vector3& center, float majorRadius, float minorRadius, const Vector3& rotation, const Material& material);
 
@@ -6,6 +6,7 @@
 */
 
 #pragma once
+#include <limits>
 #include "Utils/Vector3.hpp"
 
 namespace Raytracer {
@@ -32,6 +33,18 @@ namespace Raytracer {
          */
         virtual Vector3 getDirectionFrom(const Vector3 &point) const = 0;
 
+        /**
+         * @brief Gets the distance from a point to the light source.
+         * @param point The 3D point from which to measure the distance.
+         * @return Distance a shadow ray has to cover to reach the light.
+         * @note Lights without a position (directional, ambient) are infinitely far.
+         */
+        virtual float getDistanceFrom(const Vector3 &point) const
+        {
+            (void)point;
+            return std::numeric_limits<float>::infinity();
+        }
+
         /**
          * @brief Gets the light intensity at a surface point.
          * @return The light intensity value (typically between 0.0 and 1.0).
@@ -0,0 +1,144 @@
+/**
+ * @file LightTable.hpp
+ * @brief Render-ready snapshot of the lights of a scene
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the LightTable class. Before a frame, the lights of the
+ * scene are classified once: ambient intensities are summed into one term,
+ * point and directional lights are copied into separate structure-of-arrays
+ * tables. Shading then reads plain arrays instead of going through
+ * dynamic_cast and shared_ptr for every light of every hit.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+#include "Lights/ILight.hpp"
+#include "Utils/Vector3.hpp"
+
+namespace Raytracer {
+    /**
+     * @class LightTable
+     * @brief Frozen copy of the lights that shading needs
+     *
+     * Lights casting shadows are numbered point lights first, then directional
+     * lights, then lights of any other type (reached through ILight), each group
+     * in scene order; that index is the bit of a light in the shadow masks.
+     * Composite lights are skipped: the lights they hold are listed in the
+     * scene on their own. The table must not outlive the scene it was built from.
+     */
+    class LightTable {
+    public:
+      /**
+       * @brief Creates an empty table: no ambient term, no light
+       */
+      LightTable() = default;
+
+      /**
+       * @brief Classifies lights
+       *
+       * @param lights Lights of the scene
+       */
+      explicit LightTable(const std::vector<std::shared_ptr<ILight>>& lights);
+
+      /**
+       * @brief Gets the sum of the ambient intensities
+       *
+       * @return float Ambient term, 0 without ambient light
+       */
+      float getAmbient() const
+      {
+          return m_ambient;
+      }
+
+      /**
+       * @brief Gets the number of lights casting shadows
+       *
+       * @return size_t Point, directional and other lights
+       */
+      size_t getCount() const
+      {
+          return m_intensity.size();
+      }
+
+      /**
+       * @brief Gets the number of point lights, numbered first
+       *
+       * @return size_t Point lights
+       */
+      size_t getPointCount() const
+      {
+          return m_pointX.size();
+      }
+
+      /**
+       * @brief Gets the number of directional lights, numbered after the point lights
+       *
+       * @return size_t Directional lights
+       */
+      size_t getDirectionalCount() const
+      {
+          return m_directionX.size();
+      }
+
+      /**
+       * @brief Gets the normalized direction from a point towards a light
+       *
+       * @param index Light index, below getCount()
+       * @param point The lit point
+       * @return Vector3 Unit direction
+       */
+      Vector3 getDirection(size_t index, const Vector3& point) const
+      {
+          if (index < m_pointX.size())
+              return (Vector3(m_pointX[index], m_pointY[index], m_pointZ[index]) - point).normalized();
+          index -= m_pointX.size();
+          if (index < m_directionX.size())
+              return Vector3(m_directionX[index], m_directionY[index], m_directionZ[index]);
+          return m_others[index - m_directionX.size()]->getDirectionFrom(point).normalized();
+      }
+
+      /**
+       * @brief Gets the distance from a point to a light
+       *
+       * @param index Light index, below getCount()
+       * @param point The point
+       * @return float Distance, infinity for directional lights
+       */
+      float getDistance(size_t index, const Vector3& point) const
+      {
+          if (index < m_pointX.size())
+              return (Vector3(m_pointX[index], m_pointY[index], m_pointZ[index]) - point).length();
+          index -= m_pointX.size();
+          if (index < m_directionX.size())
+              return std::numeric_limits<float>::infinity();
+          return m_others[index - m_directionX.size()]->getDistanceFrom(point);
+      }
+
+      /**
+       * @brief Gets the intensity of a light
+       *
+       * @param index Light index, below getCount()
+       * @return float Intensity
+       */
+      float getIntensity(size_t index) const
+      {
+          return m_intensity[index];
+      }
+
+    private:
+      float m_ambient = 0.0f;              ///< Sum of the ambient intensities
+      std::vector<float> m_pointX;         ///< Point light positions, x
+      std::vector<float> m_pointY;         ///< Point light positions, y
+      std::vector<float> m_pointZ;         ///< Point light positions, z
+      std::vector<float> m_directionX;     ///< Directional light unit directions, x
+      std::vector<float> m_directionY;     ///< Directional light unit directions, y
+      std::vector<float> m_directionZ;     ///< Directional light unit directions, z
+      std::vector<const ILight*> m_others; ///< Lights of other types, used through ILight
+      std::vector<float> m_intensity;      ///< Intensity of every light, by light index
+  };
+}
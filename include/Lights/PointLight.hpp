@@ -27,6 +27,14 @@ namespace Raytracer {
          */
         Vector3 getDirectionFrom(const Vector3 &point) const override;
 
+        /**
+         * @brief Get the distance from a point to this light
+         *
+         * @param point The point from which to measure the distance
+         * @return float Distance between the point and the light position
+         */
+        float getDistanceFrom(const Vector3 &point) const override;
+
         /**
          * @brief Get the intensity of the light
          *
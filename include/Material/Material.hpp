@@ -47,11 +47,6 @@ namespace Raytracer {
        */
       Material(Type type, const Color& color) : _type(type), _color(color) {
       }
-      
-      /**
-       * @brief Virtual destructor
-       */
-      virtual ~Material() = default;
 
       /**
        * @brief Sets the material type
@@ -0,0 +1,137 @@
+/**
+ * @file MaterialPalette.hpp
+ * @brief Deduplicated, render-ready table of the materials of a scene
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the MaterialPalette class. Every primitive carries its
+ * own Material (six doubles and a color); the palette keeps one float32 copy
+ * of each distinct material, addressed by a 16-bit index, with the terms
+ * that shading derives from it already computed.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <vector>
+#include "Material/Material.hpp"
+
+namespace Raytracer {
+    /**
+     * @class MaterialPalette
+     * @brief Interns materials and stores them for fast lookups during shading
+     *
+     * Equal materials (same type, color and properties) share one index.
+     * What shading reads for a hit fits in one 32-byte Entry, so a lookup
+     * touches a single cache line; the other properties are kept apart.
+     */
+    class MaterialPalette {
+    public:
+      static constexpr size_t MAX_SIZE = 65536; ///< Materials addressable by a 16-bit index
+
+      /**
+       * @struct Entry
+       * @brief Shading terms of a material, in float32
+       */
+      struct alignas(32) Entry {
+          float red;         ///< Base color, 0 to 255
+          float green;       ///< Base color, 0 to 255
+          float blue;        ///< Base color, 0 to 255
+          float shininess;   ///< Blinn-Phong exponent
+          float specular;    ///< Weight of the specular highlight
+          float reflectance; ///< Share of the reflected color
+          float emission;    ///< Emitted share of the base color, 0 if not emissive
+          Material::Type type; ///< Material type
+      };
+
+      /**
+       * @brief Adds a material, or finds the equal one already added
+       *
+       * @param material The material
+       * @return uint16_t Index of the material
+       * @throws GlobalException If MAX_SIZE distinct materials are already stored
+       */
+      uint16_t add(const Material& material);
+
+      /**
+       * @brief Adds a material of another palette, or finds the equal one already added
+       *
+       * The key and terms are copied as they are, so materials equal in their
+       * original palette stay equal here and shade exactly the same.
+       *
+       * @param other The palette holding the material
+       * @param index Index of the material in other
+       * @return uint16_t Index of the material in this palette
+       * @throws GlobalException If MAX_SIZE distinct materials are already stored
+       */
+      uint16_t add(const MaterialPalette& other, uint16_t index);
+
+      /**
+       * @brief Gets the shading terms of a material
+       *
+       * @param index Index returned by add()
+       * @return const Entry& The terms
+       */
+      const Entry& operator[](uint16_t index) const
+      {
+          return m_entries[index];
+      }
+
+      /**
+       * @brief Rebuilds a material from its float32 copy
+       *
+       * @param index Index returned by add()
+       * @return Material The material, properties rounded to float
+       */
+      Material getMaterial(uint16_t index) const;
+
+      /**
+       * @brief Gets the number of distinct materials
+       *
+       * @return size_t Materials in the palette
+       */
+      size_t getSize() const;
+
+      /**
+       * @brief Gets the share of the reflected color in a material
+       *
+       * Metals derive it from their roughness, other materials store it directly.
+       *
+       * @param material The material
+       * @return float Weight of the reflection
+       */
+      static float getReflectance(const Material& material);
+
+    private:
+      /**
+       * @struct Properties
+       * @brief Properties not read by shading, in float32
+       */
+      struct Properties {
+          float roughness;         ///< Surface roughness
+          float metalness;         ///< Metallic factor
+          float reflectivity;      ///< Reflection factor as given
+          float transparency;      ///< Transparency factor
+          float refractiveIndex;   ///< Refractive index
+          float emissiveIntensity; ///< Light emission intensity as given
+      };
+
+      using Key = std::tuple<int, int, int, int, double, double, double, double, double, double>;
+
+      std::vector<Entry> m_entries;         ///< Shading terms, by index
+      std::vector<Properties> m_properties; ///< Other properties, by index
+      std::vector<Key> m_keys;              ///< Material as added, by index
+      std::map<Key, uint16_t> m_lookup;     ///< Index of every material added
+
+      /**
+       * @brief Stores a material not found in m_lookup
+       *
+       * @return uint16_t Index of the material
+       * @throws GlobalException If MAX_SIZE distinct materials are already stored
+       */
+      uint16_t insert(const Key& key, const Entry& entry, const Properties& properties);
+  };
+}
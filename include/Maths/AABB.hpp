@@ -0,0 +1,245 @@
+/**
+ * @file AABB.hpp
+ * @brief Axis-aligned bounding box used by the acceleration structures
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the AABB structure which stores a world-space box aligned
+ * on the X, Y and Z axes. It provides the union, surface area and slab test
+ * operations needed to build and traverse a bounding volume hierarchy.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "Maths/Ray.hpp"
+#include "Maths/RayPacket.hpp"
+#include "Utils/Vector3.hpp"
+
+namespace Raytracer {
+    /**
+     * @struct AABB
+     * @brief Axis-aligned bounding box
+     *
+     * A default constructed box is empty (min = +inf, max = -inf), so that
+     * expanding it by any point or box yields exactly that point or box.
+     */
+    struct AABB {
+        Vector3 min; ///< Lower corner of the box
+        Vector3 max; ///< Upper corner of the box
+
+        /**
+         * @brief Constructs an empty box
+         */
+        AABB()
+            : min(std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity())
+            , max(-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity())
+        {
+        }
+
+        /**
+         * @brief Constructs a box from its two corners
+         *
+         * @param lower Lower corner of the box
+         * @param upper Upper corner of the box
+         */
+        AABB(const Vector3& lower, const Vector3& upper) : min(lower), max(upper)
+        {
+        }
+
+        /**
+         * @brief Grows the box so that it contains a point
+         *
+         * @param p The point to include
+         */
+        void expand(const Vector3& p)
+        {
+            min.x = std::min(min.x, p.x);
+            min.y = std::min(min.y, p.y);
+            min.z = std::min(min.z, p.z);
+            max.x = std::max(max.x, p.x);
+            max.y = std::max(max.y, p.y);
+            max.z = std::max(max.z, p.z);
+        }
+
+        /**
+         * @brief Grows the box so that it contains another box
+         *
+         * @param other The box to include
+         */
+        void expand(const AABB& other)
+        {
+            min.x = std::min(min.x, other.min.x);
+            min.y = std::min(min.y, other.min.y);
+            min.z = std::min(min.z, other.min.z);
+            max.x = std::max(max.x, other.max.x);
+            max.y = std::max(max.y, other.max.y);
+            max.z = std::max(max.z, other.max.z);
+        }
+
+        /**
+         * @brief Grows the box so that it contains a disk
+         *
+         * The extent of a disk along a world axis is radius * sqrt(1 - n²), n being
+         * the matching component of the disk normal, which gives tight boxes for
+         * rotated cylinders, cones and tori.
+         *
+         * @param center Center of the disk
+         * @param normal Unit normal of the disk
+         * @param radius Radius of the disk
+         */
+        void expandDisk(const Vector3& center, const Vector3& normal, float radius)
+        {
+            Vector3 extent(radius * std::sqrt(std::max(0.0f, 1.0f - normal.x * normal.x)),
+                           radius * std::sqrt(std::max(0.0f, 1.0f - normal.y * normal.y)),
+                           radius * std::sqrt(std::max(0.0f, 1.0f - normal.z * normal.z)));
+            expand(center - extent);
+            expand(center + extent);
+        }
+
+        /**
+         * @brief Checks whether the box contains no point at all
+         *
+         * @return true If the box has never been expanded
+         */
+        bool isEmpty() const
+        {
+            return min.x > max.x || min.y > max.y || min.z > max.z;
+        }
+
+        /**
+         * @brief Gets the center of the box
+         *
+         * @return Vector3 The midpoint between both corners
+         */
+        Vector3 centroid() const
+        {
+            return Vector3((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f);
+        }
+
+        /**
+         * @brief Gets the surface area of the box, used by the SAH cost
+         *
+         * @return float The surface area, 0 for an empty box
+         */
+        float surfaceArea() const
+        {
+            if (isEmpty())
+                return 0.0f;
+            float dx = max.x - min.x;
+            float dy = max.y - min.y;
+            float dz = max.z - min.z;
+            return 2.0f * (dx * dy + dy * dz + dz * dx);
+        }
+
+        /**
+         * @brief Gets the axis along which the box is the longest
+         *
+         * @return int 0 for X, 1 for Y, 2 for Z
+         */
+        int longestAxis() const
+        {
+            float dx = max.x - min.x;
+            float dy = max.y - min.y;
+            float dz = max.z - min.z;
+            if (dx >= dy && dx >= dz)
+                return 0;
+            return dy >= dz ? 1 : 2;
+        }
+
+        /**
+         * @brief Slab test against a ray given its precomputed inverse direction
+         *
+         * @param origin Origin of the ray
+         * @param invDir Component-wise inverse of the ray direction
+         * @param tMax Upper bound of the ray interval
+         * @param tEntry Output distance at which the ray enters the box (clamped to 0)
+         * @return true If the ray overlaps the box within [0, tMax]
+         */
+        bool intersect(const Vector3& origin, const Vector3& invDir, float tMax, float& tEntry) const
+        {
+            float tx1 = (min.x - origin.x) * invDir.x;
+            float tx2 = (max.x - origin.x) * invDir.x;
+            float tNear = std::min(tx1, tx2);
+            float tFar = std::max(tx1, tx2);
+            float ty1 = (min.y - origin.y) * invDir.y;
+            float ty2 = (max.y - origin.y) * invDir.y;
+            tNear = std::max(tNear, std::min(ty1, ty2));
+            tFar = std::min(tFar, std::max(ty1, ty2));
+            float tz1 = (min.z - origin.z) * invDir.z;
+            float tz2 = (max.z - origin.z) * invDir.z;
+            tNear = std::max(tNear, std::min(tz1, tz2));
+            tFar = std::min(tFar, std::max(tz1, tz2));
+            tEntry = std::max(tNear, 0.0f);
+            return tFar >= tEntry && tNear <= tMax;
+        }
+
+        /**
+         * @brief Slab test against every ray of a packet
+         *
+         * @param packet The rays, with their inverse directions
+         * @param tMax Upper bound of the interval of each ray
+         * @param mask Lanes to test
+         * @return uint32_t Lanes of mask whose ray overlaps the box within [0, tMax]
+         */
+        uint32_t intersect(const RayPacket& packet, const FloatV& tMax, uint32_t mask) const
+        {
+            FloatV tx1 = (FloatV::broadcast(min.x) - packet.ox) * packet.invDx;
+            FloatV tx2 = (FloatV::broadcast(max.x) - packet.ox) * packet.invDx;
+            FloatV tNear = vmin(tx1, tx2);
+            FloatV tFar = vmax(tx1, tx2);
+            FloatV ty1 = (FloatV::broadcast(min.y) - packet.oy) * packet.invDy;
+            FloatV ty2 = (FloatV::broadcast(max.y) - packet.oy) * packet.invDy;
+            tNear = vmax(tNear, vmin(ty1, ty2));
+            tFar = vmin(tFar, vmax(ty1, ty2));
+            FloatV tz1 = (FloatV::broadcast(min.z) - packet.oz) * packet.invDz;
+            FloatV tz2 = (FloatV::broadcast(max.z) - packet.oz) * packet.invDz;
+            tNear = vmax(tNear, vmin(tz1, tz2));
+            tFar = vmin(tFar, vmax(tz1, tz2));
+            FloatV tEntry = vmax(tNear, FloatV::broadcast(0.0f));
+            return movemask((tFar >= tEntry) & (tNear <= tMax)) & mask;
+        }
+
+        /**
+         * @brief Clips a ray interval to the box
+         *
+         * @param origin Origin of the ray
+         * @param invDir Component-wise inverse of the ray direction
+         * @param tNear Lower bound of the interval, raised to the entry distance
+         * @param tFar Upper bound of the interval, lowered to the exit distance
+         * @return true If the clipped interval is not empty
+         */
+        bool clip(const Vector3& origin, const Vector3& invDir, float& tNear, float& tFar) const
+        {
+            float tx1 = (min.x - origin.x) * invDir.x;
+            float tx2 = (max.x - origin.x) * invDir.x;
+            tNear = std::max(tNear, std::min(tx1, tx2));
+            tFar = std::min(tFar, std::max(tx1, tx2));
+            float ty1 = (min.y - origin.y) * invDir.y;
+            float ty2 = (max.y - origin.y) * invDir.y;
+            tNear = std::max(tNear, std::min(ty1, ty2));
+            tFar = std::min(tFar, std::max(ty1, ty2));
+            float tz1 = (min.z - origin.z) * invDir.z;
+            float tz2 = (max.z - origin.z) * invDir.z;
+            tNear = std::max(tNear, std::min(tz1, tz2));
+            tFar = std::min(tFar, std::max(tz1, tz2));
+            return tNear <= tFar;
+        }
+
+        /**
+         * @brief Slab test against a ray
+         *
+         * @param ray The ray to test
+         * @param tMax Upper bound of the ray interval
+         * @return true If the ray overlaps the box within [0, tMax]
+         */
+        bool intersect(const Ray& ray, float tMax) const
+        {
+            const Vector3& d = ray.getDirection();
+            float tEntry;
+            return intersect(ray.getOrigin(), Vector3(1.0f / d.x, 1.0f / d.y, 1.0f / d.z), tMax, tEntry);
+        }
+    };
+}
@@ -0,0 +1,37 @@
+/**
+ * @file HitRecord.hpp
+ * @brief Description of a ray-surface intersection
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the HitRecord structure filled by intersection queries.
+ * It lives on the caller's stack, so any number of threads can trace rays
+ * against the same scene without sharing any mutable state.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "Utils/Vector3.hpp"
+
+namespace Raytracer {
+    class IPrimitive;
+
+    /**
+     * @struct HitRecord
+     * @brief Everything the renderer needs to know about the closest hit of a ray
+     *
+     * The primitive pointer does not own anything: the scene outlives every
+     * record built while rendering it.
+     */
+    struct HitRecord {
+        float t = 0.0f;                      ///< Distance from the ray origin to the hit
+        Vector3 point;                       ///< World-space position of the hit
+        Vector3 normal;                      ///< Surface normal at the hit
+        const IPrimitive* primitive = nullptr; ///< Leaf primitive that was hit
+        float u = 0.0f;                      ///< First surface coordinate (barycentric for triangles)
+        float v = 0.0f;                      ///< Second surface coordinate (barycentric for triangles)
+        bool hasUV = false;                  ///< Whether u and v were filled by the primitive
+        uint16_t material = 0;               ///< Material index, set by CompiledScene queries only
+    };
+}
@@ -23,6 +23,13 @@ namespace Raytracer {
      */
     class Ray {
     public:
+        /**
+         * @brief Construct a ray from the origin along +Z
+         *
+         * Only used to fill arrays of rays (packets) before assigning them.
+         */
+        Ray();
+
         /**
          * @brief Construct a new Ray object
          *
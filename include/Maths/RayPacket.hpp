@@ -0,0 +1,149 @@
+/**
+ * @file RayPacket.hpp
+ * @brief Packets of PACKET_SIZE rays traced together
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the RayPacket structure, which stores up to eight rays
+ * both as Ray objects (for the single-ray fallback) and as one FloatV per
+ * component (for the SIMD code), and the PacketHit structure which collects
+ * the closest hit of every ray of a packet.
+ *
+ * Every packet query takes a lane mask: bit i set means ray i takes part in
+ * the query. Lanes outside the mask are never read nor written.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include "Maths/HitRecord.hpp"
+#include "Maths/Ray.hpp"
+#include "Maths/Simd.hpp"
+#include "Utils/Vector3.hpp"
+
+namespace Raytracer {
+    /**
+     * @struct RayPacket
+     * @brief PACKET_SIZE rays in both array-of-structures and SIMD layouts
+     */
+    struct RayPacket {
+        static constexpr int MIN_COHERENT_RAYS = 3; ///< Fewer active rays are traced one by one
+
+        Ray rays[PACKET_SIZE]; ///< The rays themselves
+        FloatV ox, oy, oz;     ///< Origins, one lane per ray
+        FloatV dx, dy, dz;     ///< Directions, one lane per ray
+        FloatV invDx, invDy, invDz; ///< Component-wise inverse directions, for slab tests
+        uint8_t octants[PACKET_SIZE]; ///< Signs of the direction components of each ray (3 bits)
+
+        /**
+         * @brief Builds a packet from an array of rays
+         *
+         * @param source The rays
+         * @param count Number of rays, at most PACKET_SIZE; the missing lanes get a default ray
+         */
+        RayPacket(const Ray* source, int count);
+
+        /**
+         * @brief Tells whether the rays of a mask are worth tracing as a packet
+         *
+         * A packet is coherent when enough of its rays are active and they all
+         * point into the same octant, so that they cross the hierarchy in the
+         * same order. Incoherent packets fall back to single rays.
+         *
+         * @param mask Active lanes
+         * @return true If the lanes should be traced together
+         */
+        bool isCoherent(uint32_t mask) const;
+
+        /**
+         * @brief Gets the mask of the first count lanes
+         *
+         * @param count Number of active rays
+         * @return uint32_t Lane mask
+         */
+        static uint32_t maskOf(int count)
+        {
+            return count >= PACKET_SIZE ? PACKET_FULL_MASK : (1u << count) - 1u;
+        }
+    };
+
+    /**
+     * @struct PacketHit
+     * @brief Closest hit found so far for every ray of a packet
+     *
+     * A lane with no hit keeps t = +infinity and a null primitive.
+     */
+    struct PacketHit {
+        float t[PACKET_SIZE];            ///< Distance to the closest hit of each ray
+        HitRecord records[PACKET_SIZE];  ///< Description of the closest hit of each ray
+
+        PacketHit()
+        {
+            for (float& distance : t)
+                distance = std::numeric_limits<float>::infinity();
+        }
+
+        /**
+         * @brief Keeps the candidate distances that beat the current hits
+         *
+         * A candidate is kept when epsilon < t < current t. The caller
+         * must then fill records[i] for every lane of the returned mask.
+         *
+         * @param candidate Candidate distances, +infinity (or NaN) on a miss
+         * @param mask Lanes to consider
+         * @param epsilon Smallest accepted distance
+         * @return uint32_t Lanes whose hit was replaced
+         */
+        uint32_t closer(const FloatV& candidate, uint32_t mask, float epsilon)
+        {
+            FloatV current = FloatV::load(t);
+            FloatV better = (candidate > FloatV::broadcast(epsilon)) & (candidate < current) & laneMask(mask);
+            select(better, candidate, current).store(t);
+            return movemask(better);
+        }
+    };
+
+    /**
+     * @brief Möller–Trumbore test of a packet against one triangle
+     *
+     * Same operations, in the same order, as the single-ray version in Triangle
+     * and TriangleMesh: the distances are equal to the last bit (see Simd.hpp).
+     *
+     * @param packet The rays
+     * @param a First vertex of the triangle
+     * @param edge1 Second vertex minus the first
+     * @param edge2 Third vertex minus the first
+     * @param u Output first barycentric coordinate
+     * @param v Output second barycentric coordinate
+     * @return FloatV Distance of each ray to the triangle, +infinity on a miss
+     */
+    inline FloatV intersectTrianglePacket(const RayPacket& packet, const Vector3& a, const Vector3& edge1,
+        const Vector3& edge2, FloatV& u, FloatV& v)
+    {
+        const FloatV epsilon = FloatV::broadcast(1e-6f);
+        const FloatV zero = FloatV::broadcast(0.0f);
+        const FloatV one = FloatV::broadcast(1.0f);
+        const FloatV e1x = FloatV::broadcast(edge1.x), e1y = FloatV::broadcast(edge1.y), e1z = FloatV::broadcast(edge1.z);
+        const FloatV e2x = FloatV::broadcast(edge2.x), e2y = FloatV::broadcast(edge2.y), e2z = FloatV::broadcast(edge2.z);
+
+        // h = dir x edge2
+        FloatV hx = packet.dy * e2z - packet.dz * e2y;
+        FloatV hy = packet.dz * e2x - packet.dx * e2z;
+        FloatV hz = packet.dx * e2y - packet.dy * e2x;
+        FloatV det = e1x * hx + e1y * hy + e1z * hz;
+        FloatV f = one / det;
+        FloatV sx = packet.ox - FloatV::broadcast(a.x);
+        FloatV sy = packet.oy - FloatV::broadcast(a.y);
+        FloatV sz = packet.oz - FloatV::broadcast(a.z);
+        u = f * (sx * hx + sy * hy + sz * hz);
+        // q = s x edge1
+        FloatV qx = sy * e1z - sz * e1y;
+        FloatV qy = sz * e1x - sx * e1z;
+        FloatV qz = sx * e1y - sy * e1x;
+        v = f * (packet.dx * qx + packet.dy * qy + packet.dz * qz);
+        FloatV t = f * (e2x * qx + e2y * qy + e2z * qz);
+        FloatV valid = (vabs(det) >= epsilon) & (u >= zero) & (u <= one) & (v >= zero) & (u + v <= one) & (t > epsilon);
+        return select(valid, t, FloatV::broadcast(std::numeric_limits<float>::infinity()));
+    }
+}
@@ -0,0 +1,224 @@
+/**
+ * @file Simd.hpp
+ * @brief Eight-lane float vector used by the ray packet code
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the FloatV type, a vector of PACKET_SIZE floats with the
+ * handful of operations needed to intersect eight rays at once. The backend is
+ * chosen at compile time:
+ * - AVX2: one 256-bit register
+ * - SSE2: two 128-bit registers
+ * - otherwise: a plain array, left to the compiler's auto-vectorizer
+ *
+ * Comparisons return masks stored in a FloatV (all bits set in true lanes);
+ * movemask() turns them into one bit per lane. vmin() and vmax() treat NaN
+ * lanes like std::min() and std::max() (the first argument is returned), so
+ * packet slab tests agree with the single-ray ones.
+ *
+ * Packet kernels repeat the operations of the single-ray code in the same
+ * order, so each lane gives the same bits as the ray traced alone. This only
+ * holds without floating-point contraction: both CMake projects build with
+ * -ffp-contract=off, otherwise the compiler fuses multiplies and adds into
+ * FMAs differently in the scalar and vector code.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define RAYTRACER_SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define RAYTRACER_SIMD_SSE 1
+#else
+    #include <cmath>
+    #include <cstring>
+#endif
+
+namespace Raytracer {
+    constexpr int PACKET_SIZE = 8;                 ///< Number of rays in a packet
+    constexpr uint32_t PACKET_FULL_MASK = 0xFFu;   ///< Mask with every lane active
+
+    /**
+     * @struct FloatV
+     * @brief PACKET_SIZE floats processed together
+     */
+    struct FloatV {
+#if defined(RAYTRACER_SIMD_AVX2)
+        __m256 v;
+
+        FloatV() = default;
+        FloatV(__m256 value) : v(value) {}
+
+        static FloatV broadcast(float value) { return _mm256_set1_ps(value); }
+        static FloatV load(const float* data) { return _mm256_loadu_ps(data); }
+        void store(float* data) const { _mm256_storeu_ps(data, v); }
+#elif defined(RAYTRACER_SIMD_SSE)
+        __m128 lo;
+        __m128 hi;
+
+        FloatV() = default;
+        FloatV(__m128 low, __m128 high) : lo(low), hi(high) {}
+
+        static FloatV broadcast(float value) { return FloatV(_mm_set1_ps(value), _mm_set1_ps(value)); }
+        static FloatV load(const float* data) { return FloatV(_mm_loadu_ps(data), _mm_loadu_ps(data + 4)); }
+        void store(float* data) const { _mm_storeu_ps(data, lo); _mm_storeu_ps(data + 4, hi); }
+#else
+        float f[PACKET_SIZE];
+
+        static FloatV broadcast(float value)
+        {
+            FloatV r;
+            for (int i = 0; i < PACKET_SIZE; ++i) r.f[i] = value;
+            return r;
+        }
+        static FloatV load(const float* data)
+        {
+            FloatV r;
+            for (int i = 0; i < PACKET_SIZE; ++i) r.f[i] = data[i];
+            return r;
+        }
+        void store(float* data) const
+        {
+            for (int i = 0; i < PACKET_SIZE; ++i) data[i] = f[i];
+        }
+#endif
+    };
+
+#if defined(RAYTRACER_SIMD_AVX2)
+    inline FloatV operator+(FloatV a, FloatV b) { return _mm256_add_ps(a.v, b.v); }
+    inline FloatV operator-(FloatV a, FloatV b) { return _mm256_sub_ps(a.v, b.v); }
+    inline FloatV operator*(FloatV a, FloatV b) { return _mm256_mul_ps(a.v, b.v); }
+    inline FloatV operator/(FloatV a, FloatV b) { return _mm256_div_ps(a.v, b.v); }
+    inline FloatV vmin(FloatV a, FloatV b) { return _mm256_min_ps(b.v, a.v); }
+    inline FloatV vmax(FloatV a, FloatV b) { return _mm256_max_ps(b.v, a.v); }
+    inline FloatV vsqrt(FloatV a) { return _mm256_sqrt_ps(a.v); }
+    inline FloatV vabs(FloatV a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v); }
+    inline FloatV operator<(FloatV a, FloatV b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ); }
+    inline FloatV operator<=(FloatV a, FloatV b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ); }
+    inline FloatV operator>(FloatV a, FloatV b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ); }
+    inline FloatV operator>=(FloatV a, FloatV b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ); }
+    inline FloatV operator&(FloatV a, FloatV b) { return _mm256_and_ps(a.v, b.v); }
+    inline FloatV operator|(FloatV a, FloatV b) { return _mm256_or_ps(a.v, b.v); }
+    /// @brief Lanes of a where mask is set, lanes of b elsewhere
+    inline FloatV select(FloatV mask, FloatV a, FloatV b) { return _mm256_blendv_ps(b.v, a.v, mask.v); }
+    /// @brief One bit per lane, set where the mask lane is true
+    inline uint32_t movemask(FloatV mask) { return static_cast<uint32_t>(_mm256_movemask_ps(mask.v)); }
+    /// @brief Mask with the lanes of the given bits set
+    inline FloatV laneMask(uint32_t bits)
+    {
+        const __m256i lanes = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+        __m256i selected = _mm256_and_si256(_mm256_set1_epi32(static_cast<int>(bits)), lanes);
+        return _mm256_castsi256_ps(_mm256_cmpeq_epi32(selected, lanes));
+    }
+#elif defined(RAYTRACER_SIMD_SSE)
+    inline FloatV operator+(FloatV a, FloatV b) { return FloatV(_mm_add_ps(a.lo, b.lo), _mm_add_ps(a.hi, b.hi)); }
+    inline FloatV operator-(FloatV a, FloatV b) { return FloatV(_mm_sub_ps(a.lo, b.lo), _mm_sub_ps(a.hi, b.hi)); }
+    inline FloatV operator*(FloatV a, FloatV b) { return FloatV(_mm_mul_ps(a.lo, b.lo), _mm_mul_ps(a.hi, b.hi)); }
+    inline FloatV operator/(FloatV a, FloatV b) { return FloatV(_mm_div_ps(a.lo, b.lo), _mm_div_ps(a.hi, b.hi)); }
+    inline FloatV vmin(FloatV a, FloatV b) { return FloatV(_mm_min_ps(b.lo, a.lo), _mm_min_ps(b.hi, a.hi)); }
+    inline FloatV vmax(FloatV a, FloatV b) { return FloatV(_mm_max_ps(b.lo, a.lo), _mm_max_ps(b.hi, a.hi)); }
+    inline FloatV vsqrt(FloatV a) { return FloatV(_mm_sqrt_ps(a.lo), _mm_sqrt_ps(a.hi)); }
+    inline FloatV vabs(FloatV a)
+    {
+        const __m128 sign = _mm_set1_ps(-0.0f);
+        return FloatV(_mm_andnot_ps(sign, a.lo), _mm_andnot_ps(sign, a.hi));
+    }
+    inline FloatV operator<(FloatV a, FloatV b) { return FloatV(_mm_cmplt_ps(a.lo, b.lo), _mm_cmplt_ps(a.hi, b.hi)); }
+    inline FloatV operator<=(FloatV a, FloatV b) { return FloatV(_mm_cmple_ps(a.lo, b.lo), _mm_cmple_ps(a.hi, b.hi)); }
+    inline FloatV operator>(FloatV a, FloatV b) { return FloatV(_mm_cmpgt_ps(a.lo, b.lo), _mm_cmpgt_ps(a.hi, b.hi)); }
+    inline FloatV operator>=(FloatV a, FloatV b) { return FloatV(_mm_cmpge_ps(a.lo, b.lo), _mm_cmpge_ps(a.hi, b.hi)); }
+    inline FloatV operator&(FloatV a, FloatV b) { return FloatV(_mm_and_ps(a.lo, b.lo), _mm_and_ps(a.hi, b.hi)); }
+    inline FloatV operator|(FloatV a, FloatV b) { return FloatV(_mm_or_ps(a.lo, b.lo), _mm_or_ps(a.hi, b.hi)); }
+    /// @brief Lanes of a where mask is set, lanes of b elsewhere
+    inline FloatV select(FloatV mask, FloatV a, FloatV b)
+    {
+        return FloatV(_mm_or_ps(_mm_and_ps(mask.lo, a.lo), _mm_andnot_ps(mask.lo, b.lo)),
+                      _mm_or_ps(_mm_and_ps(mask.hi, a.hi), _mm_andnot_ps(mask.hi, b.hi)));
+    }
+    /// @brief One bit per lane, set where the mask lane is true
+    inline uint32_t movemask(FloatV mask)
+    {
+        return static_cast<uint32_t>(_mm_movemask_ps(mask.lo) | (_mm_movemask_ps(mask.hi) << 4));
+    }
+    /// @brief Mask with the lanes of the given bits set
+    inline FloatV laneMask(uint32_t bits)
+    {
+        const __m128i low = _mm_setr_epi32(1, 2, 4, 8);
+        const __m128i high = _mm_setr_epi32(16, 32, 64, 128);
+        __m128i all = _mm_set1_epi32(static_cast<int>(bits));
+        return FloatV(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(all, low), low)),
+                      _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(all, high), high)));
+    }
+#else
+    namespace SimdDetail {
+        template <typename Op>
+        inline FloatV map(FloatV a, FloatV b, Op op)
+        {
+            FloatV r;
+            for (int i = 0; i < PACKET_SIZE; ++i) r.f[i] = op(a.f[i], b.f[i]);
+            return r;
+        }
+
+        inline float fromBool(bool value)
+        {
+            uint32_t bits = value ? 0xFFFFFFFFu : 0u;
+            float f;
+            std::memcpy(&f, &bits, sizeof(f));
+            return f;
+        }
+
+        inline uint32_t bitsOf(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+    }
+
+    inline FloatV operator+(FloatV a, FloatV b) { return SimdDetail::map(a, b, [](float x, float y) { return x + y; }); }
+    inline FloatV operator-(FloatV a, FloatV b) { return SimdDetail::map(a, b, [](float x, float y) { return x - y; }); }
+    inline FloatV operator*(FloatV a, FloatV b) { return SimdDetail::map(a, b, [](float x, float y) { return x * y; }); }
+    inline FloatV operator/(FloatV a, FloatV b) { return SimdDetail::map(a, b, [](float x, float y) { return x / y; }); }
+    inline FloatV vmin(FloatV a, FloatV b) { return SimdDetail::map(a, b, [](float x, float y) { return y < x ? y : x; }); }
+    inline FloatV vmax(FloatV a, FloatV b) { return SimdDetail::map(a, b, [](float x, float y) { return x < y ? y : x; }); }
+    inline FloatV vsqrt(FloatV a) { return SimdDetail::map(a, a, [](float x, float) { return std::sqrt(x); }); }
+    inline FloatV vabs(FloatV a) { return SimdDetail::map(a, a, [](float x, float) { return std::fabs(x); }); }
+    inline FloatV operator<(FloatV a, FloatV b) { return SimdDetail::map(a, b, [](float x, float y) { return SimdDetail::fromBool(x < y); }); }
+    inline FloatV operator<=(FloatV a, FloatV b) { return SimdDetail::map(a, b, [](float x, float y) { return SimdDetail::fromBool(x <= y); }); }
+    inline FloatV operator>(FloatV a, FloatV b) { return SimdDetail::map(a, b, [](float x, float y) { return SimdDetail::fromBool(x > y); }); }
+    inline FloatV operator>=(FloatV a, FloatV b) { return SimdDetail::map(a, b, [](float x, float y) { return SimdDetail::fromBool(x >= y); }); }
+    inline FloatV operator&(FloatV a, FloatV b)
+    {
+        return SimdDetail::map(a, b, [](float x, float y) { return SimdDetail::fromBool(SimdDetail::bitsOf(x) && SimdDetail::bitsOf(y)); });
+    }
+    inline FloatV operator|(FloatV a, FloatV b)
+    {
+        return SimdDetail::map(a, b, [](float x, float y) { return SimdDetail::fromBool(SimdDetail::bitsOf(x) || SimdDetail::bitsOf(y)); });
+    }
+    /// @brief Lanes of a where mask is set, lanes of b elsewhere
+    inline FloatV select(FloatV mask, FloatV a, FloatV b)
+    {
+        FloatV r;
+        for (int i = 0; i < PACKET_SIZE; ++i) r.f[i] = SimdDetail::bitsOf(mask.f[i]) ? a.f[i] : b.f[i];
+        return r;
+    }
+    /// @brief One bit per lane, set where the mask lane is true
+    inline uint32_t movemask(FloatV mask)
+    {
+        uint32_t bits = 0;
+        for (int i = 0; i < PACKET_SIZE; ++i) bits |= (SimdDetail::bitsOf(mask.f[i]) ? 1u : 0u) << i;
+        return bits;
+    }
+    /// @brief Mask with the lanes of the given bits set
+    inline FloatV laneMask(uint32_t bits)
+    {
+        FloatV r;
+        for (int i = 0; i < PACKET_SIZE; ++i) r.f[i] = SimdDetail::fromBool((bits >> i) & 1u);
+        return r;
+    }
+#endif
+}
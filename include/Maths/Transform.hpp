@@ -0,0 +1,165 @@
+/**
+ * @file Transform.hpp
+ * @brief Affine transform between two 3D spaces
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the Transform class, a 3x3 linear part followed by a
+ * translation. Instances keep one to place shared geometry in the scene and
+ * its inverse to bring rays into the space of that geometry.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "Maths/AABB.hpp"
+#include "Maths/Ray.hpp"
+#include "Maths/RayPacket.hpp"
+#include "Utils/Vector3.hpp"
+
+namespace Raytracer {
+    /**
+     * @class Transform
+     * @brief p' = M p + translation, with M stored by rows
+     */
+    class Transform {
+    public:
+      /**
+       * @brief Constructs the identity
+       */
+      Transform();
+
+      /**
+       * @brief Constructs a transform from its matrix rows and translation
+       *
+       * @param row0 First row of the linear part
+       * @param row1 Second row of the linear part
+       * @param row2 Third row of the linear part
+       * @param translation Added after the linear part
+       */
+      Transform(const Vector3& row0, const Vector3& row1, const Vector3& row2, const Vector3& translation);
+
+      /**
+       * @brief Builds the placement used by OBJ entries of a scene file
+       *
+       * Same order as ObjParser: uniform scale, rotations about X, then Y,
+       * then Z, then translation.
+       *
+       * @param scale Uniform scale factor
+       * @param rotation Angles in degrees about X, Y and Z
+       * @param offset Translation
+       * @return Transform The placement
+       */
+      static Transform fromPlacement(float scale, const Vector3& rotation, const Vector3& offset);
+
+      /**
+       * @brief Transforms a point
+       *
+       * @param point The point
+       * @return Vector3 M point + translation
+       */
+      Vector3 applyToPoint(const Vector3& point) const
+      {
+          return Vector3(m_rows[0].dot(point) + m_translation.x, m_rows[1].dot(point) + m_translation.y,
+              m_rows[2].dot(point) + m_translation.z);
+      }
+
+      /**
+       * @brief Transforms a direction, without the translation
+       *
+       * @param vector The direction
+       * @return Vector3 M vector, not normalized
+       */
+      Vector3 applyToVector(const Vector3& vector) const
+      {
+          return Vector3(m_rows[0].dot(vector), m_rows[1].dot(vector), m_rows[2].dot(vector));
+      }
+
+      /**
+       * @brief Multiplies a vector by the transpose of the linear part
+       *
+       * Applied by the inverse of a transform, turns normals of the source
+       * space into normals of the destination space.
+       *
+       * @param vector The vector
+       * @return Vector3 M^T vector, not normalized
+       */
+      Vector3 applyTransposed(const Vector3& vector) const
+      {
+          return m_rows[0] * vector.x + m_rows[1] * vector.y + m_rows[2] * vector.z;
+      }
+
+      /**
+       * @brief Transforms a ray
+       *
+       * The direction is normalized again, so distances along the new ray
+       * are the old ones multiplied by scale.
+       *
+       * @param ray The ray
+       * @param scale Output length of the transformed direction
+       * @return Ray The transformed ray
+       */
+      Ray applyToRay(const Ray& ray, float& scale) const
+      {
+          Vector3 direction = applyToVector(ray.getDirection());
+          scale = direction.length();
+          return Ray(applyToPoint(ray.getOrigin()), direction);
+      }
+
+      /**
+       * @brief Transforms the active rays of a packet
+       *
+       * An affine map keeps neighboring rays neighbors: a coherent packet
+       * stays coherent.
+       *
+       * @param packet The rays
+       * @param mask Lanes to transform, the others are left at their default
+       * @param scale Output length of each transformed direction (applyToRay())
+       * @return RayPacket The transformed rays
+       */
+      RayPacket applyToPacket(const RayPacket& packet, uint32_t mask, float* scale) const;
+
+      /**
+       * @brief Gets the box enclosing a transformed box
+       *
+       * @param box The box
+       * @return AABB Bounds of its 8 transformed corners, empty if box is empty
+       */
+      AABB applyToBox(const AABB& box) const;
+
+      /**
+       * @brief Composes two transforms
+       *
+       * @param other Transform applied first
+       * @return Transform this after other
+       */
+      Transform operator*(const Transform& other) const;
+
+      /**
+       * @brief Gets the inverse transform
+       *
+       * @return Transform The transform undoing this one
+       * @throws GlobalException If the linear part is singular
+       */
+      Transform inverse() const;
+
+      /**
+       * @brief Gets a row of the linear part
+       *
+       * @param index Row, from 0 to 2
+       * @return const Vector3& The row
+       */
+      const Vector3& getRow(int index) const;
+
+      /**
+       * @brief Gets the translation
+       *
+       * @return const Vector3& The translation
+       */
+      const Vector3& getTranslation() const;
+
+    private:
+      Vector3 m_rows[3];     ///< Linear part, by rows
+      Vector3 m_translation; ///< Added after the linear part
+  };
+}
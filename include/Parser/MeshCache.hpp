@@ -0,0 +1,170 @@
+/**
+ * @file MeshCache.hpp
+ * @brief Binary cache of parsed OBJ meshes
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the MeshCache class which stores the result of parsing and
+ * transforming an OBJ file (vertex buffer, index buffer and the mesh BVH) in a
+ * compact binary file. Later runs with the same file content and the same
+ * scale/offset/rotation map that file instead of parsing the OBJ text and
+ * building the hierarchy again. A long-running process can also reuse the
+ * meshes still in memory, keyed by path, modification time and transform.
+ *
+ * Cache file layout (native endianness, every array 16-byte aligned):
+ * - Header (magic, version, key, element counts)
+ * - Vertex array (3 floats per vertex)
+ * - Index array (3 uint32 per triangle)
+ * - BVH node array, then BVH leaf index array (both optional)
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include "Material/Material.hpp"
+#include "Primitives/TriangleMesh.hpp"
+#include "Utils/Vector3.hpp"
+
+namespace Raytracer {
+    /**
+     * @class MeshCache
+     * @brief Loads OBJ meshes through an on-disk binary cache
+     *
+     * Cache files are named after the OBJ file and the cache key, and live in a
+     * single directory (".meshcache" in the working directory by default). A cache
+     * that cannot be read or written is never an error: the OBJ file is simply
+     * parsed as usual.
+     */
+    class MeshCache {
+    public:
+      static constexpr const char* DEFAULT_DIRECTORY = ".meshcache"; ///< Default cache directory
+
+      /**
+       * @brief Loads an OBJ file as a triangle mesh, using the cache when possible
+       *
+       * @param filename Path to the OBJ file
+       * @param scale Uniform scale factor applied to the model
+       * @param offset Translation applied to the model
+       * @param rotation Rotation in degrees applied to the model
+       * @param material Material shared by the whole mesh
+       * @return std::shared_ptr<TriangleMesh> The mesh, possibly without any triangle
+       * @throws GlobalException If the OBJ file cannot be read
+       */
+      static std::shared_ptr<TriangleMesh> loadObj(const std::string& filename, float scale, const Vector3& offset, const Vector3& rotation, const Material& material);
+
+      /**
+       * @brief Sets the directory where cache files are read and written
+       *
+       * @param directory The cache directory, an empty string disables the cache
+       */
+      static void setDirectory(const std::string& directory);
+
+      /**
+       * @brief Gets the directory where cache files are read and written
+       *
+       * @return const std::string& The cache directory, empty if the cache is disabled
+       */
+      static const std::string& getDirectory();
+
+      /**
+       * @brief Reuses the meshes still in memory in the next loadObj() calls
+       *
+       * While a mesh returned by loadObj() is alive, loading the same file with
+       * the same transform returns a mesh sharing its MeshData, with the
+       * requested material, as long as the modification time and size of the
+       * file have not changed: the file is neither read nor hashed again and
+       * the geometry stays in memory once. Meshes are not kept alive by this
+       * cache. Disabled by default, since a single render loads each file once.
+       * The memory layer may be used from several threads at once.
+       *
+       * @param enabled true to reuse meshes, false to forget them
+       */
+      static void setMemoryCache(bool enabled);
+
+      /**
+       * @brief Gets the number of meshes that can be reused
+       *
+       * @return size_t Meshes loaded since setMemoryCache(true) and still alive
+       */
+      static size_t getMemoryCount();
+
+      /**
+       * @brief Computes the cache key of a file content and transform
+       *
+       * @param content Bytes of the OBJ file
+       * @param scale Uniform scale factor applied to the model
+       * @param offset Translation applied to the model
+       * @param rotation Rotation in degrees applied to the model
+       * @return uint64_t A 64-bit hash of everything that affects the parsed mesh
+       */
+      static uint64_t computeKey(std::string_view content, float scale, const Vector3& offset, const Vector3& rotation);
+
+    private:
+      /**
+       * @brief Mesh kept in memory, with the state of its file when it was loaded
+       */
+      struct MemoryEntry {
+          std::filesystem::file_time_type time;     ///< Modification time of the OBJ file
+          uintmax_t size;                           ///< Size of the OBJ file
+          std::weak_ptr<const MeshData> data;       ///< Geometry of the loaded mesh, owned by its users
+      };
+
+      static std::string s_directory;                       ///< Current cache directory
+      static bool s_memoryEnabled;                          ///< setMemoryCache() state, guarded by s_memoryMutex
+      static std::map<std::string, MemoryEntry> s_memory;   ///< Meshes by file and transform, guarded by s_memoryMutex
+      static std::mutex s_memoryMutex;                      ///< Guards the memory layer
+
+      /**
+       * @brief Forgets the meshes no longer alive, s_memoryMutex held
+       */
+      static void pruneMemory();
+
+      /**
+       * @brief Loads an OBJ file through the cache file, without the memory layer
+       *
+       * @param filename Path to the OBJ file
+       * @param scale Uniform scale factor applied to the model
+       * @param offset Translation applied to the model
+       * @param rotation Rotation in degrees applied to the model
+       * @param material Material shared by the whole mesh
+       * @return std::shared_ptr<TriangleMesh> The mesh, possibly without any triangle
+       * @throws GlobalException If the OBJ file cannot be read
+       */
+      static std::shared_ptr<TriangleMesh> loadFile(const std::string& filename, float scale, const Vector3& offset, const Vector3& rotation, const Material& material);
+
+      /**
+       * @brief Gets the path of the cache file for an OBJ file and key
+       *
+       * @param filename Path to the OBJ file
+       * @param key Cache key of the file content and transform
+       * @return std::string Path of the cache file
+       */
+      static std::string getCachePath(const std::string& filename, uint64_t key);
+
+      /**
+       * @brief Reads a cache file
+       *
+       * @param path Path of the cache file
+       * @param key Expected cache key
+       * @param material Material of the mesh
+       * @return std::shared_ptr<TriangleMesh> The mesh, nullptr if the file is missing, stale or invalid
+       */
+      static std::shared_ptr<TriangleMesh> read(const std::string& path, uint64_t key, const Material& material);
+
+      /**
+       * @brief Writes a cache file, atomically replacing any previous one
+       *
+       * @param path Path of the cache file
+       * @param key Cache key of the mesh
+       * @param mesh The mesh to store
+       * @return true If the file was written
+       */
+      static bool write(const std::string& path, uint64_t key, const TriangleMesh& mesh);
+  };
+}
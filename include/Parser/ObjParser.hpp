@@ -10,6 +10,8 @@
  * be used in the raytracing engine.
  */
 #pragma once
+#include <cstdint>
+#include <string>
 #include <vector>
 #include "Utils/Vector3.hpp"
 
@@ -28,6 +30,18 @@ namespace Raytracer {
         Vector3 c; /**< Third vertex of the triangle */
     };
 
+    /**
+     * @struct ParsedMesh
+     * @brief Indexed geometry parsed from an OBJ file
+     *
+     * Vertices are stored once and shared by the triangles that use them.
+     * Polygons are fanned into triangles, three indices per triangle.
+     */
+    struct ParsedMesh {
+        std::vector<Vector3> vertices; /**< Transformed vertex positions */
+        std::vector<uint32_t> indices; /**< Three zero-based vertex indices per triangle */
+    };
+
     /**
      * @class ObjParser
      * @brief Parser utility for Wavefront OBJ files
@@ -52,6 +66,21 @@ namespace Raytracer {
          * and returns the resulting triangles.
          */
         static std::vector<ParsedTriangle> loadFromFile(const std::string &filename, float scale = 1.0f, const Vector3 &offset = Vector3(0.0f, 0.0f, 0.0f), const Vector3 &rotation = Vector3(0.0f, 0.0f, 0.0f));
+
+        /**
+         * @brief Load an indexed mesh from an OBJ file with transformation options
+         *
+         * @param filename Path to the OBJ file to be loaded
+         * @param scale Uniform scale factor to apply to the model (default: 1.0)
+         * @param offset Translation vector to apply to the model (default: origin)
+         * @param rotation Rotation vector in degrees for X, Y, and Z axes (default: no rotation)
+         * @return ParsedMesh Shared vertex buffer and triangle indices, in file order
+         *
+         * Same parsing as loadFromFile(), without duplicating the vertices of
+         * every triangle. The file is memory-mapped and scanned in place; large
+         * files are split at line boundaries and parsed on several threads.
+         */
+        static ParsedMesh loadMesh(const std::string &filename, float scale = 1.0f, const Vector3 &offset = Vector3(0.0f, 0.0f, 0.0f), const Vector3 &rotation = Vector3(0.0f, 0.0f, 0.0f));
     };
 
 }
\ No newline at end of file
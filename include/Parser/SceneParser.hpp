@@ -13,7 +13,9 @@
 #pragma once
 
 #include <libconfig.h++>
+#include <memory>
 #include <string>
+#include <vector>
 #include "Core/Scene.hpp"
 #include "Utils/Vector3.hpp"
 
@@ -43,10 +45,22 @@ namespace Raytracer {
          */
         bool parse();
 
+        /**
+         * @brief Get the files read by parse()
+         *
+         * @return const std::vector<std::string>& The scene file, then every OBJ file it loads
+         */
+        const std::vector<std::string> &getFiles() const;
+
     private:
       bool parseCamera(const libconfig::Setting &root);
       bool parseLights(const libconfig::Setting &root);
       bool parsePrimitives(const libconfig::Setting &root);
+      void parseGroups(const libconfig::Setting &root);
+      void parseShapes(const libconfig::Setting &prims, std::vector<std::shared_ptr<IPrimitive>> &shapes);
+      void parsePlacements(const libconfig::Setting &prims);
+      size_t findGroup(const libconfig::Setting &setting, const std::string &what);
+      float parseNumber(const libconfig::Setting &setting, const char *name, float fallback);
       void parseSpheres(const libconfig::Setting &prims);
       void parsePlanes(const libconfig::Setting &prims);
       Vector3 parseVector3(const libconfig::Setting &setting);
@@ -56,5 +70,6 @@ namespace Raytracer {
       std::string m_filename;
       libconfig::Config m_cfg;
       Scene &m_scene;
+      std::vector<std::string> m_files;
   };
 }  // namespace Raytracer
@@ -18,8 +18,9 @@ namespace Raytracer {
    * 
    * This class allows grouping multiple primitives and treating them as a single entity.
    * It implements the Composite design pattern, enabling hierarchical organization of
-   * scene objects. When a ray intersects with a composite, it tests intersection with
-   * all contained primitives and returns the closest hit.
+   * scene objects. When a ray intersects with a composite, it tests every contained
+   * primitive and returns the closest hit. Rendering never walks a composite: the
+   * CompiledScene flattens its leaves into the scene tables and BVH.
    */
   class CompositePrimitive : public IPrimitive {
     public:
@@ -50,7 +51,7 @@ namespace Raytracer {
        * @param primitive Shared pointer to a primitive to add
        */
       void addPrimitive(std::shared_ptr<IPrimitive> primitive);
-      
+
       /**
        * @brief Tests if a ray intersects with any primitive in this composite
        * 
@@ -60,11 +61,61 @@ namespace Raytracer {
        * @return false If no intersection found
        */
       bool intersect(const Ray& ray, float& t) const override;
+
+      /**
+       * @brief Finds the closest child hit by a ray and describes the hit
+       * 
+       * The record points to the leaf primitive that was hit (nested composites
+       * are resolved), so the normal and material never depend on the composite.
+       * Nothing is stored in the composite: it can be queried concurrently from
+       * several rendering threads.
+       * 
+       * @param ray The ray to test for intersection
+       * @param hit Output record describing the closest intersection if found
+       * @return true If the ray intersects with any primitive
+       * @return false If no intersection found
+       */
+      bool intersect(const Ray& ray, HitRecord& hit) const override;
+
+      /**
+       * @brief Tells whether any child is hit before a distance
+       * 
+       * Returns as soon as one child reports a hit, without looking for the
+       * closest one.
+       * 
+       * @param ray The ray to test
+       * @param tMax Upper bound of the segment
+       * @return true If a child is hit with OCCLUSION_EPSILON < t < tMax
+       */
+      bool occludes(const Ray& ray, float tMax) const override;
+
+      /**
+       * @brief Intersects the rays of a packet with this composite at once
+       *
+       * A coherent packet is handed to every child; an incoherent one is traced
+       * ray by ray.
+       *
+       * @param packet The rays
+       * @param mask Lanes to trace
+       * @param hits Closest hits found so far, updated in place
+       */
+      void intersectPacket(const RayPacket& packet, uint32_t mask, PacketHit& hits) const override;
+
+      /**
+       * @brief Tells which rays of a packet are blocked by this composite
+       *
+       * @param packet The rays
+       * @param mask Lanes to test
+       * @param tMax Upper bound of the segment of each lane
+       * @return uint32_t Lanes of mask hitting the composite with OCCLUSION_EPSILON < t < tMax
+       */
+      uint32_t occludesPacket(const RayPacket& packet, uint32_t mask, const float* tMax) const override;
       
       /**
        * @brief Gets the surface normal at a point
        * 
-       * For a composite, returns the normal of the last primitive that was hit
+       * A composite has no surface of its own: returns (0, 1, 0). Use
+       * intersect(const Ray&, HitRecord&) to get the normal of the primitive hit.
        * 
        * @param point The point on the surface to calculate the normal at
        * @return Vector3 The surface normal vector
@@ -74,7 +125,7 @@ namespace Raytracer {
       /**
        * @brief Gets the color of the primitive
        * 
-       * For a composite, returns the color of the last primitive that was hit
+       * For a composite, returns the color of its own material
        * 
        * @return Color The color of the primitive
        */
@@ -83,8 +134,8 @@ namespace Raytracer {
       /**
        * @brief Gets the material of the primitive
        * 
-       * For a composite, returns the material of the last primitive that was hit,
-       * or its own material if no primitive was hit yet
+       * For a composite, returns its own material. The material of the primitive
+       * actually hit is reached through HitRecord::primitive.
        * 
        * @return const Material& Reference to the material
        */
@@ -98,6 +149,20 @@ namespace Raytracer {
        * @return Vector3 The center point
        */
       Vector3 getCenter() const override;
+
+      /**
+       * @brief Tells whether every child of the composite is bounded
+       * 
+       * @return true If the composite is non-empty and only holds bounded primitives
+       */
+      bool isBounded() const override;
+
+      /**
+       * @brief Gets the union of the bounding boxes of the children
+       * 
+       * @return AABB The bounds of the composite
+       */
+      AABB getBoundingBox() const override;
       
       /**
        * @brief Gets the number of primitives in this composite
@@ -120,11 +185,5 @@ namespace Raytracer {
       
       /** @brief Material for this composite */
       Material m_material;
-      
-      /** @brief Pointer to the last hit primitive
-       * 
-       * Used to return information about the specific primitive that was hit in a composite
-       */
-      mutable std::shared_ptr<IPrimitive> m_lastHitPrimitive;
   };
 } 
\ No newline at end of file
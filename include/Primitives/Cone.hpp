@@ -25,7 +25,7 @@ namespace Raytracer {
      * radius, height, and orientation. It provides methods for ray-cone intersection 
      * testing and normal vector calculation which are essential for the raytracing process.
      */
-    class Cone : public IPrimitive {
+    class Cone final : public IPrimitive {
     public:
       /**
        * @brief Constructs a cone primitive
@@ -87,6 +87,20 @@ namespace Raytracer {
        */
       const Material& getMaterial() const override;
 
+      /**
+       * @brief Tells whether the cone has a finite height
+       * 
+       * @return true unless the cone is infinite
+       */
+      bool isBounded() const override;
+
+      /**
+       * @brief Gets the tight box around the rotated cone
+       * 
+       * @return AABB The union of the box of the base and of the top of the cone
+       */
+      AABB getBoundingBox() const override;
+
       /**
        * @brief Gets the base center of the cone
        * 
@@ -25,7 +25,7 @@ namespace Raytracer {
      * radius, height, and orientation. It provides methods for ray-cylinder intersection 
      * testing and normal vector calculation which are essential for the raytracing process.
      */
-    class Cylinder : public IPrimitive {
+    class Cylinder final : public IPrimitive {
     public:
       /**
        * @brief Constructs a cylinder primitive
@@ -87,6 +87,20 @@ namespace Raytracer {
        */
       const Material& getMaterial() const override;
 
+      /**
+       * @brief Tells whether the cylinder has a finite height
+       * 
+       * @return true unless the height is infinite
+       */
+      bool isBounded() const override;
+
+      /**
+       * @brief Gets the tight box around the rotated cylinder
+       * 
+       * @return AABB The union of the boxes of both end caps
+       */
+      AABB getBoundingBox() const override;
+
       /**
        * @brief Gets the base center of the cylinder
        * 
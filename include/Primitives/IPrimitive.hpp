@@ -13,7 +13,10 @@
 #pragma once
 
 #include "Material/Material.hpp"
+#include "Maths/AABB.hpp"
+#include "Maths/HitRecord.hpp"
 #include "Maths/Ray.hpp"
+#include "Maths/RayPacket.hpp"
 #include "Utils/Color.hpp"
 #include "Utils/Vector3.hpp"
 
@@ -32,6 +35,8 @@ namespace Raytracer {
       /**
        * @brief Virtual destructor for proper polymorphic cleanup
        */
+      static constexpr float OCCLUSION_EPSILON = 0.001f; ///< Closer hits are self-intersections
+
       virtual ~IPrimitive() = default;
       
       /**
@@ -46,6 +51,92 @@ namespace Raytracer {
        * @return false If no intersection is found
        */
       virtual bool intersect(const Ray& ray, float& t) const = 0;
+
+      /**
+       * @brief Tests if a ray intersects with this primitive and describes the hit
+       * 
+       * The default implementation relies on intersect(const Ray&, float&) and
+       * getNormal(). Primitives that get surface coordinates for free during the
+       * intersection (triangles) override it to fill them as well.
+       * 
+       * @param ray The ray to test for intersection
+       * @param hit Output record describing the intersection if found
+       * @return true If the ray intersects with the primitive
+       * @return false If no intersection is found
+       */
+      virtual bool intersect(const Ray& ray, HitRecord& hit) const
+      {
+          float t;
+          if (!intersect(ray, t))
+              return false;
+          hit.t = t;
+          hit.point = ray.at(t);
+          hit.normal = getNormal(hit.point);
+          hit.primitive = this;
+          hit.hasUV = false;
+          return true;
+      }
+
+      /**
+       * @brief Tests if anything of this primitive lies on a ray segment
+       * 
+       * Any-hit query used for shadow rays: unlike intersect(), it may stop at the
+       * first hit found instead of looking for the closest one. The default
+       * implementation relies on intersect(const Ray&, float&); primitives made of
+       * many parts (composites, meshes) override it to return early.
+       * 
+       * @param ray The ray to test
+       * @param tMax Upper bound of the segment, hits at tMax or beyond are ignored
+       * @return true If there is a hit with OCCLUSION_EPSILON < t < tMax
+       */
+      virtual bool occludes(const Ray& ray, float tMax) const
+      {
+          float t;
+          return intersect(ray, t) && t > OCCLUSION_EPSILON && t < tMax;
+      }
+
+      /**
+       * @brief Intersects the rays of a packet and keeps the closer hits
+       *
+       * For every lane of mask, a hit with OCCLUSION_EPSILON < t < hits.t[i]
+       * replaces the current one. The default implementation traces the rays
+       * one by one; simple shapes and hierarchies override it with SIMD code.
+       *
+       * @param packet The rays
+       * @param mask Lanes to trace
+       * @param hits Closest hits found so far, updated in place
+       */
+      virtual void intersectPacket(const RayPacket& packet, uint32_t mask, PacketHit& hits) const
+      {
+          for (int i = 0; i < PACKET_SIZE; ++i) {
+              HitRecord record;
+              if ((mask & (1u << i)) && intersect(packet.rays[i], record)
+                  && record.t > OCCLUSION_EPSILON && record.t < hits.t[i]) {
+                  hits.t[i] = record.t;
+                  hits.records[i] = record;
+              }
+          }
+      }
+
+      /**
+       * @brief Tells which rays of a packet are blocked by this primitive
+       *
+       * The default implementation calls occludes() for every lane.
+       *
+       * @param packet The rays
+       * @param mask Lanes to test
+       * @param tMax Upper bound of the segment of each lane
+       * @return uint32_t Lanes of mask hitting the primitive with OCCLUSION_EPSILON < t < tMax
+       */
+      virtual uint32_t occludesPacket(const RayPacket& packet, uint32_t mask, const float* tMax) const
+      {
+          uint32_t occluded = 0;
+          for (int i = 0; i < PACKET_SIZE; ++i) {
+              if ((mask & (1u << i)) && occludes(packet.rays[i], tMax[i]))
+                  occluded |= 1u << i;
+          }
+          return occluded;
+      }
       
       /**
        * @brief Calculates the surface normal at a given point
@@ -88,5 +179,24 @@ namespace Raytracer {
        * @return Vector3 The center point or representative position
        */
       virtual Vector3 getCenter() const = 0;
+
+      /**
+       * @brief Tells whether the primitive fits in a finite bounding box
+       * 
+       * Unbounded primitives (planes, infinite cylinders and cones) cannot be
+       * stored in an acceleration structure and are tested against every ray.
+       * 
+       * @return true If getBoundingBox() returns a finite world-space box
+       */
+      virtual bool isBounded() const = 0;
+
+      /**
+       * @brief Gets the world-space axis-aligned bounding box of the primitive
+       * 
+       * Only meaningful when isBounded() returns true.
+       * 
+       * @return AABB The bounds of the primitive, empty if unbounded
+       */
+      virtual AABB getBoundingBox() const = 0;
   };
 }
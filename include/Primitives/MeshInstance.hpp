@@ -0,0 +1,165 @@
+/**
+ * @file MeshInstance.hpp
+ * @brief Placement of a shared triangle mesh in the scene
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the MeshInstance class which implements the IPrimitive
+ * interface. Many instances may share one TriangleMesh, stored once in its
+ * own space with its own BVH (the bottom level); each instance only adds a
+ * transform and a material. The scene hierarchy over the instances is the top
+ * level: rays reaching an instance are moved into the space of the mesh.
+ */
+
+#pragma once
+
+#include <memory>
+#include "Maths/Transform.hpp"
+#include "Primitives/IPrimitive.hpp"
+#include "Primitives/TriangleMesh.hpp"
+#include "Utils/Color.hpp"
+#include "Utils/Vector3.hpp"
+#include "Material/Material.hpp"
+
+namespace Raytracer {
+    /**
+     * @class MeshInstance
+     * @brief A shared mesh seen through an affine transform, with its own material
+     *
+     * The ray direction is normalized again in the space of the mesh, so hit
+     * distances are scaled back to world units before being compared with
+     * the other primitives. Normals go through the inverse transpose of the
+     * transform.
+     */
+    class MeshInstance final : public IPrimitive {
+    public:
+      /**
+       * @brief Places a mesh
+       *
+       * @param mesh The shared mesh, in its own space
+       * @param transform From the space of the mesh to world space
+       * @param material The material of this instance, replacing the one of the mesh
+       * @throws GlobalException If the transform cannot be inverted
+       */
+      MeshInstance(std::shared_ptr<const TriangleMesh> mesh, const Transform& transform, const Material& material);
+
+      /**
+       * @brief Tests if a ray intersects with the placed mesh
+       *
+       * @param ray The ray to test for intersection
+       * @param t Output parameter that will contain the world-space distance to the closest intersection
+       * @return true If the ray intersects with the mesh
+       */
+      bool intersect(const Ray& ray, float& t) const override;
+
+      /**
+       * @brief Tests if a ray intersects with the placed mesh and describes the closest hit
+       *
+       * The record is in world space and points at this instance; u and v are
+       * the barycentric coordinates in the triangle hit.
+       *
+       * @param ray The ray to test for intersection
+       * @param hit Output record describing the intersection if found
+       * @return true If the ray intersects with the mesh
+       */
+      bool intersect(const Ray& ray, HitRecord& hit) const override;
+
+      /**
+       * @brief Tells whether the placed mesh is hit before a distance
+       *
+       * @param ray The ray to test
+       * @param tMax Upper bound of the segment, in world units
+       * @return true If a triangle is hit before tMax
+       */
+      bool occludes(const Ray& ray, float tMax) const override;
+
+      /**
+       * @brief Intersects the rays of a packet with the placed mesh
+       *
+       * The packet is transformed as a whole, so a coherent packet stays
+       * coherent and walks the mesh BVH once.
+       *
+       * @param packet The rays
+       * @param mask Lanes to trace
+       * @param hits Closest hits found so far, updated in place
+       */
+      void intersectPacket(const RayPacket& packet, uint32_t mask, PacketHit& hits) const override;
+
+      /**
+       * @brief Tells which rays of a packet are blocked by the placed mesh
+       *
+       * @param packet The rays
+       * @param mask Lanes to test
+       * @param tMax Upper bound of the segment of each lane, in world units
+       * @return uint32_t Lanes of mask hitting the mesh before their bound
+       */
+      uint32_t occludesPacket(const RayPacket& packet, uint32_t mask, const float* tMax) const override;
+
+      /**
+       * @brief Gets the surface normal at a point
+       *
+       * Like TriangleMesh, a point alone does not tell which face it lies on:
+       * returns (0, 1, 0). Use intersect(const Ray&, HitRecord&) instead.
+       *
+       * @param point The point on the surface
+       * @return Vector3 The default normal
+       */
+      Vector3 getNormal(const Vector3& point) const override;
+
+      /**
+       * @brief Gets the color of the instance
+       *
+       * @return Color The color derived from the instance's material
+       */
+      Color getColor() const override;
+
+      /**
+       * @brief Gets the material of the instance
+       *
+       * @return const Material& The material of this instance
+       */
+      const Material& getMaterial() const override;
+
+      /**
+       * @brief Gets the center of the world-space bounding box
+       *
+       * @return Vector3 The center point
+       */
+      Vector3 getCenter() const override;
+
+      /**
+       * @brief Tells whether the shared mesh holds at least one triangle
+       *
+       * @return true If the mesh is not empty
+       */
+      bool isBounded() const override;
+
+      /**
+       * @brief Gets the world-space box enclosing the transformed bounds of the mesh
+       *
+       * @return AABB The bounds of the instance
+       */
+      AABB getBoundingBox() const override;
+
+      /**
+       * @brief Gets the shared mesh
+       *
+       * @return const std::shared_ptr<const TriangleMesh>& The mesh, in its own space
+       */
+      const std::shared_ptr<const TriangleMesh>& getMesh() const;
+
+      /**
+       * @brief Gets the transform from the space of the mesh to world space
+       *
+       * @return const Transform& The placement
+       */
+      const Transform& getTransform() const;
+
+    private:
+      std::shared_ptr<const TriangleMesh> m_mesh; ///< Shared mesh and its BVH
+      Transform m_toWorld;                        ///< From the space of the mesh to world space
+      Transform m_toObject;                       ///< Inverse of m_toWorld
+      Material m_material;                        ///< Material of this instance
+      AABB m_bounds;                              ///< World-space bounds
+  };
+}
@@ -24,7 +24,7 @@ namespace Raytracer {
      * vector and distance from the origin. It provides methods for ray-plane intersection
      * testing and normal vector access which are essential for the raytracing process.
      */
-    class Plane : public IPrimitive {
+    class Plane final : public IPrimitive {
     public:
       /**
        * @brief Constructs a plane primitive
@@ -47,6 +47,27 @@ namespace Raytracer {
        * @return false If no intersection is found (ray is parallel to the plane)
        */
       bool intersect(const Ray& ray, float& t) const override;
+
+      /**
+       * @brief Intersects the rays of a packet with this plane at once
+       *
+       * Same formula as intersect(), evaluated for every lane in SIMD registers.
+       *
+       * @param packet The rays
+       * @param mask Lanes to trace
+       * @param hits Closest hits found so far, updated in place
+       */
+      void intersectPacket(const RayPacket& packet, uint32_t mask, PacketHit& hits) const override;
+
+      /**
+       * @brief Tells which rays of a packet are blocked by this plane
+       *
+       * @param packet The rays
+       * @param mask Lanes to test
+       * @param tMax Upper bound of the segment of each lane
+       * @return uint32_t Lanes of mask hitting the plane with OCCLUSION_EPSILON < t < tMax
+       */
+      uint32_t occludesPacket(const RayPacket& packet, uint32_t mask, const float* tMax) const override;
       
       /**
        * @brief Gets the normal vector of the plane
@@ -82,6 +103,48 @@ namespace Raytracer {
        */
       const Material& getMaterial() const override;
 
+      /**
+       * @brief An infinite plane has no bounding box
+       * 
+       * @return false, planes are always tested
+       */
+      bool isBounded() const override;
+
+      /**
+       * @brief Gets the bounds of the plane
+       * 
+       * @return AABB An empty box since the plane is unbounded
+       */
+      AABB getBoundingBox() const override;
+
+      /**
+       * @brief Gets the distance of the plane from the origin
+       *
+       * @return float The distance along the normalized normal
+       */
+      float getDistance() const;
+
+      /**
+       * @brief Ray-plane test shared by the plane and the compiled scene
+       *
+       * @param normal Normalized normal of the plane
+       * @param distance Distance from the origin along the normal
+       * @param ray The ray
+       * @param t Output distance to the plane, may be below the self-intersection epsilon
+       * @return true If the ray crosses the plane ahead of its origin
+       */
+      static bool hitDistance(const Vector3& normal, float distance, const Ray& ray, float& t);
+
+      /**
+       * @brief Same formula as hitDistance(), one SIMD lane per ray
+       *
+       * @param packet The rays
+       * @param normal Normalized normal of the plane
+       * @param distance Distance from the origin along the normal
+       * @return FloatV Distance of each ray to the plane, +infinity on a miss
+       */
+      static FloatV packetDistance(const RayPacket& packet, const Vector3& normal, float distance);
+
     private:
       Vector3 m_normal;   ///< The normal vector of the plane
       float m_distance;   ///< The distance from the origin along the normal
@@ -25,7 +25,7 @@ namespace Raytracer {
      * It provides methods for ray-sphere intersection testing and normal vector calculation
      * which are essential for the raytracing process.
      */
-    class Sphere : public IPrimitive {
+    class Sphere final : public IPrimitive {
     public:
       /**
        * @brief Constructs a sphere primitive
@@ -49,6 +49,27 @@ namespace Raytracer {
        * @return false If no intersection is found
        */
       bool intersect(const Ray& ray, float& t) const override;
+
+      /**
+       * @brief Intersects the rays of a packet with this sphere at once
+       *
+       * Same quadratic as intersect(), evaluated for every lane in SIMD registers.
+       *
+       * @param packet The rays
+       * @param mask Lanes to trace
+       * @param hits Closest hits found so far, updated in place
+       */
+      void intersectPacket(const RayPacket& packet, uint32_t mask, PacketHit& hits) const override;
+
+      /**
+       * @brief Tells which rays of a packet are blocked by this sphere
+       *
+       * @param packet The rays
+       * @param mask Lanes to test
+       * @param tMax Upper bound of the segment of each lane
+       * @return uint32_t Lanes of mask hitting the sphere with OCCLUSION_EPSILON < t < tMax
+       */
+      uint32_t occludesPacket(const RayPacket& packet, uint32_t mask, const float* tMax) const override;
       
       /**
        * @brief Calculates the normal vector at a point on the sphere
@@ -82,6 +103,48 @@ namespace Raytracer {
        */
       const Material& getMaterial() const override;
 
+      /**
+       * @brief A sphere is always bounded
+       * 
+       * @return true
+       */
+      bool isBounded() const override;
+
+      /**
+       * @brief Gets the box enclosing the sphere
+       * 
+       * @return AABB The cube of half-size radius around the center
+       */
+      AABB getBoundingBox() const override;
+
+      /**
+       * @brief Gets the radius of the sphere
+       *
+       * @return float The radius given at construction
+       */
+      float getRadius() const;
+
+      /**
+       * @brief Ray-sphere test shared by the sphere and the compiled scene
+       *
+       * @param center Center of the sphere
+       * @param radius Radius of the sphere
+       * @param ray The ray
+       * @param t Output distance to the nearest intersection beyond 0.001
+       * @return true If the ray hits the sphere
+       */
+      static bool hitDistance(const Vector3& center, float radius, const Ray& ray, float& t);
+
+      /**
+       * @brief Same quadratic as hitDistance(), one SIMD lane per ray
+       *
+       * @param packet The rays
+       * @param center Center of the sphere
+       * @param radius Radius of the sphere
+       * @return FloatV Distance of each ray to the sphere, +infinity on a miss
+       */
+      static FloatV packetDistance(const RayPacket& packet, const Vector3& center, float radius);
+
     private:
       Vector3 m_center;  ///< The center position of the sphere
       float m_radius;    ///< The radius of the sphere
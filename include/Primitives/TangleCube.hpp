@@ -25,7 +25,7 @@ namespace Raytracer {
      * by the equation: x⁴ - 5x² + y⁴ - 5y² + z⁴ - 5z² + 11.8 = 0.
      * This creates a cube-like shape with rounded edges and corners.
      */
-    class TangleCube : public IPrimitive {
+    class TangleCube final : public IPrimitive {
     public:
       /**
        * @brief Constructs a TangleCube primitive
@@ -40,6 +40,9 @@ namespace Raytracer {
        * @brief Tests if a ray intersects with this TangleCube
        * 
        * Uses numerical methods (ray marching) to find intersections with the implicit surface.
+       * The march only covers the part of the ray inside the bounding box, with steps
+       * bounded by a Lipschitz constant of the defining function so that no crossing
+       * is skipped, and the first sign change is refined with a safeguarded Newton.
        * The intersection distance is stored in the parameter t if an intersection is found.
        * 
        * @param ray The ray to test for intersection
@@ -81,6 +84,20 @@ namespace Raytracer {
        */
       const Material& getMaterial() const override;
 
+      /**
+       * @brief A TangleCube is always bounded
+       * 
+       * @return true
+       */
+      bool isBounded() const override;
+
+      /**
+       * @brief Gets the box enclosing the implicit surface
+       * 
+       * @return AABB A cube of half-size TANGLE_EXTENT * size around the center
+       */
+      AABB getBoundingBox() const override;
+
       /**
        * @brief Gets the base center of the TangleCube
        * 
@@ -89,6 +106,18 @@ namespace Raytracer {
       Vector3 getBaseCenter() const;
 
     private:
+      /**
+       * @brief Half-size of the surface in normalized coordinates
+       * 
+       * Along x the surface is farthest when y⁴ - 5y² and z⁴ - 5z² reach their
+       * minimum (-6.25), giving x⁴ - 5x² - 0.7 = 0, i.e. |x| ≈ 2.2664.
+       */
+      static constexpr float TANGLE_EXTENT = 2.27f;
+      static constexpr float TANGLE_EPSILON = 0.001f;  ///< Minimum distance of an intersection
+      static constexpr float TANGLE_MIN_STEP = 1e-3f;  ///< Smallest march step, in normalized units
+      static constexpr int TANGLE_MAX_STEPS = 1000;    ///< Maximum number of march steps
+      static constexpr int TANGLE_REFINE_STEPS = 32;   ///< Maximum number of refinement steps
+
       Vector3 m_center; ///< The center position of the TangleCube
       float m_size;     ///< The size/scale factor of the TangleCube
       Material m_material; ///< The material properties of the TangleCube
@@ -103,6 +132,26 @@ namespace Raytracer {
        */
       float tangle_cube_equation(const Vector3& point) const;
 
+      /**
+       * @brief Evaluates the defining function at a point in normalized coordinates
+       *
+       * @param p The point, relative to the center and divided by the size
+       * @return float The function value (0 means on the surface)
+       */
+      static float tangle_cube_value(const Vector3& p);
+
+      /**
+       * @brief Finds the root of the defining function between two ray parameters
+       *
+       * @param origin Ray origin in normalized coordinates
+       * @param dir Ray direction in normalized coordinates
+       * @param low Parameter on one side of the surface
+       * @param lowValue Function value at low
+       * @param high Parameter on the other side of the surface
+       * @return float The parameter of the intersection
+       */
+      static float refineRoot(const Vector3& origin, const Vector3& dir, float low, float lowValue, float high);
+
       /**
        * @brief Calculates the gradient of the TangleCube function at a given point
        * 
@@ -27,7 +27,7 @@ namespace Raytracer {
      * minor radius (radius of the tube), and orientation. It provides methods for ray-torus 
      * intersection testing and normal vector calculation which are essential for the raytracing process.
      */
-    class Torus : public IPrimitive {
+    class Torus final : public IPrimitive {
     public:
       /**
        * @brief Constructs a torus primitive
@@ -45,7 +45,9 @@ namespace Raytracer {
        * 
        * Calculates if and where a ray intersects with this torus using
        * quartic equation solving. The intersection distance is stored in
-       * the parameter t if an intersection is found.
+       * the parameter t if an intersection is found. Rays that miss the
+       * bounding sphere of radius major + minor are rejected before the
+       * quartic is built.
        * 
        * @param ray The ray to test for intersection
        * @param t Output parameter that will contain the distance to intersection if found
@@ -86,6 +88,20 @@ namespace Raytracer {
        */
       const Material& getMaterial() const override;
 
+      /**
+       * @brief A torus is always bounded
+       * 
+       * @return true
+       */
+      bool isBounded() const override;
+
+      /**
+       * @brief Gets the tight box around the rotated torus
+       * 
+       * @return AABB The box of the central ring grown by the minor radius
+       */
+      AABB getBoundingBox() const override;
+
       /**
        * @brief Gets the base center of the torus (same as center for a torus)
        * 
@@ -23,7 +23,7 @@ namespace Raytracer {
      * It provides methods for ray-triangle intersection testing using the Möller–Trumbore algorithm
      * and normal vector calculation which are essential for the raytracing process.
      */
-    class Triangle : public IPrimitive {
+    class Triangle final : public IPrimitive {
     public:
       /**
        * @brief Constructs a triangle primitive
@@ -48,6 +48,40 @@ namespace Raytracer {
        * @return false If no intersection is found
        */
       bool intersect(const Ray& ray, float& t) const override;
+
+      /**
+       * @brief Tests if a ray intersects with this triangle and describes the hit
+       * 
+       * Same test as above, the barycentric coordinates (u, v) of the hit relative
+       * to the vertices B and C are stored in the record.
+       * 
+       * @param ray The ray to test for intersection
+       * @param hit Output record describing the intersection if found
+       * @return true If the ray intersects with the triangle
+       * @return false If no intersection is found
+       */
+      bool intersect(const Ray& ray, HitRecord& hit) const override;
+
+      /**
+       * @brief Intersects the rays of a packet with this triangle at once
+       *
+       * Same Möller–Trumbore test as intersect(), evaluated for every lane in SIMD registers.
+       *
+       * @param packet The rays
+       * @param mask Lanes to trace
+       * @param hits Closest hits found so far, updated in place
+       */
+      void intersectPacket(const RayPacket& packet, uint32_t mask, PacketHit& hits) const override;
+
+      /**
+       * @brief Tells which rays of a packet are blocked by this triangle
+       *
+       * @param packet The rays
+       * @param mask Lanes to test
+       * @param tMax Upper bound of the segment of each lane
+       * @return uint32_t Lanes of mask hitting the triangle with OCCLUSION_EPSILON < t < tMax
+       */
+      uint32_t occludesPacket(const RayPacket& packet, uint32_t mask, const float* tMax) const override;
       
       /**
        * @brief Calculates the normal vector of the triangle
@@ -83,6 +117,20 @@ namespace Raytracer {
        */
       const Material& getMaterial() const override;
 
+      /**
+       * @brief A triangle is always bounded
+       * 
+       * @return true
+       */
+      bool isBounded() const override;
+
+      /**
+       * @brief Gets the box enclosing the three vertices
+       * 
+       * @return AABB The bounds of the triangle
+       */
+      AABB getBoundingBox() const override;
+
       /**
        * @brief Gets the base center of the triangle (same as center)
        * 
@@ -90,6 +138,29 @@ namespace Raytracer {
        */
       Vector3 getBaseCenter() const;
 
+      /**
+       * @brief Gets a vertex of the triangle
+       *
+       * @param index 0, 1 or 2, in construction order
+       * @return const Vector3& The vertex
+       */
+      const Vector3& getVertex(int index) const;
+
+      /**
+       * @brief Möller–Trumbore test shared by the triangle and the compiled scene
+       *
+       * @param ray The ray
+       * @param a First vertex of the triangle
+       * @param edge1 Second vertex minus the first
+       * @param edge2 Third vertex minus the first
+       * @param t Output distance to the triangle
+       * @param u Output first barycentric coordinate
+       * @param v Output second barycentric coordinate
+       * @return true If the ray hits the triangle beyond 1e-6
+       */
+      static bool hitDistance(const Ray& ray, const Vector3& a, const Vector3& edge1, const Vector3& edge2,
+          float& t, float& u, float& v);
+
     private:
       Vector3 m_a; ///< First vertex of the triangle
       Vector3 m_b; ///< Second vertex of the triangle
@@ -0,0 +1,259 @@
+/**
+ * @file TriangleMesh.hpp
+ * @brief Indexed triangle mesh primitive for the raytracer
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the TriangleMesh class which implements the IPrimitive interface.
+ * It stores a whole model (typically loaded from an OBJ file) as one shared vertex
+ * buffer, a 32-bit index buffer and a single material, instead of one Triangle
+ * object per face. The buffers and their hierarchy live in a MeshData that
+ * meshes with other materials may share.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Acceleration/BVH.hpp"
+#include "Primitives/IPrimitive.hpp"
+#include "Utils/Color.hpp"
+#include "Utils/Vector3.hpp"
+#include "Material/Material.hpp"
+
+namespace Raytracer {
+    /**
+     * @struct MeshData
+     * @brief Geometry of a mesh, never modified once built
+     */
+    struct MeshData {
+        std::vector<Vector3> vertices; ///< Shared vertex buffer
+        std::vector<uint32_t> indices; ///< Three vertex indices per triangle
+        BVH bvh;                       ///< Hierarchy over the triangles
+    };
+
+    /**
+     * @class TriangleMesh
+     * @brief Represents a set of triangles sharing their vertices and material
+     *
+     * Triangle i is made of the vertices indices[3i], indices[3i + 1] and
+     * indices[3i + 2]. The mesh builds its own bounding volume hierarchy over its
+     * faces, so the scene only sees a single bounded primitive. Faces are
+     * intersected with the same Möller–Trumbore test and flat normals as Triangle.
+     */
+    class TriangleMesh final : public IPrimitive {
+    public:
+      /**
+       * @brief Constructs a mesh and builds its hierarchy
+       *
+       * @param vertices Vertex positions in world space
+       * @param indices Three vertex indices per triangle
+       * @param material The material shared by every triangle of the mesh
+       * @throws GlobalException If the index count is not a multiple of 3 or an index is out of range
+       */
+      TriangleMesh(std::vector<Vector3> vertices, std::vector<uint32_t> indices, const Material& material);
+
+      /**
+       * @brief Constructs a mesh around a hierarchy built beforehand
+       *
+       * Used when the mesh comes from the binary cache, to skip the BVH build.
+       *
+       * @param vertices Vertex positions in world space
+       * @param indices Three vertex indices per triangle
+       * @param material The material shared by every triangle of the mesh
+       * @param bvh Hierarchy over the triangles of exactly this index buffer
+       * @throws GlobalException If the index count is not a multiple of 3 or an index is out of range
+       */
+      TriangleMesh(std::vector<Vector3> vertices, std::vector<uint32_t> indices, const Material& material, BVH bvh);
+
+      /**
+       * @brief Constructs a mesh sharing the geometry of another one
+       *
+       * Only the material is copied: the buffers and the hierarchy stay in memory once.
+       *
+       * @param data Geometry checked by the mesh that built it
+       * @param material The material shared by every triangle of the mesh
+       */
+      TriangleMesh(std::shared_ptr<const MeshData> data, const Material& material);
+
+      /**
+       * @brief Tests if a ray intersects with any triangle of the mesh
+       *
+       * @param ray The ray to test for intersection
+       * @param t Output parameter that will contain the distance to the closest intersection
+       * @return true If the ray intersects with the mesh
+       * @return false If no intersection is found
+       */
+      bool intersect(const Ray& ray, float& t) const override;
+
+      /**
+       * @brief Tests if a ray intersects with the mesh and describes the closest hit
+       *
+       * The record holds the flat normal of the triangle hit and its barycentric
+       * coordinates (u, v).
+       *
+       * @param ray The ray to test for intersection
+       * @param hit Output record describing the intersection if found
+       * @return true If the ray intersects with the mesh
+       * @return false If no intersection is found
+       */
+      bool intersect(const Ray& ray, HitRecord& hit) const override;
+
+      /**
+       * @brief Tells whether any triangle of the mesh is hit before a distance
+       *
+       * @param ray The ray to test
+       * @param tMax Upper bound of the segment
+       * @return true If a triangle is hit with OCCLUSION_EPSILON < t < tMax
+       */
+      bool occludes(const Ray& ray, float tMax) const override;
+
+      /**
+       * @brief Intersects the rays of a packet with this mesh at once
+       *
+       * A coherent packet walks the hierarchy once and tests each triangle against all
+       * its active rays together; an incoherent one is traced ray by ray.
+       *
+       * @param packet The rays
+       * @param mask Lanes to trace
+       * @param hits Closest hits found so far, updated in place
+       */
+      void intersectPacket(const RayPacket& packet, uint32_t mask, PacketHit& hits) const override;
+
+      /**
+       * @brief Tells which rays of a packet are blocked by this mesh
+       *
+       * @param packet The rays
+       * @param mask Lanes to test
+       * @param tMax Upper bound of the segment of each lane
+       * @return uint32_t Lanes of mask hitting the mesh with OCCLUSION_EPSILON < t < tMax
+       */
+      uint32_t occludesPacket(const RayPacket& packet, uint32_t mask, const float* tMax) const override;
+
+      /**
+       * @brief Gets the surface normal at a point
+       *
+       * A point alone does not tell which face it lies on: returns (0, 1, 0).
+       * Use intersect(const Ray&, HitRecord&) to get the normal of the face hit.
+       *
+       * @param point The point on the surface
+       * @return Vector3 The default normal
+       */
+      Vector3 getNormal(const Vector3& point) const override;
+
+      /**
+       * @brief Gets the color of the mesh
+       *
+       * @return Color The color derived from the mesh's material
+       */
+      Color getColor() const override;
+
+      /**
+       * @brief Gets the material of the mesh
+       *
+       * @return const Material& Reference to the material shared by every triangle
+       */
+      const Material& getMaterial() const override;
+
+      /**
+       * @brief Gets the center of the bounding box of the mesh
+       *
+       * @return Vector3 The center point
+       */
+      Vector3 getCenter() const override;
+
+      /**
+       * @brief Tells whether the mesh holds at least one triangle
+       *
+       * @return true If the mesh is not empty
+       */
+      bool isBounded() const override;
+
+      /**
+       * @brief Gets the box enclosing every vertex used by the mesh
+       *
+       * @return AABB The bounds of the mesh
+       */
+      AABB getBoundingBox() const override;
+
+      /**
+       * @brief Gets the number of triangles in the mesh
+       *
+       * @return size_t The triangle count
+       */
+      size_t getTriangleCount() const;
+
+      /**
+       * @brief Gets the number of vertices in the mesh
+       *
+       * @return size_t The vertex count
+       */
+      size_t getVertexCount() const;
+
+      /**
+       * @brief Gets the shared vertex buffer
+       *
+       * @return const std::vector<Vector3>& The vertex positions
+       */
+      const std::vector<Vector3>& getVertices() const;
+
+      /**
+       * @brief Gets the index buffer, three indices per triangle
+       *
+       * @return const std::vector<uint32_t>& The indices
+       */
+      const std::vector<uint32_t>& getIndices() const;
+
+      /**
+       * @brief Gets the hierarchy over the triangles
+       *
+       * @return const BVH& The BVH, leaves reference triangle numbers
+       */
+      const BVH& getBVH() const;
+
+      /**
+       * @brief Gets the geometry, to build another mesh over it
+       *
+       * @return const std::shared_ptr<const MeshData>& The buffers and their hierarchy
+       */
+      const std::shared_ptr<const MeshData>& getData() const;
+
+    private:
+      std::shared_ptr<const MeshData> m_data; ///< Buffers and hierarchy, possibly shared
+      Material m_material;                    ///< Material of every triangle
+
+      /**
+       * @brief Gathers the buffers of a mesh, without hierarchy yet
+       *
+       * @param vertices Vertex positions in world space
+       * @param indices Three vertex indices per triangle
+       * @return std::shared_ptr<MeshData> The geometry, to be completed with its BVH
+       * @throws GlobalException If the index count is not a multiple of 3 or an index is out of range
+       */
+      static std::shared_ptr<MeshData> makeData(std::vector<Vector3> vertices, std::vector<uint32_t> indices);
+
+      /**
+       * @brief Intersects one triangle of the mesh
+       *
+       * @param ray The ray to test
+       * @param triangle Index of the triangle
+       * @param t Output distance to the intersection
+       * @param u Output first barycentric coordinate
+       * @param v Output second barycentric coordinate
+       * @return true If the ray hits the triangle
+       */
+      bool intersectTriangle(const Ray& ray, uint32_t triangle, float& t, float& u, float& v) const;
+
+      /**
+       * @brief Finds the closest triangle hit by a ray
+       *
+       * @param ray The ray to test
+       * @param t Output distance to the intersection
+       * @param u Output first barycentric coordinate
+       * @param v Output second barycentric coordinate
+       * @return int64_t Index of the triangle hit, -1 if none
+       */
+      int64_t findClosest(const Ray& ray, float& t, float& u, float& v) const;
+  };
+}
@@ -0,0 +1,92 @@
+/**
+ * @file AdaptiveSampler.hpp
+ * @brief Progressive adaptive antialiasing of a rendered image
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the AdaptiveSampler class. Once every pixel has its
+ * sample through the pixel center, the sampler only spends extra samples where
+ * the image needs them: pixels whose luminance differs from a neighbour's by
+ * more than the noise threshold receive samples in rounds (4, 8, 16, ... per
+ * pixel) until the standard error of their mean luminance falls below the
+ * threshold or the sample budget is reached. Flat regions stay at one sample.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Renderer/CameraRayGenerator.hpp"
+#include "Renderer/Framebuffer.hpp"
+#include "Renderer/Renderer.hpp"
+
+namespace Raytracer {
+    /**
+     * @class AdaptiveSampler
+     * @brief Refines the tiles of a one-sample-per-pixel image
+     *
+     * Sub-pixel positions follow the Halton (2, 3) sequence, sample 0 being
+     * the pixel center already rendered, so the image does not depend on the
+     * tiling or the thread count. Neighbour contrast is measured on a snapshot
+     * of the first pass, never on pixels being refined by other threads.
+     */
+    class AdaptiveSampler {
+    public:
+      static constexpr int FIRST_ROUND = 4; ///< Samples per pixel after the first refinement round
+
+      /**
+       * @brief Takes the luminance snapshot of a fully rendered first pass
+       *
+       * @param renderer The renderer, its image holds one sample per pixel
+       * @param rayGenerator Primary rays of the frame
+       */
+      AdaptiveSampler(const Renderer& renderer, const CameraRayGenerator& rayGenerator);
+
+      /**
+       * @brief Adds samples to the pixels of one tile that need them
+       *
+       * Several tiles may be refined at the same time.
+       *
+       * @param view Pixels of the tile, averaged samples are written back
+       * @return uint64_t Number of samples added
+       */
+      uint64_t refineTile(Framebuffer::TileView& view) const;
+
+      /**
+       * @brief Gets the sub-pixel position of a sample
+       *
+       * @param index Sample index, 0 being the pixel center
+       * @param u Output horizontal offset in the pixel, in [0, 1[
+       * @param v Output vertical offset in the pixel, in [0, 1[
+       */
+      static void getSampleOffset(int index, float& u, float& v);
+
+    private:
+      /**
+       * @struct PixelState
+       * @brief Running sums of the samples of a refined pixel
+       */
+      struct PixelState {
+        int x;                ///< Column of the pixel
+        int y;                ///< Row of the pixel
+        int count;            ///< Samples taken
+        float r, g, b;        ///< Sum of the sample colors, 1.0 standing for 255
+        double sum;           ///< Sum of the sample luminances
+        double sumSquares;    ///< Sum of the squared sample luminances
+      };
+
+      const Renderer& m_renderer;                ///< Scene and shading
+      const CameraRayGenerator& m_rayGenerator;  ///< Primary rays of the frame
+      std::vector<float> m_luminance;            ///< Luminance of the first pass, row by row
+
+      /**
+       * @brief Tells whether a pixel differs from one of its 8 neighbours by more than the threshold
+       */
+      bool hasContrast(int x, int y) const;
+
+      /**
+       * @brief Takes samples [state.count, target[ of every listed pixel
+       */
+      void sample(std::vector<PixelState>& pixels, const std::vector<uint32_t>& active, int target) const;
+  };
+}
@@ -0,0 +1,91 @@
+/**
+ * @file CameraRayGenerator.hpp
+ * @brief Primary ray generation for a pinhole camera
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the CameraRayGenerator class which turns image coordinates
+ * into world-space ray directions. Everything that depends only on the camera
+ * and the resolution (field of view, aspect ratio, orientation) is folded once
+ * into an image-plane origin and two per-pixel increments, so generating a ray
+ * costs a few multiply-adds and one normalization.
+ */
+
+#pragma once
+
+#include "Core/Camera.hpp"
+#include "Maths/Ray.hpp"
+#include "Utils/Vector3.hpp"
+
+namespace Raytracer {
+    /**
+     * @class CameraRayGenerator
+     * @brief Generates the primary rays of a camera for one frame
+     *
+     * The camera looks along +Z before its rotation, which is applied around X
+     * (pitch), then Y (yaw), then Z (roll), in degrees. The unnormalized direction
+     * through image point (u, v), measured in pixels from the top-left corner of
+     * the image, is topLeft + u * stepX + v * stepY. The generator copies what it
+     * needs from the camera: changing the camera afterwards has no effect on it.
+     */
+    class CameraRayGenerator {
+    public:
+      /**
+       * @brief Precomputes the image plane of a camera
+       *
+       * @param camera The camera (position, rotation, field of view)
+       * @param width Width of the image in pixels
+       * @param height Height of the image in pixels
+       */
+      CameraRayGenerator(const Camera& camera, int width, int height);
+
+      /**
+       * @brief Gets the world-space direction through an image point
+       *
+       * @param u Horizontal position in pixels, x + 0.5 being the center of column x
+       * @param v Vertical position in pixels, y + 0.5 being the center of row y
+       * @return Vector3 Normalized direction
+       */
+      Vector3 getDirection(float u, float v) const
+      {
+          return (m_topLeft + m_stepX * u + m_stepY * v).normalized();
+      }
+
+      /**
+       * @brief Gets the primary ray through the center of a pixel
+       *
+       * @param x Column of the pixel
+       * @param y Row of the pixel
+       * @return Ray Ray from the camera position through the pixel center
+       */
+      Ray generate(int x, int y) const;
+
+      /**
+       * @brief Computes the directions through consecutive pixel centers of a row
+       *
+       * Directions are written as three separate component arrays so that the
+       * loop, and the code consuming them, can be vectorized.
+       *
+       * @param y Row of the pixels
+       * @param x0 Column of the first pixel
+       * @param count Number of pixels
+       * @param dirX Output x components, count elements
+       * @param dirY Output y components, count elements
+       * @param dirZ Output z components, count elements
+       */
+      void generateRow(int y, int x0, int count, float* dirX, float* dirY, float* dirZ) const;
+
+      /**
+       * @brief Gets the origin shared by every primary ray
+       *
+       * @return const Vector3& The camera position
+       */
+      const Vector3& getOrigin() const;
+
+    private:
+      Vector3 m_origin;  ///< Camera position
+      Vector3 m_topLeft; ///< Unnormalized direction through the top-left image corner
+      Vector3 m_stepX;   ///< Direction increment for one pixel to the right
+      Vector3 m_stepY;   ///< Direction increment for one pixel down
+    };
+}
@@ -0,0 +1,155 @@
+/**
+ * @file CostMap.hpp
+ * @brief Per-pixel cost of a render, for finding what makes a frame slow
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the CostMap class. When a renderer is given a cost map,
+ * it traces the primary ray of each pixel on its own and records what that
+ * pixel cost: wall time, intersection tests and iterative steps (tangle cube
+ * marching, torus root polishing). The map is written as a false-color image
+ * and as raw floats in a PFM file.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include "Renderer/Framebuffer.hpp"
+#include "Utils/Color.hpp"
+#include "Utils/RenderStats.hpp"
+
+namespace Raytracer {
+    /**
+     * @class CostMap
+     * @brief Three float costs per pixel, one per channel of an RGB_FLOAT32 framebuffer
+     *
+     * Test and step counts come from the RenderStats counters of the tracing
+     * thread; they stay at 0 in builds without USE_STATS.
+     */
+    class CostMap {
+    public:
+      /**
+       * @brief Measures, in channel order of the raw file
+       */
+      enum Channel {
+        TIME,  ///< Wall time of the pixel, in nanoseconds
+        TESTS, ///< Intersection tests, all primitive types
+        STEPS, ///< Tangle cube steps and quartic Newton iterations
+        CHANNEL_COUNT
+      };
+
+      /**
+       * @class Probe
+       * @brief Work done by the calling thread since the probe was created
+       */
+      class Probe {
+      public:
+        Probe() : m_tests(getTests()), m_steps(getSteps()), m_start(std::chrono::steady_clock::now()) {}
+
+        /**
+         * @brief Stores the cost measured so far into a pixel of a map
+         *
+         * @param map Destination map
+         * @param x Column of the pixel
+         * @param y Row of the pixel
+         */
+        void record(CostMap& map, int x, int y) const
+        {
+            double nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - m_start).count();
+            map.setCost(x, y, static_cast<float>(nanoseconds), static_cast<float>(getTests() - m_tests),
+                static_cast<float>(getSteps() - m_steps));
+        }
+
+      private:
+        uint64_t m_tests;                                 ///< Tests of the thread at creation
+        uint64_t m_steps;                                 ///< Steps of the thread at creation
+        std::chrono::steady_clock::time_point m_start;    ///< Creation time
+
+        static uint64_t getTests()
+        {
+            uint64_t tests = 0;
+            for (int i = RenderStats::SPHERE_TESTS; i <= RenderStats::OTHER_TESTS; ++i)
+                tests += RenderStats::getLocal(static_cast<RenderStats::Counter>(i));
+            return tests;
+        }
+
+        static uint64_t getSteps()
+        {
+            return RenderStats::getLocal(RenderStats::TANGLECUBE_STEPS) + RenderStats::getLocal(RenderStats::QUARTIC_ITERATIONS);
+        }
+      };
+
+      /**
+       * @brief Creates a map of zero costs
+       *
+       * @param width Width of the rendered image
+       * @param height Height of the rendered image
+       */
+      CostMap(int width, int height);
+
+      /**
+       * @brief Sets the costs of a pixel
+       *
+       * @param x Column of the pixel
+       * @param y Row of the pixel
+       * @param nanoseconds Wall time
+       * @param tests Intersection tests
+       * @param steps Iterative steps
+       */
+      void setCost(int x, int y, float nanoseconds, float tests, float steps)
+      {
+          m_costs.setPixel(x, y, nanoseconds, tests, steps);
+      }
+
+      /**
+       * @brief Gets one cost of a pixel
+       *
+       * @param x Column of the pixel
+       * @param y Row of the pixel
+       * @param channel The measure
+       * @return float The cost
+       */
+      float getCost(int x, int y, Channel channel) const;
+
+      /**
+       * @brief Gets the raw costs
+       *
+       * @return const Framebuffer& One pixel per image pixel, channels in Channel order
+       */
+      const Framebuffer& getCosts() const;
+
+      /**
+       * @brief Maps one measure to colors, from black (cheap) to white (expensive)
+       *
+       * The scale ends at the 99th percentile, so that a few outliers do not
+       * flatten the rest of the image.
+       *
+       * @param channel The measure
+       * @return Framebuffer RGB8 image of the same size
+       */
+      Framebuffer getFalseColor(Channel channel = TIME) const;
+
+      /**
+       * @brief Gets the color of a normalized cost
+       *
+       * @param value Cost between 0 and 1, clamped
+       * @return Color Black, blue, magenta, orange, then pale yellow
+       */
+      static Color getHeatColor(float value);
+
+      /**
+       * @brief Writes the false-color image and the raw costs
+       *
+       * @param imageFile Path of the false-color image, its extension gives the format
+       * @param rawFile Path of the raw costs, a PFM file
+       * @param channel Measure shown by the false-color image
+       * @return true if both files were written
+       */
+      bool write(const std::string& imageFile, const std::string& rawFile, Channel channel = TIME) const;
+
+    private:
+      Framebuffer m_costs; ///< Costs, RGB_FLOAT32
+  };
+}
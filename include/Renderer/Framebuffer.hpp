@@ -0,0 +1,280 @@
+/**
+ * @file Framebuffer.hpp
+ * @brief Contiguous image buffer written by the renderer
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the Framebuffer class, a single allocation holding every
+ * pixel of an image row after row, in one of several pixel formats. Color
+ * values are linear, 1.0 standing for the 8-bit value 255; the float formats
+ * keep values above 1.0 for later accumulation or HDR output, RGB8 clamps.
+ *
+ * Rows start on ROW_ALIGNMENT-byte boundaries (the stride may be larger than
+ * width * pixel size). Writers and viewers read rows through getRow() without
+ * any intermediate copy.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Renderer/TileScheduler.hpp"
+#include "Utils/Color.hpp"
+
+namespace Raytracer {
+    /**
+     * @class Framebuffer
+     * @brief Image stored in one contiguous, row-aligned block
+     */
+    class Framebuffer {
+    public:
+      /**
+       * @enum Format
+       * @brief Layout of one pixel
+       */
+      enum Format {
+        RGB_FLOAT32, ///< Three 32-bit floats (12 bytes)
+        RGBA_HALF,   ///< Four 16-bit IEEE half floats, alpha set to 1 (8 bytes)
+        RGB8         ///< Three bytes, values clamped to [0, 255] (3 bytes)
+      };
+
+      static constexpr size_t ROW_ALIGNMENT = 64; ///< Rows start on cache line boundaries
+
+      /**
+       * @class TileView
+       * @brief Write access to the pixels of one tile
+       *
+       * A worker only writes through the view of its own tile. Rows are cache
+       * line aligned, so two tiles share no cache line as long as a tile row
+       * spans a whole number of lines, which is the case for the RGB_FLOAT32
+       * and RGBA_HALF formats with TileScheduler's 32-pixel multiples.
+       */
+      class TileView {
+      public:
+        /**
+         * @brief Creates a view on a tile of a framebuffer
+         *
+         * @param framebuffer The framebuffer, which must outlive the view
+         * @param tile Pixels of the tile, inside the framebuffer
+         */
+        TileView(Framebuffer& framebuffer, const Tile& tile);
+
+        /**
+         * @brief Writes a pixel of the tile
+         *
+         * @param x Column in image coordinates, between tile.x0 and tile.x1 - 1
+         * @param y Row in image coordinates, between tile.y0 and tile.y1 - 1
+         * @param color 8-bit color
+         */
+        void setPixel(int x, int y, const Color& color)
+        {
+            m_framebuffer.setPixel(x, y, color);
+        }
+
+        /**
+         * @brief Writes a pixel of the tile from linear values
+         *
+         * @param x Column in image coordinates
+         * @param y Row in image coordinates
+         * @param r Red, 1.0 standing for 255
+         * @param g Green
+         * @param b Blue
+         */
+        void setPixel(int x, int y, float r, float g, float b)
+        {
+            m_framebuffer.setPixel(x, y, r, g, b);
+        }
+
+        /**
+         * @brief Gets the tile covered by the view
+         *
+         * @return const Tile& The tile
+         */
+        const Tile& getTile() const;
+
+      private:
+        Framebuffer& m_framebuffer; ///< Viewed framebuffer
+        Tile m_tile;                ///< Pixels covered
+      };
+
+      /**
+       * @brief Allocates a framebuffer cleared to black
+       *
+       * @param width Width in pixels
+       * @param height Height in pixels
+       * @param format Pixel format
+       * @param stride Bytes between two rows, 0 for the smallest aligned stride
+       * @throws GlobalException If the size is negative or the stride too small for a row
+       */
+      Framebuffer(int width, int height, Format format = RGB_FLOAT32, size_t stride = 0);
+
+      /**
+       * @brief Copies a framebuffer, pixels included
+       *
+       * @param other The framebuffer to copy
+       */
+      Framebuffer(const Framebuffer& other);
+      Framebuffer& operator=(const Framebuffer& other);
+      Framebuffer(Framebuffer&& other) noexcept = default;
+      Framebuffer& operator=(Framebuffer&& other) noexcept = default;
+
+      /**
+       * @brief Gets the width of the image
+       *
+       * @return int Width in pixels
+       */
+      int getWidth() const;
+
+      /**
+       * @brief Gets the height of the image
+       *
+       * @return int Height in pixels
+       */
+      int getHeight() const;
+
+      /**
+       * @brief Gets the pixel format
+       *
+       * @return Format The format of every pixel
+       */
+      Format getFormat() const;
+
+      /**
+       * @brief Gets the distance between two rows
+       *
+       * @return size_t Stride in bytes
+       */
+      size_t getStride() const;
+
+      /**
+       * @brief Gets the size of one pixel in a format
+       *
+       * @param format The pixel format
+       * @return size_t Size in bytes
+       */
+      static size_t getPixelSize(Format format);
+
+      /**
+       * @brief Gets the first byte of a row
+       *
+       * @param y Row index
+       * @return const uint8_t* Pixels of the row, in the framebuffer format
+       */
+      const uint8_t* getRow(int y) const
+      {
+          return m_data + static_cast<size_t>(y) * m_stride;
+      }
+
+      /**
+       * @brief Gets the first byte of a row for writing
+       *
+       * @param y Row index
+       * @return uint8_t* Pixels of the row, in the framebuffer format
+       */
+      uint8_t* getRow(int y)
+      {
+          return m_data + static_cast<size_t>(y) * m_stride;
+      }
+
+      /**
+       * @brief Writes a pixel from linear values
+       *
+       * @param x Column
+       * @param y Row
+       * @param r Red, 1.0 standing for 255
+       * @param g Green
+       * @param b Blue
+       */
+      void setPixel(int x, int y, float r, float g, float b);
+
+      /**
+       * @brief Writes a pixel from an 8-bit color
+       *
+       * @param x Column
+       * @param y Row
+       * @param color The color
+       */
+      void setPixel(int x, int y, const Color& color);
+
+      /**
+       * @brief Reads a pixel as linear values
+       *
+       * @param x Column
+       * @param y Row
+       * @param r Output red, 1.0 standing for 255
+       * @param g Output green
+       * @param b Output blue
+       */
+      void getPixel(int x, int y, float& r, float& g, float& b) const;
+
+      /**
+       * @brief Reads a pixel as an 8-bit color
+       *
+       * @param x Column
+       * @param y Row
+       * @return Color The pixel, rounded and clamped to [0, 255]
+       */
+      Color getColor(int x, int y) const;
+
+      /**
+       * @brief Converts a row to packed 8-bit RGB
+       *
+       * @param y Row index
+       * @param rgb Receives width * 3 bytes, rounded and clamped like getColor()
+       */
+      void readRow(int y, uint8_t* rgb) const;
+
+      /**
+       * @brief Converts a row to packed linear floats
+       *
+       * @param y Row index
+       * @param rgb Receives width * 3 floats, 1.0 standing for 255
+       */
+      void readRow(int y, float* rgb) const;
+
+      /**
+       * @brief Sets every pixel to black
+       */
+      void clear();
+
+      /**
+       * @brief Gets write access to one tile
+       *
+       * @param tile Pixels of the tile
+       * @return TileView View on the tile
+       */
+      TileView getTileView(const Tile& tile);
+
+      /**
+       * @brief Converts a float to an IEEE 754 half float
+       *
+       * Rounds to nearest even; values too large become infinities.
+       *
+       * @param value The float
+       * @return uint16_t Bits of the half float
+       */
+      static uint16_t toHalf(float value);
+
+      /**
+       * @brief Converts an IEEE 754 half float to a float
+       *
+       * @param half Bits of the half float
+       * @return float The exact value
+       */
+      static float fromHalf(uint16_t half);
+
+    private:
+      int m_width;                  ///< Width in pixels
+      int m_height;                 ///< Height in pixels
+      Format m_format;              ///< Pixel format
+      size_t m_stride;              ///< Bytes between two rows
+      std::vector<uint8_t> m_storage; ///< Pixels, with room to align the first row
+      uint8_t* m_data;              ///< First row, ROW_ALIGNMENT-aligned inside m_storage
+
+      /**
+       * @brief Points m_data at the first aligned byte of m_storage
+       */
+      void alignData();
+  };
+}
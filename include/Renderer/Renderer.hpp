@@ -4,78 +4,211 @@
  *
  * @details
  * The Renderer class handles the complete rendering pipeline from scene description
- * to final image. It implements recursive ray tracing with Blinn-Phong shading model,
- * reflections, and shadows. The renderer processes the scene pixel by pixel,
- * computing ray directions through a virtual camera and accumulating lighting effects.
+ * to final image. It compiles the scene into flat primitive and light tables, splits
+ * the image into tiles shared by the rendering threads, and traces each tile with
+ * Blinn-Phong shading, hard shadows and reflections. Rays start as packets of
+ * neighbouring camera rays, then the AdaptiveSampler spends extra samples on the
+ * pixels that need antialiasing.
  *
  * @author [Your Name]
  * @date 2025 (EPITECH PROJECT)
  * @version 1.0.0
  * @copyright EPITECH PROJECT, 2025
  *
- * @note Uses recursive ray tracing with configurable maximum depth
- * @todo Implement anti-aliasing and acceleration structures
+ * @note Uses recursive ray tracing with configurable maximum depth, or a
+ *       breadth-first wavefront integrator (see WavefrontIntegrator)
+ * @note Pixels are rendered by tiles on several threads (see TileScheduler)
+ * @note Antialiasing is adaptive (see AdaptiveSampler)
  */
 
 #pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <vector>
+#include "Core/Camera.hpp"
+#include "Core/CompiledScene.hpp"
 #include "Core/Scene.hpp"
+#include "Lights/LightTable.hpp"
+#include "Maths/HitRecord.hpp"
 #include "Maths/Ray.hpp"
+#include "Maths/RayPacket.hpp"
+#include "Renderer/CostMap.hpp"
+#include "Renderer/Framebuffer.hpp"
+#include "Renderer/TileScheduler.hpp"
 #include "Utils/Color.hpp"
 #include "Utils/Vector3.hpp"
 #include "Material/Material.hpp"
 namespace Raytracer {
+    class CameraRayGenerator;
 
 /**
  * @class Renderer
  * @brief Main rendering engine that converts a Scene into a 2D image
  *
- * The Renderer takes a Scene description and produces a 2D image by shooting rays
- * through each pixel, computing intersections with scene objects, and applying
- * lighting calculations. It supports:
- * - Primary ray casting
- * - Recursive reflections
- * - Blinn-Phong shading model
- * - Hard shadows
- * - Camera transformations
+ * The Renderer takes a Scene description and produces a 2D image tile by tile:
+ * - Tiles of the image are handed to the rendering threads by a TileScheduler
+ *   and written to the Framebuffer as they finish
+ * - Primary rays of a tile row are traced as RayPacket batches
+ * - RECURSIVE mode finishes each ray, reflections included, with traceRay();
+ *   WAVEFRONT mode traces every ray of a bounce before the next bounce
+ * - Blinn-Phong shading, hard shadows and reflections
+ * - Once the tiles have one sample per pixel, the AdaptiveSampler refines
+ *   the noisy pixels up to the sample budget
  */
     class Renderer {
     public:
+        /**
+         * @enum Mode
+         * @brief Order in which rays are traced
+         */
+        enum Mode {
+          RECURSIVE, ///< Depth-first: each pixel is finished, reflections included, before the next one
+          WAVEFRONT  ///< Breadth-first: every ray of a bounce is traced before the next bounce
+        };
+
+        static constexpr int MAX_DEPTH = 3; ///< Primary ray plus two reflections
+        static constexpr float DEFAULT_NOISE_THRESHOLD = 0.01f; ///< About 2.5 levels out of 255
+
         /**
          * @brief Construct a new Renderer object
          * @param scene Reference to the scene to render
          * @param width Output image width in pixels
          * @param height Output image height in pixels
+         * @param format Pixel format of the framebuffer
+         */
+        Renderer(const Scene& scene, int width, int height, Framebuffer::Format format = Framebuffer::RGB_FLOAT32);
+
+        /**
+         * @brief Sets the number of threads used by render()
+         * @param threadCount Number of threads, 0 for one per hardware thread
+         */
+        void setThreadCount(unsigned int threadCount);
+
+        /**
+         * @brief Get the number of threads used by render()
+         * @return unsigned int The requested thread count, 0 meaning one per hardware thread
+         */
+        unsigned int getThreadCount() const;
+
+        /**
+         * @brief Sets how render() traces rays
+         * @param mode RECURSIVE (default) or WAVEFRONT; both produce the same image
+         */
+        void setMode(Mode mode);
+
+        /**
+         * @brief Gets how render() traces rays
+         * @return Mode The current mode
+         */
+        Mode getMode() const;
+
+        /**
+         * @brief Sets the adaptive antialiasing limits
+         *
+         * With more than one sample per pixel, render() refines the first pass
+         * with an AdaptiveSampler: only pixels with contrast get extra samples.
+         * @param maxSamples Largest number of samples per pixel, 1 (default) to disable, values below 1 count as 1
+         * @param noiseThreshold Luminance difference (1.0 = white) and standard error under which a pixel stops
+         */
+        void setSampling(int maxSamples, float noiseThreshold = DEFAULT_NOISE_THRESHOLD);
+
+        /**
+         * @brief Gets the largest number of samples per pixel
+         * @return int 1 when adaptive sampling is disabled
+         */
+        int getMaxSamples() const;
+
+        /**
+         * @brief Gets the noise threshold of adaptive sampling
+         * @return float Luminance threshold, 1.0 standing for white
+         */
+        float getNoiseThreshold() const;
+
+        /**
+         * @brief Gets the number of primary samples traced by the last render()
+         * @return uint64_t One per pixel plus the adaptive samples
+         */
+        uint64_t getSampleCount() const;
+
+        /**
+         * @brief Sets a function called by render() after each finished tile
+         * @param callback Called from the rendering threads once every pixel of the tile is written;
+         *                 must be thread safe. An empty function disables it.
+         */
+        void setTileCallback(std::function<void(const Tile&)> callback);
+
+        /**
+         * @brief Sets a map receiving the cost of every pixel during render()
+         *
+         * With a map, the first pass traces each primary ray on its own (in both
+         * modes) so that its cost can be measured; the image is the same. Adaptive
+         * samples are not included. Without a map (default), nothing is measured.
+         * @param costMap Map of the image size, which must outlive render(); nullptr to disable
+         */
+        void setCostMap(CostMap* costMap);
+
+        /**
+         * @brief Sets the camera of the next frames
+         *
+         * The scene camera is copied by the constructor; this replaces the copy
+         * without touching the scene. The image size stays the one given to the
+         * constructor.
+         * @param camera Position, rotation and field of view to render from
+         */
+        void setCamera(const Camera& camera);
+
+        /**
+         * @brief Gets the camera of the next frames
+         * @return const Camera& The camera used by render()
+         */
+        const Camera& getCamera() const;
+
+        /**
+         * @brief Renders from primitives and lights compiled beforehand
+         *
+         * By default render() compiles the scene at each call. Compiled tables
+         * never change once built, so they can be shared by several renderers
+         * of the same scene, with different cameras or image sizes.
+         * @param geometry Compiled primitives of the scene, nullptr to compile at each render()
+         * @param lights Light table of the scene, nullptr to build it at each render()
          */
-        Renderer(const Scene& scene, int width, int height);
+        void setCompiled(std::shared_ptr<const CompiledScene> geometry, std::shared_ptr<const LightTable> lights);
 
         /**
          * @brief Executes the complete rendering process
          *
-         * Iterates over all pixels in the output image, computes ray directions,
-         * traces rays through the scene, and stores the resulting colors.
+         * Cuts the output image into tiles that are rendered in parallel, computes
+         * ray directions, traces rays through the scene, and stores the resulting colors.
          */
         void render();
 
         /**
          * @brief Get the rendered image buffer
-         * @return const std::vector<std::vector<Color>>& 2D array of computed pixel colors
+         * @return const Framebuffer& Contiguous image holding the computed pixel colors
          */
-        const std::vector<std::vector<Color>>& getImage() const;
+        const Framebuffer& getImage() const;
 
     private:
         const Scene& m_scene;                           ///< Reference to the scene being rendered
+        Camera m_camera;                                ///< Camera of the frame, the scene's unless replaced
         int m_width;                                    ///< Output image width
         int m_height;                                   ///< Output image height
-        std::vector<std::vector<Color>> m_image;        ///< Output image buffer
+        Framebuffer m_image;                            ///< Output image buffer
+        unsigned int m_threadCount = 0;                 ///< Rendering threads, 0 for hardware_concurrency
+        Mode m_mode = RECURSIVE;                        ///< Tracing order used by render()
+        std::function<void(const Tile&)> m_tileCallback; ///< Called after each finished tile
+        int m_maxSamples = 1;                           ///< Samples per pixel at most, 1 without antialiasing
+        float m_noiseThreshold = DEFAULT_NOISE_THRESHOLD; ///< Contrast and standard error stopping refinement
+        uint64_t m_sampleCount = 0;                     ///< Primary samples of the last render()
+        std::shared_ptr<const LightTable> m_lights;     ///< Lights of the scene, frozen by render()
+        std::shared_ptr<const CompiledScene> m_geometry; ///< Primitives of the scene, compiled by render()
+        std::shared_ptr<const LightTable> m_sharedLights; ///< Lights given to setCompiled(), if any
+        std::shared_ptr<const CompiledScene> m_sharedGeometry; ///< Primitives given to setCompiled(), if any
+        CostMap* m_costMap = nullptr;                   ///< Receives the per-pixel costs, if any
 
-        /**
-         * @brief Computes ray direction for a given pixel coordinate
-         * @param x Pixel x-coordinate (0 to width-1)
-         * @param y Pixel y-coordinate (0 to height-1)
-         * @return Vector3 Normalized ray direction in world space
-         */
-        Vector3 computeRayDirection(int x, int y) const;
+        friend class WavefrontIntegrator;
+        friend class AdaptiveSampler;
 
         /**
          * @brief Traces a ray through the scene recursively
@@ -85,43 +218,59 @@ namespace Raytracer {
          */
         Color traceRay(const Ray& ray, int depth) const;
 
+        /**
+         * @brief Traces a packet of primary rays
+         *
+         * Primary hits and the shadow rays towards each light are found for the
+         * whole packet at once; reflections are then traced ray by ray.
+         * @param packet Primary rays
+         * @param mask Lanes holding a ray
+         * @param colors Output color of each lane of mask
+         */
+        void tracePacket(const RayPacket& packet, uint32_t mask, Color* colors) const;
+
+        /**
+         * @brief Renders a tile pixel by pixel, recording the cost of each into m_costMap
+         * @param rayGenerator Primary ray directions of the frame
+         * @param view Pixels to render
+         */
+        void traceTileCosts(const CameraRayGenerator& rayGenerator, Framebuffer::TileView& view) const;
+
+        /**
+         * @brief Gets the sky color seen by a ray that hits nothing
+         * @param ray The ray
+         * @return Color Gradient from the ray's vertical direction
+         */
+        static Color getSkyColor(const Ray& ray);
+
         /**
          * @brief Computes reflection color at a hit point
-         * @param hitPoint World-space intersection point
-         * @param normal Surface normal at hit point
+         * @param hit Description of the intersection
          * @param ray Incident ray
          * @param depth Current recursion depth
          * @return Color Reflection color contribution
          */
-        Color getReflectionColor(const Vector3& hitPoint, const Vector3& normal, const Ray& ray, int depth) const;
-        // Éclaire le point d'intersection selon Blinn-Phong + ombres
-        Color shadeHit(const Vector3& hitPoint, const Vector3& normal, const Color& baseColor, const Color& reflectionColor, const Material& material) const;
-        // Écrit la couleur 'color' au pixel (x,y) de m_image
-        void setPixel(int x, int y, const Color& color);
+        Color getReflectionColor(const HitRecord& hit, const Ray& ray, int depth) const;
 
         /**
-         * @brief Rotates a vector around X axis
-         * @param v Vector to rotate
-         * @param a Angle in radians
-         * @return Vector3 Rotated vector
+         * @brief Builds the mirror ray leaving a hit point
+         * @param hit Description of the intersection
+         * @param ray Incident ray
+         * @return Ray Reflected ray, offset along the normal to avoid self-intersection
          */
-        Vector3 rotateX(const Vector3& v, float a) const;
+        static Ray getReflectionRay(const HitRecord& hit, const Ray& ray);
 
         /**
-         * @brief Rotates a vector around Y axis
-         * @param v Vector to rotate
-         * @param a Angle in radians
-         * @return Vector3 Rotated vector
+         * @brief Builds the ray from a hit point towards a light
+         * @param hit Description of the intersection
+         * @param lightDir Normalized direction of the light from the hit point
+         * @return Ray Shadow ray, offset along the normal to avoid self-intersection
          */
-        Vector3 rotateY(const Vector3& v, float a) const;
+        static Ray getShadowRay(const HitRecord& hit, const Vector3& lightDir);
 
-        /**
-         * @brief Rotates a vector around Z axis
-         * @param v Vector to rotate
-         * @param a Angle in radians
-         * @return Vector3 Rotated vector
-         */
-        Vector3 rotateZ(const Vector3& v, float a) const;
+        // Éclaire le point d'intersection selon Blinn-Phong + ombres ; les lumières
+        // de 'testedLights' (bit = indice dans m_lights) ont déjà leur visibilité dans 'shadowedLights'
+        Color shadeHit(const HitRecord& hit, const Color& reflectionColor, uint64_t shadowedLights = 0, uint64_t testedLights = 0) const;
     };
 
 } // namespace Raytracer
\ No newline at end of file
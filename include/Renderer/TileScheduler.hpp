@@ -0,0 +1,111 @@
+/**
+ * @file TileScheduler.hpp
+ * @brief Work-stealing distribution of image tiles over rendering threads
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the TileScheduler class which cuts the image into square
+ * tiles and hands them out to a pool of worker threads. Every worker owns a
+ * queue of tiles; once its own queue is drained it steals from the other end of
+ * the other workers' queues, so that expensive regions of the image (reflections,
+ * meshes, implicit surfaces) do not leave the other threads idle.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Raytracer {
+    /**
+     * @struct Tile
+     * @brief Rectangular block of pixels, [x0, x1[ x [y0, y1[
+     */
+    struct Tile {
+        int x0; ///< First column of the tile
+        int y0; ///< First row of the tile
+        int x1; ///< One past the last column of the tile
+        int y1; ///< One past the last row of the tile
+    };
+
+    /**
+     * @class TileScheduler
+     * @brief Runs a per-tile callback on several threads with work stealing
+     */
+    class TileScheduler {
+    public:
+      static constexpr int DEFAULT_TILE_SIZE = 32; ///< Side of a tile in pixels
+
+      /**
+       * @brief Cuts an image into tiles
+       *
+       * @param width Width of the image in pixels
+       * @param height Height of the image in pixels
+       * @param tileSize Side of a tile in pixels, border tiles may be smaller
+       */
+      TileScheduler(int width, int height, int tileSize = DEFAULT_TILE_SIZE);
+
+      /**
+       * @brief Processes every tile exactly once
+       *
+       * Blocks until all tiles are done. The callback is called concurrently from
+       * several threads, but never twice for the same tile. If a callback throws,
+       * the remaining tiles are abandoned and the first exception is rethrown here.
+       *
+       * @param threadCount Number of worker threads, 0 for one per hardware thread
+       * @param renderTile Callback processing one tile
+       */
+      void run(unsigned int threadCount, const std::function<void(const Tile&)>& renderTile);
+
+      /**
+       * @brief Gets the number of tiles the image was cut into
+       *
+       * @return size_t The tile count
+       */
+      size_t getTileCount() const;
+
+      /**
+       * @brief Gets the thread count used when none is requested
+       *
+       * @return unsigned int std::thread::hardware_concurrency(), or 1 if unknown
+       */
+      static unsigned int getDefaultThreadCount();
+
+    private:
+      /**
+       * @struct WorkQueue
+       * @brief Tiles owned by one worker
+       *
+       * The owner pops from the back, thieves take from the front.
+       */
+      struct WorkQueue {
+        std::mutex mutex;       ///< Protects tiles
+        std::deque<Tile> tiles; ///< Tiles not yet processed
+      };
+
+      std::vector<Tile> m_tiles; ///< Every tile of the image, row by row
+
+      /**
+       * @brief Takes the next tile of a worker's own queue
+       *
+       * @param queue The worker's queue
+       * @param tile Output tile
+       * @return true If a tile was taken
+       */
+      static bool popLocal(WorkQueue& queue, Tile& tile);
+
+      /**
+       * @brief Takes a tile from another worker's queue
+       *
+       * @param queues Every worker's queue
+       * @param self Index of the stealing worker
+       * @param tile Output tile
+       * @return true If a tile was stolen, false once every queue is empty
+       */
+      static bool steal(std::vector<std::unique_ptr<WorkQueue>>& queues, size_t self, Tile& tile);
+  };
+}
@@ -0,0 +1,120 @@
+/**
+ * @file WavefrontIntegrator.hpp
+ * @brief Breadth-first (wavefront) tracing of a tile
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the WavefrontIntegrator class, the Renderer::WAVEFRONT
+ * alternative to the recursive traceRay(). Instead of finishing one pixel
+ * before starting the next, it traces every ray of one bounce before moving
+ * to the next bounce: all primary rays of a tile, then all their shadow rays,
+ * then all their reflection rays, and so on. Each queue is sorted so that
+ * neighbouring rays take the same path through the hierarchies, and traced in
+ * RayPacket batches.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Maths/HitRecord.hpp"
+#include "Maths/Ray.hpp"
+#include "Renderer/CameraRayGenerator.hpp"
+#include "Renderer/Framebuffer.hpp"
+#include "Renderer/Renderer.hpp"
+#include "Renderer/TileScheduler.hpp"
+#include "Utils/Color.hpp"
+
+namespace Raytracer {
+    /**
+     * @class WavefrontIntegrator
+     * @brief Renders tiles bounce by bounce through sorted ray queues
+     *
+     * Every bounce keeps one PathVertex per ray: the hit (or the sky color), the
+     * lights hidden from the hit point and the vertex of its reflection in the
+     * next bounce. Once the last bounce is traced, colors are combined from the
+     * deepest bounce back to the primary one with Renderer::shadeHit(), which
+     * gives exactly the image of the recursive mode. Reflection rays are only
+     * emitted for materials that reflect something.
+     */
+    class WavefrontIntegrator {
+    public:
+      static constexpr int TILE_SIZE = 128; ///< Side of the tiles, larger than the recursive ones to fill the queues
+
+      /**
+       * @brief Creates an integrator sharing a renderer's scene and shading
+       *
+       * @param renderer The renderer, which must outlive the integrator
+       */
+      explicit WavefrontIntegrator(const Renderer& renderer);
+
+      /**
+       * @brief Renders one tile
+       *
+       * Uses only local queues: several tiles may be rendered at the same time.
+       *
+       * @param rayGenerator Primary rays of the frame
+       * @param view Output pixels, gives the tile to render
+       */
+      void renderTile(const CameraRayGenerator& rayGenerator, Framebuffer::TileView& view) const;
+
+      /**
+       * @brief Computes the sort key of a ray direction
+       *
+       * The octant of the direction fills the top bits, so rays of different
+       * octants never end up in the same packet; the rest is a Morton code of
+       * the direction quantized to 9 bits per axis.
+       *
+       * @param direction Normalized direction
+       * @return uint32_t Sort key, close keys meaning close directions
+       */
+      static uint32_t directionKey(const Vector3& direction);
+
+    private:
+      /**
+       * @struct PathVertex
+       * @brief Result of one ray of a bounce
+       */
+      struct PathVertex {
+        HitRecord hit;               ///< Closest hit, null primitive if the ray escaped
+        Color color;                 ///< Sky color on a miss, final color once resolved
+        uint64_t shadowedLights = 0; ///< Lights (bit = index) hidden from the hit point
+        int32_t child = -1;          ///< Vertex of the reflection in the next bounce, -1 if none
+      };
+
+      /**
+       * @struct QueuedRay
+       * @brief Ray waiting in a queue, with the vertex receiving its result
+       */
+      struct QueuedRay {
+        Ray ray;         ///< The ray
+        uint32_t vertex; ///< Index of its PathVertex in the bounce
+      };
+
+      const Renderer& m_renderer; ///< Scene, lights and shading
+
+      /**
+       * @brief Finds the closest hit of every queued ray
+       *
+       * @param queue Rays of the bounce, in tracing order
+       * @param vertices Vertices of the bounce, filled with hits or sky colors
+       */
+      void intersect(const std::vector<QueuedRay>& queue, std::vector<PathVertex>& vertices) const;
+
+      /**
+       * @brief Traces one shadow ray per hit and light
+       *
+       * @param queue Rays of the bounce, in tracing order
+       * @param vertices Vertices of the bounce, their shadowedLights are filled
+       * @return uint64_t Lights (bit = index) whose visibility was computed
+       */
+      uint64_t traceShadows(const std::vector<QueuedRay>& queue, std::vector<PathVertex>& vertices) const;
+
+      /**
+       * @brief Sorts a queue by direction for coherent packets
+       *
+       * @param queue Queue to reorder
+       */
+      static void sortQueue(std::vector<QueuedRay>& queue);
+  };
+}
@@ -0,0 +1,144 @@
+/**
+ * @file RenderDaemon.hpp
+ * @brief Long-running renderer answering render jobs
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the RenderDaemon class behind "raytracer --serve". It
+ * reads one job per line, from standard input or from the clients of a Unix
+ * socket, and answers one line per job. Scenes stay parsed and compiled in a
+ * SceneCache and OBJ meshes stay in memory, so jobs rendering the same scene
+ * with other cameras skip all the loading work.
+ *
+ * Protocol (one request per line, one answer per request):
+ * - "render scene=FILE output=FILE [position=X,Y,Z] [rotation=X,Y,Z] [fov=F]
+ *   [width=W] [height=H] [samples=N] [noise=F] [mode=recursive|wavefront]"
+ *   answers "ok OUTPUT cached|loaded MSms" once the image is written.
+ *   Values holding spaces are written between double quotes.
+ * - "stats" answers "ok scenes=N meshes=N jobs=N".
+ * - "quit" answers "ok bye" and stops the daemon.
+ * - Blank lines and lines starting with '#' are ignored, without answer.
+ * Any failure answers "error MESSAGE" and the daemon goes on. A socket client
+ * sending more than RenderDaemon::MAX_LINE_LENGTH bytes without an end of line
+ * gets "error line too long" and is disconnected.
+ */
+
+#pragma once
+
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include "Core/Camera.hpp"
+#include "Core/SceneCache.hpp"
+#include "Renderer/Renderer.hpp"
+#include "Utils/Vector3.hpp"
+
+namespace Raytracer {
+    /**
+     * @class RenderDaemon
+     * @brief Renders jobs one after the other from cached scenes
+     *
+     * Jobs run one at a time, each one on every rendering thread.
+     */
+    class RenderDaemon {
+    public:
+      static constexpr size_t MAX_LINE_LENGTH = 8192; ///< Longest request read from a socket client
+
+      /**
+       * @struct Job
+       * @brief One "render" request; unset fields keep the scene or daemon value
+       */
+      struct Job {
+          std::string scene;                     ///< Scene file
+          std::string output;                    ///< Image file, format given by the extension
+          std::optional<Vector3> position;       ///< Camera position
+          std::optional<Vector3> rotation;       ///< Camera rotation in degrees
+          std::optional<float> fieldOfView;      ///< Camera field of view in degrees
+          std::optional<int> width;              ///< Image width
+          std::optional<int> height;             ///< Image height
+          std::optional<int> samples;            ///< Largest number of samples per pixel
+          std::optional<float> noise;            ///< Noise threshold of adaptive sampling
+          std::optional<Renderer::Mode> mode;    ///< Tracing order
+
+          /**
+           * @brief Replaces the overridden fields of a camera
+           *
+           * @param camera The camera of the scene, modified in place
+           */
+          void applyTo(Camera& camera) const;
+      };
+
+      /**
+       * @brief Creates a daemon and keeps OBJ meshes in memory (MeshCache::setMemoryCache())
+       *
+       * @param threads Rendering threads, 0 for one per hardware thread
+       * @param mode Tracing order of jobs without "mode"
+       * @param samples Samples per pixel of jobs without "samples"
+       * @param noise Noise threshold of jobs without "noise"
+       */
+      RenderDaemon(unsigned int threads, Renderer::Mode mode, int samples, float noise);
+
+      /**
+       * @brief Reads the arguments of a "render" request
+       *
+       * @param arguments The request without its "render" word
+       * @return Job The job
+       * @throws GlobalException If a key is unknown, a value is invalid, or scene or output is missing
+       */
+      static Job parseJob(const std::string& arguments);
+
+      /**
+       * @brief Renders a job and writes its image
+       *
+       * @param job The job
+       * @param reused Set to true if the scene came from the cache
+       * @throws GlobalException If the scene cannot be loaded or the image cannot be written
+       */
+      void render(const Job& job, bool& reused);
+
+      /**
+       * @brief Answers one request
+       *
+       * @param line The request, without its end of line
+       * @return std::string The answer, without end of line; empty for ignored lines
+       */
+      std::string handle(const std::string& line);
+
+      /**
+       * @brief Tells whether "quit" was received
+       *
+       * @return true If the daemon must stop
+       */
+      bool isStopped() const;
+
+      /**
+       * @brief Answers the requests of a stream until its end or "quit"
+       *
+       * @param input Requests, one per line
+       * @param output Answers, one per line, flushed after each one
+       */
+      void serve(std::istream& input, std::ostream& output);
+
+      /**
+       * @brief Answers the clients of a Unix socket, one client at a time, until "quit"
+       *
+       * A stale socket file left by a previous daemon is replaced; the
+       * socket file is removed when the daemon stops. A client whose request
+       * grows beyond MAX_LINE_LENGTH is disconnected.
+       *
+       * @param path Path of the socket file
+       * @throws GlobalException If the socket cannot be created, or path exists and is not a socket
+       */
+      void serveSocket(const std::string& path);
+
+    private:
+      SceneCache m_scenes;           ///< Parsed and compiled scenes
+      unsigned int m_threads;        ///< Rendering threads
+      Renderer::Mode m_mode;         ///< Default tracing order
+      int m_samples;                 ///< Default samples per pixel
+      float m_noise;                 ///< Default noise threshold
+      size_t m_jobs = 0;             ///< Jobs rendered
+      bool m_stopped = false;        ///< "quit" received
+  };
+}
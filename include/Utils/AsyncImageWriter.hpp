@@ -0,0 +1,98 @@
+/**
+ * @file AsyncImageWriter.hpp
+ * @brief Background thread encoding an image while it is rendered
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the AsyncImageWriter class. The renderer reports every
+ * finished tile; as soon as the rows at the top of the image are complete,
+ * a dedicated thread encodes them to the output file, so writing the file
+ * overlaps with the rendering of the rows below.
+ *
+ * The rows go to a temporary file next to the output, renamed to the output
+ * path only by a successful finish(): a render that fails halfway leaves no
+ * truncated image behind, and an older image at that path stays untouched.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Renderer/Framebuffer.hpp"
+#include "Renderer/TileScheduler.hpp"
+#include "Utils/ImageEncoder.hpp"
+
+namespace Raytracer {
+    /**
+     * @class AsyncImageWriter
+     * @brief Encodes the completed rows of a framebuffer on its own thread
+     *
+     * Tiles may complete in any order: the writer counts the finished pixels of
+     * each row and hands the encoder the rows that are complete down from the
+     * top. A finished row is never written again by the renderer, so the
+     * encoder reads it without holding the lock.
+     */
+    class AsyncImageWriter {
+    public:
+      /**
+       * @brief Creates the temporary file and starts the encoding thread
+       *
+       * @param filename Output path, its extension gives the format
+       * @param image Framebuffer being rendered, which must outlive the writer
+       * @throws GlobalException If the extension is not supported or the temporary file cannot be created
+       */
+      AsyncImageWriter(const std::string& filename, const Framebuffer& image);
+
+      /**
+       * @brief Stops the thread and deletes the temporary file if finish() was not called
+       *
+       * Reached without finish() when the render threw: the output path is not written.
+       */
+      ~AsyncImageWriter();
+
+      AsyncImageWriter(const AsyncImageWriter&) = delete;
+      AsyncImageWriter& operator=(const AsyncImageWriter&) = delete;
+
+      /**
+       * @brief Reports a tile whose pixels are all written
+       *
+       * Thread safe; meant to be called by the rendering threads.
+       *
+       * @param tile The finished tile
+       */
+      void tileDone(const Tile& tile);
+
+      /**
+       * @brief Encodes the remaining rows, stops the thread and moves the file to the output path
+       *
+       * Rows never reported complete are written as they are in the framebuffer.
+       * On failure the temporary file is deleted and the output path is not written.
+       *
+       * @return true if the whole file was written to the output path
+       */
+      bool finish();
+
+    private:
+      std::string m_filename;                   ///< Output path
+      std::string m_temporary;                  ///< File being written, renamed to m_filename by finish()
+      const Framebuffer& m_image;               ///< Image being rendered
+      std::unique_ptr<ImageEncoder> m_encoder;  ///< Encoder of the temporary file
+      std::vector<int> m_rowPixels;             ///< Finished pixels of each row
+      int m_readyRows = 0;                      ///< Rows complete from the top
+      bool m_finishing = false;                 ///< finish() was called
+      bool m_abandoned = false;                 ///< Destroyed without finish(), rows left unwritten
+      bool m_result = false;                    ///< Outcome of the encoding
+      std::mutex m_mutex;                       ///< Protects the fields above
+      std::condition_variable m_ready;          ///< Signals new rows, finish() or destruction
+      std::thread m_thread;                     ///< Encoding thread
+
+      /**
+       * @brief Body of the encoding thread
+       */
+      void run();
+  };
+}
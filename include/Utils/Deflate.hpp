@@ -0,0 +1,137 @@
+/**
+ * @file Deflate.hpp
+ * @brief Streaming zlib (RFC 1950 / 1951) compressor
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the Deflater class used by the PNG encoder, so that the
+ * ray tracer can write compressed images without any external library.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Raytracer {
+    /**
+     * @class Deflater
+     * @brief Compresses a byte stream into a zlib stream, chunk by chunk
+     *
+     * Matches are searched with hash chains over a 32 KiB window and coded with
+     * the fixed Huffman tables of the format: no code table has to be built, so
+     * data can be fed and compressed as it arrives. Input is cut into blocks of
+     * BLOCK_SIZE bytes; a block whose codes would take more room than its bytes
+     * (noisy, incompressible data) is stored as is instead. The window slides
+     * over the input, which may be fed in chunks of any size.
+     */
+    class Deflater {
+    public:
+      /**
+       * @brief Creates a compressor, the zlib header is written by the first call
+       */
+      Deflater();
+
+      /**
+       * @brief Compresses more input
+       *
+       * The last MAX_MATCH bytes are kept back until more input (or finish())
+       * tells how far a match may extend, and the codes of the current block
+       * until the block is full.
+       *
+       * @param data Input bytes
+       * @param size Number of bytes
+       * @param out Receives the compressed bytes produced so far
+       */
+      void write(const uint8_t* data, size_t size, std::vector<uint8_t>& out);
+
+      /**
+       * @brief Compresses the pending input and ends the stream
+       *
+       * @param out Receives the last blocks and the Adler-32 trailer
+       */
+      void finish(std::vector<uint8_t>& out);
+
+      /**
+       * @brief Updates an Adler-32 checksum
+       *
+       * @param adler Checksum of the previous bytes, 1 for none
+       * @param data Bytes to add
+       * @param size Number of bytes
+       * @return uint32_t The updated checksum
+       */
+      static uint32_t adler32(uint32_t adler, const uint8_t* data, size_t size);
+
+    private:
+      static constexpr size_t WINDOW_SIZE = 32768; ///< Farthest distance of a match
+      static constexpr size_t HASH_SIZE = 1 << 15; ///< Buckets of the 3-byte hash
+      static constexpr size_t MIN_MATCH = 3;       ///< Shortest match worth coding
+      static constexpr size_t MAX_MATCH = 258;     ///< Longest match of the format
+      static constexpr int MAX_CHAIN = 64;         ///< Candidates tried per position
+      static constexpr int64_t BLOCK_SIZE = 16384; ///< Input bytes per block, a match may overrun it
+
+      /**
+       * @brief Bits not yet gathered into a byte, first bit lowest
+       */
+      struct BitBuffer {
+          uint64_t bits = 0; ///< Pending bits
+          int count = 0;     ///< Number of pending bits
+      };
+
+      std::vector<uint8_t> m_window; ///< Input from m_windowStart, history and pending bytes
+      int64_t m_windowStart = 0;     ///< Stream position of m_window[0]
+      int64_t m_position = 0;        ///< Stream position of the next byte to code
+      std::vector<int64_t> m_head;   ///< Last position of each hash, -1 if none
+      std::vector<int64_t> m_chain;  ///< Previous position with the same hash, by position % WINDOW_SIZE
+      uint32_t m_adler = 1;          ///< Checksum of the input
+      BitBuffer m_bits;              ///< Bits of the stream not yet written to the output
+      std::vector<uint8_t> m_block;  ///< Fixed Huffman codes of the current block, without its header
+      BitBuffer m_blockBits;         ///< Codes of the current block not yet gathered into m_block
+      int64_t m_blockStart = 0;      ///< Stream position of the first byte of the current block
+      bool m_started = false;        ///< zlib header written
+
+      /**
+       * @brief Codes the pending input
+       *
+       * @param flush Codes every byte, otherwise keeps MAX_MATCH bytes back
+       * @param out Receives the compressed bytes
+       */
+      void compress(bool flush, std::vector<uint8_t>& out);
+
+      /**
+       * @brief Adds a position to the hash chains
+       *
+       * @param position Stream position, with at least MIN_MATCH bytes in the window
+       */
+      void insert(int64_t position);
+
+      /**
+       * @brief Writes the current block, coded or stored whichever is smaller, and starts the next one
+       *
+       * @param last Marks the block as the last of the stream
+       * @param out Receives the block
+       */
+      void endBlock(bool last, std::vector<uint8_t>& out);
+
+      /**
+       * @brief Appends bits to a buffer, first bit lowest, and moves whole bytes to out
+       */
+      static void putBits(BitBuffer& buffer, uint32_t value, int count, std::vector<uint8_t>& out);
+
+      /**
+       * @brief Appends a Huffman code to the current block, which the format stores first bit highest
+       */
+      void putCode(uint32_t code, int length);
+
+      /**
+       * @brief Codes a literal byte or a length symbol (256 ends the block) in the current block
+       */
+      void putSymbol(int symbol);
+
+      /**
+       * @brief Codes a match in the current block
+       */
+      void putMatch(size_t length, size_t distance);
+  };
+}
@@ -0,0 +1,112 @@
+/**
+ * @file ImageEncoder.hpp
+ * @brief Base class of the image file writers
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the ImageEncoder class. An encoder writes an image file
+ * band by band: rows are handed over from the top as soon as they are
+ * rendered, so the file can be written while the rest of the image is still
+ * being traced (see AsyncImageWriter). The file format is chosen from the
+ * extension of the output path.
+ */
+
+#pragma once
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include "Renderer/Framebuffer.hpp"
+
+namespace Raytracer {
+    /**
+     * @class ImageEncoder
+     * @brief Writes the rows of a framebuffer to an image file, in order
+     */
+    class ImageEncoder {
+    public:
+      /**
+       * @enum Type
+       * @brief Supported file formats
+       */
+      enum Type {
+        PPM, ///< Binary PPM (P6), 8 bits per channel
+        PNG, ///< PNG, 8 bits per channel, deflate compressed
+        PFM  ///< Portable float map, linear 32-bit floats (1.0 standing for 255)
+      };
+
+      virtual ~ImageEncoder() = default;
+
+      ImageEncoder(const ImageEncoder&) = delete;
+      ImageEncoder& operator=(const ImageEncoder&) = delete;
+
+      /**
+       * @brief Encodes the next rows of the image
+       *
+       * @param image Framebuffer holding the rows
+       * @param y0 First row, the row after the previous call (0 first)
+       * @param y1 One past the last row
+       */
+      virtual void writeRows(const Framebuffer& image, int y0, int y1) = 0;
+
+      /**
+       * @brief Writes what is left of the file and closes it
+       *
+       * @return true if the whole file was written
+       */
+      virtual bool finish();
+
+      /**
+       * @brief Gets the file format matching a path
+       *
+       * @param filename Output path, ending with .ppm, .png or .pfm (any case)
+       * @return Type The format
+       * @throws GlobalException If the extension is not supported
+       */
+      static Type getType(const std::string& filename);
+
+      /**
+       * @brief Creates the encoder matching a path and writes the file header
+       *
+       * @param filename Output path, its extension gives the format
+       * @param width Width of the image
+       * @param height Height of the image
+       * @return std::unique_ptr<ImageEncoder> The encoder, rows are written with writeRows()
+       * @throws GlobalException If the extension is not supported or the file cannot be created
+       */
+      static std::unique_ptr<ImageEncoder> create(const std::string& filename, int width, int height);
+
+      /**
+       * @brief Creates an encoder of a given format and writes the file header
+       *
+       * @param type File format, whatever the extension of the path
+       * @param filename Output path
+       * @param width Width of the image
+       * @param height Height of the image
+       * @return std::unique_ptr<ImageEncoder> The encoder, rows are written with writeRows()
+       * @throws GlobalException If the file cannot be created
+       */
+      static std::unique_ptr<ImageEncoder> create(Type type, const std::string& filename, int width, int height);
+
+      /**
+       * @brief Writes a whole framebuffer to a file
+       *
+       * @param filename Output path, its extension gives the format
+       * @param image The image
+       * @return true if the file was written, false otherwise
+       */
+      static bool write(const std::string& filename, const Framebuffer& image);
+
+    protected:
+      /**
+       * @brief Opens the output file
+       *
+       * @throws GlobalException If the file cannot be created
+       */
+      ImageEncoder(const std::string& filename, int width, int height);
+
+      std::ofstream m_file; ///< Output file, binary
+      int m_width;          ///< Width of the image
+      int m_height;         ///< Height of the image
+  };
+}
@@ -0,0 +1,69 @@
+/**
+ * @file MappedFile.hpp
+ * @brief Read-only memory mapping of a whole file
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the MappedFile class which maps a file into memory with
+ * mmap, so that parsers can scan its bytes in place instead of copying them
+ * into strings first.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace Raytracer {
+    /**
+     * @class MappedFile
+     * @brief RAII owner of a read-only, private mapping of a file
+     *
+     * The mapping is released when the object is destroyed. An empty file gives
+     * an empty view without any mapping.
+     */
+    class MappedFile {
+    public:
+      /**
+       * @brief Maps a file into memory
+       *
+       * @param filename Path of the file to map
+       * @throws GlobalException If the file cannot be opened or mapped
+       */
+      explicit MappedFile(const std::string& filename);
+
+      /**
+       * @brief Unmaps the file
+       */
+      ~MappedFile();
+
+      MappedFile(const MappedFile&) = delete;
+      MappedFile& operator=(const MappedFile&) = delete;
+
+      /**
+       * @brief Gets the first byte of the file
+       *
+       * @return const char* Start of the mapping, nullptr for an empty file
+       */
+      const char* data() const;
+
+      /**
+       * @brief Gets the size of the file
+       *
+       * @return size_t The number of bytes mapped
+       */
+      size_t size() const;
+
+      /**
+       * @brief Gets the content of the file as a string view
+       *
+       * @return std::string_view View over the whole mapping
+       */
+      std::string_view view() const;
+
+    private:
+      const char* m_data = nullptr; ///< Start of the mapping
+      size_t m_size = 0;            ///< Size of the mapping in bytes
+  };
+}
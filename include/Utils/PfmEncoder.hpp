@@ -0,0 +1,39 @@
+/**
+ * @file PfmEncoder.hpp
+ * @brief Portable float map (PFM) image encoder
+ * @author EPITECH
+ * @date 2025
+ */
+
+#pragma once
+
+#include <vector>
+#include "Utils/ImageEncoder.hpp"
+
+namespace Raytracer {
+    /**
+     * @class PfmEncoder
+     * @brief Writes linear RGB rows as 32-bit floats, without clamping
+     *
+     * The format stores the bottom row first. The file size is known from the
+     * header, so each row is written at its final offset as soon as it arrives.
+     */
+    class PfmEncoder : public ImageEncoder {
+    public:
+      /**
+       * @brief Creates the file and writes the header
+       *
+       * @param filename Output path
+       * @param width Width of the image
+       * @param height Height of the image
+       * @throws GlobalException If the file cannot be created
+       */
+      PfmEncoder(const std::string& filename, int width, int height);
+
+      void writeRows(const Framebuffer& image, int y0, int y1) override;
+
+    private:
+      std::streamoff m_dataOffset; ///< Size of the header
+      std::vector<float> m_row;    ///< Row converted to linear floats
+  };
+}
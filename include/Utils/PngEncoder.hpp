@@ -0,0 +1,73 @@
+/**
+ * @file PngEncoder.hpp
+ * @brief PNG image encoder
+ * @author EPITECH
+ * @date 2025
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Utils/Deflate.hpp"
+#include "Utils/ImageEncoder.hpp"
+
+namespace Raytracer {
+    /**
+     * @class PngEncoder
+     * @brief Writes 8-bit RGB rows as a PNG file
+     *
+     * Each row gets the PNG filter with the smallest sum of absolute filtered
+     * bytes, then goes through a Deflater; compressed data is written in IDAT
+     * chunks as it accumulates, so only one chunk is ever held in memory.
+     */
+    class PngEncoder : public ImageEncoder {
+    public:
+      static constexpr size_t CHUNK_SIZE = 1 << 16; ///< Compressed bytes per IDAT chunk
+
+      /**
+       * @brief Creates the file and writes the signature and the IHDR chunk
+       *
+       * @param filename Output path
+       * @param width Width of the image
+       * @param height Height of the image
+       * @throws GlobalException If the file cannot be created
+       */
+      PngEncoder(const std::string& filename, int width, int height);
+
+      void writeRows(const Framebuffer& image, int y0, int y1) override;
+      bool finish() override;
+
+      /**
+       * @brief Updates a CRC-32 (as used by PNG chunks)
+       *
+       * @param crc Checksum of the previous bytes, 0 for none
+       * @param data Bytes to add
+       * @param size Number of bytes
+       * @return uint32_t The updated checksum
+       */
+      static uint32_t crc32(uint32_t crc, const uint8_t* data, size_t size);
+
+    private:
+      Deflater m_deflater;                ///< Compressor of the filtered rows
+      std::vector<uint8_t> m_compressed;  ///< Compressed bytes not yet written
+      std::vector<uint8_t> m_row;         ///< Current row, 8-bit RGB
+      std::vector<uint8_t> m_previousRow; ///< Row above, zeros for the first row
+      std::vector<uint8_t> m_filtered;    ///< Filter type byte followed by the filtered row
+      std::vector<uint8_t> m_candidate;   ///< Row filtered by the filter being tried
+
+      /**
+       * @brief Writes a chunk with its length and CRC
+       *
+       * @param type Four-letter chunk type
+       * @param data Chunk data
+       * @param size Size of the data
+       */
+      void writeChunk(const char* type, const uint8_t* data, size_t size);
+
+      /**
+       * @brief Picks the filter of m_row and fills m_filtered
+       */
+      void filterRow();
+  };
+}
@@ -51,6 +51,23 @@ namespace Raytracer {
          */
         static int solveQuartic(float a, float b, float c, float d, float e, float roots[4]);
 
+        /**
+         * @brief Solves a quartic equation ax⁴ + bx³ + cx² + dx + e = 0 in double precision
+         *
+         * Ferrari's method: the depressed quartic is split into two quadratics
+         * using the largest root of its resolvent cubic, then every root is
+         * polished with Newton-Raphson on the original polynomial.
+         *
+         * @param a x⁴ coefficient
+         * @param b x³ coefficient
+         * @param c x² coefficient
+         * @param d x coefficient
+         * @param e Constant term
+         * @param roots Array to store found roots, sorted in ascending order
+         * @return int Number of real roots found
+         */
+        static int solveQuartic(double a, double b, double c, double d, double e, double roots[4]);
+
         /**
          * @brief Solves a cubic equation ax³ + bx² + cx + d = 0
          * @param a x³ coefficient
@@ -62,6 +79,17 @@ namespace Raytracer {
          */
         static int solveCubic(float a, float b, float c, float d, float roots[3]);
 
+        /**
+         * @brief Solves a cubic equation ax³ + bx² + cx + d = 0 in double precision
+         * @param a x³ coefficient
+         * @param b x² coefficient
+         * @param c x coefficient
+         * @param d Constant term
+         * @param roots Array to store found roots, the largest one first
+         * @return int Number of real roots found
+         */
+        static int solveCubic(double a, double b, double c, double d, double roots[3]);
+
         /**
          * @brief Solves a quadratic equation ax² + bx + c = 0
          * @param a x² coefficient
@@ -72,25 +100,34 @@ namespace Raytracer {
          */
         static int solveQuadratic(float a, float b, float c, float roots[2]);
 
+        /**
+         * @brief Solves a quadratic equation ax² + bx + c = 0 in double precision
+         *
+         * Uses the cancellation-free form of the quadratic formula.
+         *
+         * @param a x² coefficient
+         * @param b x coefficient
+         * @param c Constant term
+         * @param roots Array to store found roots
+         * @return int Number of real roots found (0, 1, or 2)
+         */
+        static int solveQuadratic(double a, double b, double c, double roots[2]);
+
     private:
         static constexpr float EPSILON = 1e-6f;      ///< Tolerance for root validation
         static constexpr int MAX_ITERATIONS = 100;   ///< Maximum Newton-Raphson iterations
 
         /**
-         * @brief Refines a root guess using Newton-Raphson method
-         * @param a-d Polynomial coefficients
-         * @param guess Initial root estimate
-         * @return float Refined root approximation
-         */
-        static float newtonRaphson(float a, float b, float c, float d, float e, float guess);
-
-        /**
-         * @brief Validates if a value is a proper root of the polynomial
-         * @param x Potential root to test
+         * @brief Refines a root guess of ax⁴ + bx³ + cx² + dx + e using Newton-Raphson method
+         *
+         * Stops as soon as a step no longer reduces the residual, so a good guess
+         * is never made worse.
+         *
          * @param a-e Polynomial coefficients
-         * @return true if x is a valid root within EPSILON tolerance
+         * @param guess Initial root estimate
+         * @return double Refined root approximation
          */
-        static bool isRootValid(float x, float a, float b, float c, float d, float e);
+        static double newtonRaphson(double a, double b, double c, double d, double e, double guess);
     };
 
-} // namespace Raytracer
\ No newline at end of file
+} // namespace Raytracer
@@ -0,0 +1,35 @@
+/**
+ * @file PpmEncoder.hpp
+ * @brief Binary PPM (P6) image encoder
+ * @author EPITECH
+ * @date 2025
+ */
+
+#pragma once
+
+#include <vector>
+#include "Utils/ImageEncoder.hpp"
+
+namespace Raytracer {
+    /**
+     * @class PpmEncoder
+     * @brief Writes 8-bit RGB rows as raw bytes after a P6 header
+     */
+    class PpmEncoder : public ImageEncoder {
+    public:
+      /**
+       * @brief Creates the file and writes the header
+       *
+       * @param filename Output path
+       * @param width Width of the image
+       * @param height Height of the image
+       * @throws GlobalException If the file cannot be created
+       */
+      PpmEncoder(const std::string& filename, int width, int height);
+
+      void writeRows(const Framebuffer& image, int y0, int y1) override;
+
+    private:
+      std::vector<uint8_t> m_row; ///< Row converted to 8-bit RGB
+  };
+}
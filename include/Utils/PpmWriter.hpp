@@ -12,13 +12,13 @@
  * @version 1.0.0
  * @copyright EPITECH PROJECT, 2025
  *
- * @note Outputs PPM files in binary format (P6)
- * @todo Add support for other image formats (PNG, JPEG)
+ * @note Outputs PPM files in binary format (P6); see ImageEncoder for PNG and PFM
  */
 
 #pragma once
 
 #include <string>
+#include "Renderer/Framebuffer.hpp"
 #include "Renderer/Renderer.hpp"
 
 namespace Raytracer {
@@ -47,14 +47,14 @@ namespace Raytracer {
         bool saveToFile(const std::string& filename) const;
 
         /**
-         * @brief Static method to write any image buffer to PPM format
+         * @brief Static method to write any image buffer to binary PPM (P6) format
          * @param filename Path to the output file
-         * @param image 2D vector of Colors representing the image
+         * @param image Framebuffer read in place, row by row
          * @return true if file was successfully written, false otherwise
          *
          * @note This static method can be used without instantiating PPMWriter
          */
-        static bool write(const std::string& filename, const std::vector<std::vector<Color>>& image);
+        static bool write(const std::string& filename, const Framebuffer& image);
 
     private:
         const Renderer& m_renderer; ///< Reference to the renderer containing the image data
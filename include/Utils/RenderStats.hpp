@@ -0,0 +1,269 @@
+/**
+ * @file RenderStats.hpp
+ * @brief Counters and phase timers of a render
+ * @author EPITECH
+ * @date 2025
+ *
+ * This file contains the RenderStats class. The hot paths of the renderer
+ * (ray generation, BVH traversal, primitive tests) bump counters that live
+ * in a block owned by the calling thread, so counting needs neither locks
+ * nor shared cache lines; the blocks are summed when the statistics are
+ * collected. Without the USE_STATS definition, count() and ScopedPhase
+ * compile to nothing.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+namespace Raytracer {
+    /**
+     * @class RenderStats
+     * @brief Process-wide statistics, merged from per-thread counters
+     */
+    class RenderStats {
+    public:
+      /**
+       * @brief Counted events
+       *
+       * The intersection tests follow the order of CompiledScene::PrimitiveType;
+       * a packet test counts one test per active lane.
+       */
+      enum Counter {
+        PRIMARY_RAYS,        ///< Camera rays, antialiasing samples included
+        SHADOW_RAYS,         ///< Occlusion rays toward the lights
+        REFLECTION_RAYS,     ///< Rays spawned by reflective surfaces
+        SPHERE_TESTS,        ///< Ray-sphere tests
+        PLANE_TESTS,         ///< Ray-plane tests
+        TRIANGLE_TESTS,      ///< Ray-triangle tests
+        CYLINDER_TESTS,      ///< Ray-cylinder tests
+        CONE_TESTS,          ///< Ray-cone tests
+        TORUS_TESTS,         ///< Ray-torus tests
+        TANGLECUBE_TESTS,    ///< Ray-tangle cube tests
+        MESH_TESTS,          ///< Ray-mesh tests, each walking the mesh's own BVH
+        INSTANCE_TESTS,      ///< Ray-mesh instance tests, each walking the shared mesh's BVH
+        GROUP_TESTS,         ///< Ray-group copy tests, each querying the compiled group
+        OTHER_TESTS,         ///< Tests of primitives of other types
+        BVH_NODES,           ///< Nodes visited by every BVH traversal
+        QUARTIC_ITERATIONS,  ///< Newton iterations polishing quartic roots (torus)
+        TANGLECUBE_STEPS,    ///< Sphere tracing and root refinement steps
+        COUNTER_COUNT
+      };
+
+      /**
+       * @brief Timed phases, each timed without the phases nested in it
+       */
+      enum Phase {
+        PARSE,     ///< Scene file reading
+        OBJ_LOAD,  ///< OBJ parsing or mesh cache reading, with the mesh BVH
+        BUILD,     ///< Light table and compiled scene with its BVH
+        RENDER,    ///< Tracing of the image
+        WRITE,     ///< Image encoding left once the render is over
+        PHASE_COUNT
+      };
+
+      /**
+       * @struct Snapshot
+       * @brief Totals of every thread at one point in time
+       */
+      struct Snapshot {
+          uint64_t counters[COUNTER_COUNT] = {}; ///< Total of each counter
+          double seconds[PHASE_COUNT] = {};      ///< Wall time of each phase
+
+          /**
+           * @brief Gets the number of intersection tests, all types together
+           *
+           * @return uint64_t Tests of every primitive type
+           */
+          uint64_t getTestCount() const;
+
+          /**
+           * @brief Gets the mean of a counter per occurrence of another
+           *
+           * @param counter Counted work
+           * @param per Counted occurrences
+           * @return double counter / per, 0 if per is 0
+           */
+          double getAverage(Counter counter, Counter per) const;
+      };
+
+      /**
+       * @brief Adds to a counter of the calling thread
+       *
+       * @param counter The counter
+       * @param amount Value added
+       */
+      static void add(Counter counter, uint64_t amount)
+      {
+          Block& block = s_block;
+          if (!block.enrolled) [[unlikely]]
+              enroll(block);
+          // Seul ce thread écrit dans son bloc : pas besoin d'instruction atomique
+          block.values[counter].store(block.values[counter].load(std::memory_order_relaxed) + amount,
+              std::memory_order_relaxed);
+      }
+
+      /**
+       * @brief Counts from a hot path, removed from builds without USE_STATS
+       *
+       * @param counter The counter
+       * @param amount Value added
+       */
+      static void count([[maybe_unused]] Counter counter, [[maybe_unused]] uint64_t amount = 1)
+      {
+#ifdef USE_STATS
+          add(counter, amount);
+#endif
+      }
+
+      /**
+       * @brief Gets a counter of the calling thread only
+       *
+       * @param counter The counter
+       * @return uint64_t Total counted by this thread since it started or since reset()
+       */
+      static uint64_t getLocal(Counter counter)
+      {
+          return s_block.values[counter].load(std::memory_order_relaxed);
+      }
+
+      /**
+       * @brief Adds wall time to a phase
+       *
+       * @param phase The phase
+       * @param seconds Elapsed time
+       */
+      static void addTime(Phase phase, double seconds);
+
+      /**
+       * @brief Sums the counters of the live and finished threads
+       *
+       * @return Snapshot The totals
+       */
+      static Snapshot collect();
+
+      /**
+       * @brief Sets every counter and phase back to zero
+       *
+       * Counts added at the same time by other threads may be lost; meant to
+       * be called between renders.
+       */
+      static void reset();
+
+      /**
+       * @brief Prints a snapshot as an aligned table
+       *
+       * @param out Destination stream
+       * @param stats The snapshot
+       */
+      static void printTable(std::ostream& out, const Snapshot& stats);
+
+      /**
+       * @brief Prints a snapshot as a JSON object
+       *
+       * @param out Destination stream
+       * @param stats The snapshot
+       */
+      static void printJson(std::ostream& out, const Snapshot& stats);
+
+      /**
+       * @brief Gets the JSON key of a counter
+       */
+      static const char* getName(Counter counter);
+
+      /**
+       * @brief Gets the JSON key of a phase
+       */
+      static const char* getName(Phase phase);
+
+      /**
+       * @class Tally
+       * @brief Local count of a loop, added to a counter once when it goes out of scope
+       */
+      class Tally {
+      public:
+        explicit Tally(Counter counter) : m_counter(counter) {}
+        ~Tally() { count(m_counter, m_amount); }
+
+        Tally(const Tally&) = delete;
+        Tally& operator=(const Tally&) = delete;
+
+        void operator++() { ++m_amount; }
+
+      private:
+        Counter m_counter;     ///< Counter added to
+        uint64_t m_amount = 0; ///< Events counted so far
+      };
+
+      /**
+       * @class ScopedPhase
+       * @brief Times a phase for the lifetime of the object
+       *
+       * Phases nest on a thread: while an inner phase runs, the outer one is
+       * paused, so the phase times add up to the total time. Does nothing
+       * without USE_STATS.
+       */
+      class ScopedPhase {
+      public:
+        explicit ScopedPhase(Phase phase);
+        ~ScopedPhase();
+
+        ScopedPhase(const ScopedPhase&) = delete;
+        ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+#ifdef USE_STATS
+      private:
+        using Clock = std::chrono::steady_clock;
+
+        Phase m_phase;                 ///< Timed phase
+        Clock::time_point m_start;     ///< Start of the part not yet added
+        ScopedPhase* m_outer;          ///< Phase paused by this one, if any
+        static thread_local ScopedPhase* s_current; ///< Innermost phase of the thread
+#endif
+      };
+
+    private:
+      /**
+       * @struct Block
+       * @brief Counters of one thread
+       */
+      struct Block {
+          std::atomic<uint64_t> values[COUNTER_COUNT] = {}; ///< Written by the owner only
+          bool enrolled = false;                            ///< Known to collect()
+      };
+
+      static thread_local Block s_block; ///< Counters of the calling thread
+
+      /**
+       * @brief Registers the block of the calling thread, merged into the totals when the thread ends
+       */
+      static void enroll(Block& block);
+  };
+
+  inline thread_local RenderStats::Block RenderStats::s_block;
+
+#ifdef USE_STATS
+  inline RenderStats::ScopedPhase::ScopedPhase(Phase phase)
+      : m_phase(phase), m_start(Clock::now()), m_outer(s_current)
+  {
+      if (m_outer)
+          RenderStats::addTime(m_outer->m_phase, std::chrono::duration<double>(m_start - m_outer->m_start).count());
+      s_current = this;
+  }
+
+  inline RenderStats::ScopedPhase::~ScopedPhase()
+  {
+      Clock::time_point end = Clock::now();
+      RenderStats::addTime(m_phase, std::chrono::duration<double>(end - m_start).count());
+      s_current = m_outer;
+      if (m_outer)
+          m_outer->m_start = end;
+  }
+#else
+  inline RenderStats::ScopedPhase::ScopedPhase(Phase) {}
+  inline RenderStats::ScopedPhase::~ScopedPhase() {}
+#endif
+}
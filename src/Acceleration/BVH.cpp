@@ -0,0 +1,198 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** BVH
+*/
+
+#include "Acceleration/BVH.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace Raytracer {
+
+void BVH::build(const std::vector<AABB>& primitiveBounds)
+{
+    clear();
+    if (primitiveBounds.empty())
+        return;
+
+    uint32_t count = static_cast<uint32_t>(primitiveBounds.size());
+    std::vector<Vector3> centroids(count);
+    m_indices.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        centroids[i] = primitiveBounds[i].centroid();
+        m_indices[i] = i;
+    }
+
+    // A binary tree over N leaves never needs more than 2N - 1 nodes
+    m_nodes.reserve(2 * count - 1);
+    Node root;
+    root.leftFirst = 0;
+    root.count = count;
+    for (uint32_t i = 0; i < count; ++i)
+        root.bounds.expand(primitiveBounds[i]);
+    m_nodes.push_back(root);
+    subdivide(0, primitiveBounds, centroids, 0);
+    m_nodes.shrink_to_fit();
+}
+
+bool BVH::assign(std::vector<Node> nodes, std::vector<uint32_t> indices, uint32_t primitiveCount)
+{
+    clear();
+    if (nodes.empty())
+        return indices.empty();
+    for (uint32_t index : indices) {
+        if (index >= primitiveCount)
+            return false;
+    }
+    // Les enfants sont toujours créés après leur parent : pas de cycle possible, et la
+    // profondeur se propage en un seul passage pour borner la pile de parcours
+    std::vector<uint8_t> depth(nodes.size(), 0);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const Node& node = nodes[i];
+        if (node.count > 0) {
+            if (node.leftFirst > indices.size() || node.count > indices.size() - node.leftFirst)
+                return false;
+        } else if (node.leftFirst <= i || node.leftFirst + 1 >= nodes.size() || depth[i] >= STACK_SIZE - 1) {
+            return false;
+        } else {
+            depth[node.leftFirst] = depth[i] + 1;
+            depth[node.leftFirst + 1] = depth[i] + 1;
+        }
+    }
+    m_nodes = std::move(nodes);
+    m_indices = std::move(indices);
+    return true;
+}
+
+const std::vector<BVH::Node>& BVH::getNodes() const
+{
+    return m_nodes;
+}
+
+const std::vector<uint32_t>& BVH::getIndices() const
+{
+    return m_indices;
+}
+
+void BVH::clear()
+{
+    m_nodes.clear();
+    m_indices.clear();
+}
+
+bool BVH::empty() const
+{
+    return m_nodes.empty();
+}
+
+AABB BVH::getBounds() const
+{
+    return m_nodes.empty() ? AABB() : m_nodes[0].bounds;
+}
+
+size_t BVH::getNodeCount() const
+{
+    return m_nodes.size();
+}
+
+static float axisOf(const Vector3& v, int axis)
+{
+    return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+}
+
+void BVH::subdivide(uint32_t nodeIndex, const std::vector<AABB>& bounds, const std::vector<Vector3>& centroids, int depth)
+{
+    uint32_t first = m_nodes[nodeIndex].leftFirst;
+    uint32_t count = m_nodes[nodeIndex].count;
+    if (count <= 1 || depth >= STACK_SIZE - 1)
+        return;
+
+    AABB centroidBounds;
+    for (uint32_t i = first; i < first + count; ++i)
+        centroidBounds.expand(centroids[m_indices[i]]);
+    int axis = centroidBounds.longestAxis();
+    float axisMin = axisOf(centroidBounds.min, axis);
+    float axisMax = axisOf(centroidBounds.max, axis);
+    // Every centroid at the same place: no split can separate them
+    if (axisMax <= axisMin)
+        return;
+
+    // Binned SAH: drop the centroids into buckets along the longest axis
+    struct Bin {
+        AABB bounds;
+        uint32_t count = 0;
+    } bins[BIN_COUNT];
+    float scale = BIN_COUNT / (axisMax - axisMin);
+    for (uint32_t i = first; i < first + count; ++i) {
+        uint32_t idx = m_indices[i];
+        int b = std::min(BIN_COUNT - 1, static_cast<int>((axisOf(centroids[idx], axis) - axisMin) * scale));
+        bins[b].count++;
+        bins[b].bounds.expand(bounds[idx]);
+    }
+
+    // Sweep from both sides to get the cost of every bucket boundary
+    float leftArea[BIN_COUNT - 1];
+    uint32_t leftCount[BIN_COUNT - 1];
+    AABB leftBox;
+    uint32_t leftSum = 0;
+    for (int i = 0; i < BIN_COUNT - 1; ++i) {
+        leftSum += bins[i].count;
+        leftCount[i] = leftSum;
+        leftBox.expand(bins[i].bounds);
+        leftArea[i] = leftBox.surfaceArea();
+    }
+    AABB rightBox;
+    uint32_t rightSum = 0;
+    float bestCost = std::numeric_limits<float>::infinity();
+    int bestSplit = -1;
+    for (int i = BIN_COUNT - 1; i > 0; --i) {
+        rightSum += bins[i].count;
+        rightBox.expand(bins[i].bounds);
+        if (leftCount[i - 1] == 0 || rightSum == 0)
+            continue;
+        float cost = leftCount[i - 1] * leftArea[i - 1] + rightSum * rightBox.surfaceArea();
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestSplit = i;
+        }
+    }
+    if (bestSplit < 0)
+        return;
+
+    // Small nodes only split when the SAH says it beats testing every primitive
+    float leafCost = count * m_nodes[nodeIndex].bounds.surfaceArea();
+    if (count <= MAX_LEAF && bestCost >= leafCost)
+        return;
+
+    uint32_t* begin = m_indices.data() + first;
+    uint32_t* middle = std::partition(begin, begin + count, [&](uint32_t idx) {
+        int b = std::min(BIN_COUNT - 1, static_cast<int>((axisOf(centroids[idx], axis) - axisMin) * scale));
+        return b < bestSplit;
+    });
+    uint32_t leftN = static_cast<uint32_t>(middle - begin);
+    if (leftN == 0 || leftN == count)
+        return;
+
+    uint32_t leftChild = static_cast<uint32_t>(m_nodes.size());
+    Node left;
+    left.leftFirst = first;
+    left.count = leftN;
+    Node right;
+    right.leftFirst = first + leftN;
+    right.count = count - leftN;
+    for (uint32_t i = left.leftFirst; i < left.leftFirst + left.count; ++i)
+        left.bounds.expand(bounds[m_indices[i]]);
+    for (uint32_t i = right.leftFirst; i < right.leftFirst + right.count; ++i)
+        right.bounds.expand(bounds[m_indices[i]]);
+    m_nodes.push_back(left);
+    m_nodes.push_back(right);
+    m_nodes[nodeIndex].leftFirst = leftChild;
+    m_nodes[nodeIndex].count = 0;
+
+    subdivide(leftChild, bounds, centroids, depth + 1);
+    subdivide(leftChild + 1, bounds, centroids, depth + 1);
+}
+
+}
@@ -0,0 +1,575 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** CompiledScene
+*/
+
+#include "Core/CompiledScene.hpp"
+#include <bit>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <utility>
+#include "GlobalException.hpp"
+#include "Primitives/CompositePrimitive.hpp"
+#include "Primitives/Cone.hpp"
+#include "Primitives/Cylinder.hpp"
+#include "Primitives/MeshInstance.hpp"
+#include "Primitives/Plane.hpp"
+#include "Primitives/Sphere.hpp"
+#include "Primitives/TangleCube.hpp"
+#include "Primitives/Torus.hpp"
+#include "Primitives/Triangle.hpp"
+#include "Primitives/TriangleMesh.hpp"
+#include "Utils/RenderStats.hpp"
+
+namespace Raytracer {
+
+static constexpr float EPSILON = IPrimitive::OCCLUSION_EPSILON;
+
+// Les compteurs de tests suivent l'ordre des tables
+static_assert(RenderStats::SPHERE_TESTS + static_cast<int>(CompiledScene::OTHER) == RenderStats::OTHER_TESTS);
+
+static void countTests(uint32_t type, uint32_t rays)
+{
+    RenderStats::count(static_cast<RenderStats::Counter>(RenderStats::SPHERE_TESTS + type), rays);
+}
+
+// Les composites ne sont que des conteneurs : seules leurs feuilles sont compilées
+static void collectLeaves(const IPrimitive* primitive, std::vector<const IPrimitive*>& leaves)
+{
+    if (auto composite = dynamic_cast<const CompositePrimitive*>(primitive)) {
+        for (size_t i = 0; i < composite->getSize(); ++i)
+            collectLeaves(composite->getPrimitiveAt(i).get(), leaves);
+        return;
+    }
+    leaves.push_back(primitive);
+}
+
+// Enchaînements par défaut de IPrimitive, instanciés sur un type final : appels résolus à la compilation
+template <typename T>
+static bool intersectShape(const T* shape, const Ray& ray, HitRecord& hit)
+{
+    float t;
+    if (!shape->T::intersect(ray, t))
+        return false;
+    hit.t = t;
+    hit.point = ray.at(t);
+    hit.normal = shape->T::getNormal(hit.point);
+    hit.primitive = shape;
+    hit.hasUV = false;
+    return true;
+}
+
+template <typename T>
+static bool occludesShape(const T* shape, const Ray& ray, float tMax)
+{
+    float t;
+    return shape->T::intersect(ray, t) && t > EPSILON && t < tMax;
+}
+
+template <typename T>
+static void intersectPacketShape(const T* shape, uint16_t material, const RayPacket& packet, uint32_t mask, PacketHit& hits)
+{
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        HitRecord record;
+        if ((mask & (1u << i)) && intersectShape(shape, packet.rays[i], record)
+            && record.t > EPSILON && record.t < hits.t[i]) {
+            record.material = material;
+            hits.t[i] = record.t;
+            hits.records[i] = record;
+        }
+    }
+}
+
+template <typename T>
+static uint32_t occludesPacketShape(const T* shape, const RayPacket& packet, uint32_t mask, const float* tMax)
+{
+    uint32_t occluded = 0;
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        if ((mask & (1u << i)) && occludesShape(shape, packet.rays[i], tMax[i]))
+            occluded |= 1u << i;
+    }
+    return occluded;
+}
+
+// Paquet confié à une primitive qui remplit ses records : les voies rapprochées reçoivent son matériau
+static void intersectPacketWith(const IPrimitive* primitive, uint16_t material, const RayPacket& packet,
+    uint32_t mask, PacketHit& hits)
+{
+    const FloatV before = FloatV::load(hits.t);
+    primitive->intersectPacket(packet, mask, hits);
+    uint32_t closer = movemask(FloatV::load(hits.t) < before);
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        if (closer & (1u << i))
+            hits.records[i].material = material;
+    }
+}
+
+CompiledScene::CompiledScene(const std::vector<std::shared_ptr<IPrimitive>>& primitives,
+    const std::vector<PrimitiveGroup>& groups, const std::vector<Placement>& placements)
+{
+    std::vector<const IPrimitive*> leaves;
+    for (const auto& primitive : primitives)
+        collectLeaves(primitive.get(), leaves);
+
+    std::vector<const IPrimitive*> bounded;
+    std::vector<AABB> bounds;
+    for (const IPrimitive* leaf : leaves) {
+        if (leaf->isBounded()) {
+            bounded.push_back(leaf);
+            bounds.push_back(leaf->getBoundingBox());
+        } else {
+            m_unbounded.push_back(add(leaf));
+        }
+    }
+
+    // Copies développées ici seulement : une transformation par copie, le groupe n'est compilé qu'une fois
+    const std::vector<AABB> groupBounds = compileGroups(groups);
+    std::vector<uint32_t> copyGroup;
+    std::vector<Transform> copyToGroup;
+    for (const Placement& placement : placements) {
+        if (placement.getGroup() >= groups.size())
+            throw GlobalException("CompiledScene: placement of unknown group #" + std::to_string(placement.getGroup()));
+        const AABB& box = groupBounds[placement.getGroup()];
+        if (box.isEmpty())
+            continue;
+        if (bounded.size() + copyGroup.size() + placement.getCount() > INDEX_MASK)
+            throw GlobalException("CompiledScene: too many copies of groups");
+        for (size_t i = 0; i < placement.getCount(); ++i) {
+            Transform transform = placement.getTransform(i);
+            copyGroup.push_back(static_cast<uint32_t>(placement.getGroup()));
+            copyToGroup.push_back(transform.inverse());
+            bounds.push_back(transform.applyToBox(box));
+        }
+    }
+
+    m_bvh.build(bounds);
+    // Tables remplies dans l'ordre des feuilles : une feuille lit des entrées voisines,
+    // et la BVH renvoie directement la position dans m_bounded
+    for (uint32_t index : m_bvh.getIndices()) {
+        if (index < bounded.size())
+            m_bounded.push_back(add(bounded[index]));
+        else
+            m_bounded.push_back(addCopy(copyGroup[index - bounded.size()], copyToGroup[index - bounded.size()]));
+    }
+    std::vector<uint32_t> order(m_bounded.size());
+    std::iota(order.begin(), order.end(), 0u);
+    m_bvh.assign(m_bvh.getNodes(), std::move(order), static_cast<uint32_t>(m_bounded.size()));
+}
+
+uint32_t CompiledScene::add(const IPrimitive* primitive)
+{
+    // Classement fait une fois par image : plus aucun appel virtuel pour les types connus
+    PrimitiveType type = OTHER;
+    if (auto sphere = dynamic_cast<const Sphere*>(primitive)) {
+        type = SPHERE;
+        m_sphereCenter.push_back(sphere->getCenter());
+        m_sphereRadius.push_back(sphere->getRadius());
+    } else if (auto plane = dynamic_cast<const Plane*>(primitive)) {
+        type = PLANE;
+        m_planeNormal.push_back(plane->getNormal(Vector3(0.0f, 0.0f, 0.0f)));
+        m_planeDistance.push_back(plane->getDistance());
+    } else if (auto triangle = dynamic_cast<const Triangle*>(primitive)) {
+        type = TRIANGLE;
+        // Mêmes opérations que le constructeur de Triangle : résultats identiques au bit près
+        Vector3 edge1 = triangle->getVertex(1) - triangle->getVertex(0);
+        Vector3 edge2 = triangle->getVertex(2) - triangle->getVertex(0);
+        m_triangleA.push_back(triangle->getVertex(0));
+        m_triangleEdge1.push_back(edge1);
+        m_triangleEdge2.push_back(edge2);
+        m_triangleNormal.push_back(triangle->getNormal(triangle->getVertex(0)));
+    } else if (auto cylinder = dynamic_cast<const Cylinder*>(primitive)) {
+        type = CYLINDER;
+        m_cylinders.push_back(cylinder);
+    } else if (auto cone = dynamic_cast<const Cone*>(primitive)) {
+        type = CONE;
+        m_cones.push_back(cone);
+    } else if (auto torus = dynamic_cast<const Torus*>(primitive)) {
+        type = TORUS;
+        m_tori.push_back(torus);
+    } else if (auto tangleCube = dynamic_cast<const TangleCube*>(primitive)) {
+        type = TANGLECUBE;
+        m_tangleCubes.push_back(tangleCube);
+    } else if (auto mesh = dynamic_cast<const TriangleMesh*>(primitive)) {
+        type = MESH;
+        m_meshes.push_back(mesh);
+    } else if (auto instance = dynamic_cast<const MeshInstance*>(primitive)) {
+        type = INSTANCE;
+        m_instances.push_back(instance);
+    } else {
+        m_others.push_back(primitive);
+    }
+    uint32_t index = static_cast<uint32_t>(m_source[type].size());
+    m_source[type].push_back(primitive);
+    m_material[type].push_back(m_palette.add(primitive->getMaterial()));
+    return (static_cast<uint32_t>(type) << TYPE_SHIFT) | index;
+}
+
+uint32_t CompiledScene::addCopy(uint32_t group, const Transform& toGroup)
+{
+    uint32_t index = static_cast<uint32_t>(m_copyGroup.size());
+    m_copyGroup.push_back(group);
+    m_copyToGroup.push_back(toGroup);
+    return (static_cast<uint32_t>(GROUP) << TYPE_SHIFT) | index;
+}
+
+std::vector<AABB> CompiledScene::compileGroups(const std::vector<PrimitiveGroup>& groups)
+{
+    std::vector<AABB> bounds;
+    for (const PrimitiveGroup& group : groups) {
+        auto compiled = std::make_unique<CompiledScene>(group.primitives);
+        // Un plan n'a pas de boîte : ses copies ne pourraient pas entrer dans la BVH
+        if (!compiled->m_unbounded.empty())
+            throw GlobalException("CompiledScene: group '" + group.name + "' holds an unbounded primitive");
+        // Palette du groupe reportée dans celle de la scène : les records sortent avec un index global
+        std::vector<uint16_t> materials;
+        for (size_t i = 0; i < compiled->m_palette.getSize(); ++i)
+            materials.push_back(m_palette.add(compiled->m_palette, static_cast<uint16_t>(i)));
+        bounds.push_back(compiled->m_bvh.getBounds());
+        m_groupMaterials.push_back(std::move(materials));
+        m_groups.push_back(std::move(compiled));
+    }
+    return bounds;
+}
+
+void CompiledScene::toWorld(uint32_t copy, const Ray& ray, float t, HitRecord& hit) const
+{
+    hit.t = t;
+    hit.point = ray.at(t);
+    // Normale par la transposée de l'inverse
+    hit.normal = m_copyToGroup[copy].applyTransposed(hit.normal).normalized();
+    hit.material = m_groupMaterials[m_copyGroup[copy]][hit.material];
+}
+
+size_t CompiledScene::getCount(PrimitiveType type) const
+{
+    if (type == GROUP)
+        return m_copyGroup.size();
+    return type < TYPE_COUNT ? m_source[type].size() : 0;
+}
+
+size_t CompiledScene::getCount() const
+{
+    return m_bounded.size() + m_unbounded.size();
+}
+
+size_t CompiledScene::getGroupCount() const
+{
+    return m_groups.size();
+}
+
+bool CompiledScene::intersectOne(uint32_t reference, const Ray& ray, HitRecord& hit) const
+{
+    const uint32_t type = reference >> TYPE_SHIFT;
+    const uint32_t index = reference & INDEX_MASK;
+    float t = 0.0f, u, v;
+    bool found;
+    countTests(type, 1);
+    switch (type) {
+    case SPHERE:
+        found = Sphere::hitDistance(m_sphereCenter[index], m_sphereRadius[index], ray, t);
+        if (found) {
+            hit.point = ray.at(t);
+            hit.normal = (hit.point - m_sphereCenter[index]).normalized();
+        }
+        break;
+    case PLANE:
+        found = Plane::hitDistance(m_planeNormal[index], m_planeDistance[index], ray, t);
+        if (found) {
+            hit.point = ray.at(t);
+            hit.normal = m_planeNormal[index];
+        }
+        break;
+    case TRIANGLE:
+        found = Triangle::hitDistance(ray, m_triangleA[index], m_triangleEdge1[index], m_triangleEdge2[index], t, u, v);
+        if (found) {
+            hit.point = ray.at(t);
+            hit.normal = m_triangleNormal[index];
+            hit.u = u;
+            hit.v = v;
+        }
+        break;
+    case CYLINDER:
+        found = intersectShape(m_cylinders[index], ray, hit);
+        break;
+    case CONE:
+        found = intersectShape(m_cones[index], ray, hit);
+        break;
+    case TORUS:
+        found = intersectShape(m_tori[index], ray, hit);
+        break;
+    case TANGLECUBE:
+        found = intersectShape(m_tangleCubes[index], ray, hit);
+        break;
+    case MESH:
+        found = m_meshes[index]->intersect(ray, hit);
+        break;
+    case INSTANCE:
+        found = m_instances[index]->intersect(ray, hit);
+        break;
+    case GROUP: {
+        float scale;
+        if (!m_groups[m_copyGroup[index]]->intersect(m_copyToGroup[index].applyToRay(ray, scale), hit))
+            return false;
+        toWorld(index, ray, hit.t / scale, hit);
+        return true;
+    }
+    default:
+        found = m_others[index]->intersect(ray, hit);
+        break;
+    }
+    if (!found)
+        return false;
+    if (type <= TRIANGLE) {
+        hit.t = t;
+        hit.primitive = m_source[type][index];
+        hit.hasUV = type == TRIANGLE;
+    }
+    hit.material = m_material[type][index];
+    return true;
+}
+
+bool CompiledScene::occludesOne(uint32_t reference, const Ray& ray, float tMax) const
+{
+    const uint32_t index = reference & INDEX_MASK;
+    float t, u, v;
+    countTests(reference >> TYPE_SHIFT, 1);
+    switch (reference >> TYPE_SHIFT) {
+    case SPHERE:
+        return Sphere::hitDistance(m_sphereCenter[index], m_sphereRadius[index], ray, t) && t > EPSILON && t < tMax;
+    case PLANE:
+        return Plane::hitDistance(m_planeNormal[index], m_planeDistance[index], ray, t) && t > EPSILON && t < tMax;
+    case TRIANGLE:
+        return Triangle::hitDistance(ray, m_triangleA[index], m_triangleEdge1[index], m_triangleEdge2[index], t, u, v)
+            && t > EPSILON && t < tMax;
+    case CYLINDER:
+        return occludesShape(m_cylinders[index], ray, tMax);
+    case CONE:
+        return occludesShape(m_cones[index], ray, tMax);
+    case TORUS:
+        return occludesShape(m_tori[index], ray, tMax);
+    case TANGLECUBE:
+        return occludesShape(m_tangleCubes[index], ray, tMax);
+    case MESH:
+        return m_meshes[index]->occludes(ray, tMax);
+    case INSTANCE:
+        return m_instances[index]->occludes(ray, tMax);
+    case GROUP: {
+        float scale;
+        Ray local = m_copyToGroup[index].applyToRay(ray, scale);
+        return m_groups[m_copyGroup[index]]->occludes(local, tMax * scale);
+    }
+    default:
+        return m_others[index]->occludes(ray, tMax);
+    }
+}
+
+void CompiledScene::intersectPacketOne(uint32_t reference, const RayPacket& packet, uint32_t mask, PacketHit& hits) const
+{
+    const uint32_t type = reference >> TYPE_SHIFT;
+    const uint32_t index = reference & INDEX_MASK;
+    if (type == GROUP)
+        return intersectPacketCopy(index, packet, mask, hits);
+    const uint16_t material = m_material[type][index];
+    uint32_t closer;
+    countTests(type, std::popcount(mask));
+    FloatV u, v;
+    switch (type) {
+    case SPHERE:
+        closer = hits.closer(Sphere::packetDistance(packet, m_sphereCenter[index], m_sphereRadius[index]), mask, EPSILON);
+        break;
+    case PLANE:
+        closer = hits.closer(Plane::packetDistance(packet, m_planeNormal[index], m_planeDistance[index]), mask, EPSILON);
+        break;
+    case TRIANGLE:
+        closer = hits.closer(intersectTrianglePacket(packet, m_triangleA[index], m_triangleEdge1[index],
+            m_triangleEdge2[index], u, v), mask, EPSILON);
+        break;
+    case CYLINDER:
+        return intersectPacketShape(m_cylinders[index], material, packet, mask, hits);
+    case CONE:
+        return intersectPacketShape(m_cones[index], material, packet, mask, hits);
+    case TORUS:
+        return intersectPacketShape(m_tori[index], material, packet, mask, hits);
+    case TANGLECUBE:
+        return intersectPacketShape(m_tangleCubes[index], material, packet, mask, hits);
+    case MESH:
+        return intersectPacketWith(m_meshes[index], material, packet, mask, hits);
+    case INSTANCE:
+        return intersectPacketWith(m_instances[index], material, packet, mask, hits);
+    default:
+        return intersectPacketWith(m_others[index], material, packet, mask, hits);
+    }
+    if (closer == 0)
+        return;
+    float us[PACKET_SIZE], vs[PACKET_SIZE];
+    if (type == TRIANGLE) {
+        u.store(us);
+        v.store(vs);
+    }
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        if (!(closer & (1u << i)))
+            continue;
+        HitRecord& hit = hits.records[i];
+        hit.t = hits.t[i];
+        hit.point = packet.rays[i].at(hit.t);
+        hit.primitive = m_source[type][index];
+        hit.material = material;
+        hit.hasUV = type == TRIANGLE;
+        if (type == SPHERE) {
+            hit.normal = (hit.point - m_sphereCenter[index]).normalized();
+        } else if (type == PLANE) {
+            hit.normal = m_planeNormal[index];
+        } else {
+            hit.normal = m_triangleNormal[index];
+            hit.u = us[i];
+            hit.v = vs[i];
+        }
+    }
+}
+
+uint32_t CompiledScene::occludesPacketOne(uint32_t reference, const RayPacket& packet, uint32_t mask, const float* tMax) const
+{
+    const uint32_t index = reference & INDEX_MASK;
+    FloatV t, u, v;
+    countTests(reference >> TYPE_SHIFT, std::popcount(mask));
+    switch (reference >> TYPE_SHIFT) {
+    case SPHERE:
+        t = Sphere::packetDistance(packet, m_sphereCenter[index], m_sphereRadius[index]);
+        break;
+    case PLANE:
+        t = Plane::packetDistance(packet, m_planeNormal[index], m_planeDistance[index]);
+        break;
+    case TRIANGLE:
+        t = intersectTrianglePacket(packet, m_triangleA[index], m_triangleEdge1[index], m_triangleEdge2[index], u, v);
+        break;
+    case CYLINDER:
+        return occludesPacketShape(m_cylinders[index], packet, mask, tMax);
+    case CONE:
+        return occludesPacketShape(m_cones[index], packet, mask, tMax);
+    case TORUS:
+        return occludesPacketShape(m_tori[index], packet, mask, tMax);
+    case TANGLECUBE:
+        return occludesPacketShape(m_tangleCubes[index], packet, mask, tMax);
+    case MESH:
+        return m_meshes[index]->occludesPacket(packet, mask, tMax);
+    case INSTANCE:
+        return m_instances[index]->occludesPacket(packet, mask, tMax);
+    case GROUP: {
+        float scale[PACKET_SIZE];
+        float bounds[PACKET_SIZE] = {};
+        const RayPacket local = m_copyToGroup[index].applyToPacket(packet, mask, scale);
+        for (int i = 0; i < PACKET_SIZE; ++i) {
+            if (mask & (1u << i))
+                bounds[i] = tMax[i] * scale[i];
+        }
+        return m_groups[m_copyGroup[index]]->occludesPacket(local, mask, bounds);
+    }
+    default:
+        return m_others[index]->occludesPacket(packet, mask, tMax);
+    }
+    return movemask((t > FloatV::broadcast(EPSILON)) & (t < FloatV::load(tMax)) & laneMask(mask));
+}
+
+void CompiledScene::intersectPacketCopy(uint32_t copy, const RayPacket& packet, uint32_t mask, PacketHit& hits) const
+{
+    float scale[PACKET_SIZE];
+    const RayPacket local = m_copyToGroup[copy].applyToPacket(packet, mask, scale);
+    PacketHit localHits;
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        if (mask & (1u << i))
+            localHits.t[i] = hits.t[i] * scale[i];
+    }
+    m_groups[m_copyGroup[copy]]->intersectPacket(local, mask, localHits);
+    // Seules les voies rapprochées par le groupe ont un record rempli
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        if (!(mask & (1u << i)) || !localHits.records[i].primitive)
+            continue;
+        const float t = localHits.t[i] / scale[i];
+        if (t <= EPSILON || t >= hits.t[i])
+            continue;
+        hits.records[i] = localHits.records[i];
+        toWorld(copy, packet.rays[i], t, hits.records[i]);
+        hits.t[i] = t;
+    }
+}
+
+bool CompiledScene::intersect(const Ray& ray, HitRecord& hit) const
+{
+    float closestT = std::numeric_limits<float>::infinity();
+    bool found = false;
+
+    // Chaque candidat remplit son propre record, seul le plus proche est conservé
+    auto testPrimitive = [&](uint32_t reference, float& tMax) {
+        HitRecord candidate;
+        if (intersectOne(reference, ray, candidate) && candidate.t > EPSILON && candidate.t < tMax) {
+            tMax = candidate.t;
+            hit = candidate;
+            found = true;
+            return true;
+        }
+        return false;
+    };
+
+    for (uint32_t reference : m_unbounded)
+        testPrimitive(reference, closestT);
+    m_bvh.intersect(ray, closestT, [&](uint32_t slot, float& tMax) {
+        return testPrimitive(m_bounded[slot], tMax);
+    });
+    return found;
+}
+
+bool CompiledScene::occludes(const Ray& ray, float tMax) const
+{
+    for (uint32_t reference : m_unbounded) {
+        if (occludesOne(reference, ray, tMax))
+            return true;
+    }
+    return m_bvh.occluded(ray, tMax, [&](uint32_t slot) {
+        return occludesOne(m_bounded[slot], ray, tMax);
+    });
+}
+
+void CompiledScene::intersectPacket(const RayPacket& packet, uint32_t mask, PacketHit& hits) const
+{
+    if (!packet.isCoherent(mask)) {
+        // Rayons trop divergents pour partager la BVH : un parcours par rayon
+        for (int i = 0; i < PACKET_SIZE; ++i) {
+            HitRecord record;
+            if ((mask & (1u << i)) && intersect(packet.rays[i], record) && record.t < hits.t[i]) {
+                hits.t[i] = record.t;
+                hits.records[i] = record;
+            }
+        }
+        return;
+    }
+    for (uint32_t reference : m_unbounded)
+        intersectPacketOne(reference, packet, mask, hits);
+    m_bvh.intersectPacket(packet, mask, hits.t, [&](uint32_t slot, uint32_t lanes) {
+        intersectPacketOne(m_bounded[slot], packet, lanes, hits);
+    });
+}
+
+uint32_t CompiledScene::occludesPacket(const RayPacket& packet, uint32_t mask, const float* tMax) const
+{
+    uint32_t occluded = 0;
+    if (!packet.isCoherent(mask)) {
+        for (int i = 0; i < PACKET_SIZE; ++i) {
+            if ((mask & (1u << i)) && occludes(packet.rays[i], tMax[i]))
+                occluded |= 1u << i;
+        }
+        return occluded;
+    }
+    for (uint32_t reference : m_unbounded) {
+        occluded |= occludesPacketOne(reference, packet, mask & ~occluded, tMax);
+        if (occluded == mask)
+            return occluded;
+    }
+    return occluded | m_bvh.occludedPacket(packet, mask & ~occluded, tMax, [&](uint32_t slot, uint32_t lanes) {
+        return occludesPacketOne(m_bounded[slot], packet, lanes, tMax);
+    });
+}
+
+}
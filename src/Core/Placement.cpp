@@ -0,0 +1,121 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** Placement
+*/
+
+#include "Core/Placement.hpp"
+#include "GlobalException.hpp"
+
+namespace Raytracer {
+
+// SplitMix64 : chaque appel fait avancer l'état et renvoie un mélange de ses bits
+static uint64_t nextRandom(uint64_t& state)
+{
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// Réel uniforme dans [low, high], tiré des 24 bits de poids fort
+static float uniform(uint64_t& state, float low, float high)
+{
+    return low + (high - low) * static_cast<float>(nextRandom(state) >> 40) * (1.0f / 16777216.0f);
+}
+
+Placement::Placement(size_t group, const Transform& transform)
+    : m_kind(SINGLE), m_group(group), m_transform(transform), m_counts{1, 1, 1}, m_spacing(0.0f, 0.0f, 0.0f), m_seed(0),
+      m_min(0.0f, 0.0f, 0.0f), m_max(0.0f, 0.0f, 0.0f), m_rotation(0.0f, 0.0f, 0.0f), m_minScale(1.0f), m_maxScale(1.0f)
+{
+}
+
+Placement Placement::makeGrid(size_t group, const Transform& transform, int countX, int countY, int countZ,
+    const Vector3& spacing)
+{
+    if (countX < 0 || countY < 0 || countZ < 0)
+        throw GlobalException("Placement: grid counts must not be negative");
+    if (!isGridSizeValid(countX, countY, countZ))
+        throw GlobalException("Placement: grid of " + std::to_string(countX) + "x" + std::to_string(countY) + "x"
+            + std::to_string(countZ) + " copies exceeds " + std::to_string(MAX_COUNT));
+    Placement grid(group, transform);
+    grid.m_kind = GRID;
+    grid.m_counts[0] = static_cast<size_t>(countX);
+    grid.m_counts[1] = static_cast<size_t>(countY);
+    grid.m_counts[2] = static_cast<size_t>(countZ);
+    grid.m_spacing = spacing;
+    return grid;
+}
+
+bool Placement::isGridSizeValid(int countX, int countY, int countZ)
+{
+    if (countX == 0 || countY == 0 || countZ == 0)
+        return true;
+    // Chaque facteur tient sur 31 bits : le premier produit ne peut pas déborder, le second est borné avant
+    const uint64_t plane = static_cast<uint64_t>(countX) * static_cast<uint64_t>(countY);
+    return plane <= MAX_COUNT && plane * static_cast<uint64_t>(countZ) <= MAX_COUNT;
+}
+
+Placement Placement::makeScatter(size_t group, int count, uint64_t seed, const Vector3& min, const Vector3& max,
+    const Vector3& rotation, float minScale, float maxScale)
+{
+    if (count < 0)
+        throw GlobalException("Placement: scatter count must not be negative");
+    if (!(minScale > 0.0f) || !(maxScale > 0.0f))
+        throw GlobalException("Placement: scatter scales must be positive");
+    Placement scatter(group, Transform());
+    scatter.m_kind = SCATTER;
+    scatter.m_counts[0] = static_cast<size_t>(count);
+    scatter.m_seed = seed;
+    scatter.m_min = min;
+    scatter.m_max = max;
+    scatter.m_rotation = rotation;
+    scatter.m_minScale = minScale;
+    scatter.m_maxScale = maxScale;
+    return scatter;
+}
+
+Placement::Kind Placement::getKind() const
+{
+    return m_kind;
+}
+
+size_t Placement::getGroup() const
+{
+    return m_group;
+}
+
+size_t Placement::getCount() const
+{
+    switch (m_kind) {
+    case GRID:
+        return m_counts[0] * m_counts[1] * m_counts[2];
+    case SCATTER:
+        return m_counts[0];
+    default:
+        return 1;
+    }
+}
+
+Transform Placement::getTransform(size_t index) const
+{
+    if (m_kind == GRID) {
+        const size_t x = index % m_counts[0];
+        const size_t y = index / m_counts[0] % m_counts[1];
+        const size_t z = index / (m_counts[0] * m_counts[1]);
+        Vector3 step(m_spacing.x * x, m_spacing.y * y, m_spacing.z * z);
+        return m_transform * Transform::fromPlacement(1.0f, Vector3(0.0f, 0.0f, 0.0f), step);
+    }
+    if (m_kind == SCATTER) {
+        // État propre à chaque copie : le tirage ne dépend pas de l'ordre de génération
+        uint64_t state = m_seed ^ (static_cast<uint64_t>(index) * 0xD1B54A32D192ED03ull);
+        nextRandom(state);
+        Vector3 position(uniform(state, m_min.x, m_max.x), uniform(state, m_min.y, m_max.y), uniform(state, m_min.z, m_max.z));
+        Vector3 rotation(uniform(state, 0.0f, m_rotation.x), uniform(state, 0.0f, m_rotation.y), uniform(state, 0.0f, m_rotation.z));
+        return Transform::fromPlacement(uniform(state, m_minScale, m_maxScale), rotation, position);
+    }
+    return m_transform;
+}
+
+}
@@ -6,6 +6,7 @@
 */
 
 #include "Core/Scene.hpp"
+#include <utility>
 #include "Factory/PrimitiveFactory.hpp"
 #include "Factory/LightFactory.hpp"
 
@@ -45,11 +46,48 @@ const std::vector<std::shared_ptr<Raytracer::IPrimitive>>& Raytracer::Scene::get
     return m_primitives;
 }
 
-std::shared_ptr<Raytracer::CompositePrimitive> Raytracer::Scene::getRootCompositePrimitive() const
+size_t Raytracer::Scene::addGroup(const std::string& name, std::vector<std::shared_ptr<IPrimitive>> primitives)
+{
+    m_groups.push_back(PrimitiveGroup{name, std::move(primitives)});
+    return m_groups.size() - 1;
+}
+
+bool Raytracer::Scene::findGroup(const std::string& name, size_t& index) const
+{
+    for (size_t i = 0; i < m_groups.size(); ++i) {
+        if (m_groups[i].name == name) {
+            index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+const std::vector<Raytracer::PrimitiveGroup>& Raytracer::Scene::getGroups() const
+{
+    return m_groups;
+}
+
+void Raytracer::Scene::addPlacement(const Placement& placement)
+{
+    m_placements.push_back(placement);
+}
+
+const std::vector<Raytracer::Placement>& Raytracer::Scene::getPlacements() const
+{
+    return m_placements;
+}
+
+const std::shared_ptr<Raytracer::CompositePrimitive>& Raytracer::Scene::getRootCompositePrimitive() const
 {
     return m_rootCompositePrimitive;
 }
 
+Raytracer::CompiledScene Raytracer::Scene::compile() const
+{
+    return CompiledScene(m_primitives, m_groups, m_placements);
+}
+
 void Raytracer::Scene::addLight(std::shared_ptr<ILight> light)
 {
     // Ajouter à la fois au composite racine et à la liste des lumières
@@ -62,6 +100,11 @@ const std::vector<std::shared_ptr<Raytracer::ILight>>& Raytracer::Scene::getLigh
     return m_lights;
 }
 
+Raytracer::LightTable Raytracer::Scene::createLightTable() const
+{
+    return LightTable(m_lights);
+}
+
 std::shared_ptr<Raytracer::CompositeLight> Raytracer::Scene::getRootCompositeLight() const
 {
     return m_rootCompositeLight;
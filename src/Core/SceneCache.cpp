@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** SceneCache
+*/
+
+#include "Core/SceneCache.hpp"
+#include <system_error>
+#include "GlobalException.hpp"
+#include "Parser/SceneParser.hpp"
+#include "Utils/RenderStats.hpp"
+
+namespace Raytracer {
+
+std::shared_ptr<const PreparedScene> SceneCache::get(const std::string& filename, bool& reused)
+{
+    std::error_code error;
+    std::filesystem::path absolute = std::filesystem::absolute(filename, error);
+    const std::string key = error ? filename : absolute.lexically_normal().string();
+    auto found = m_entries.find(key);
+    if (found != m_entries.end() && isFresh(found->second)) {
+        reused = true;
+        return found->second.scene;
+    }
+    // Entrée périmée retirée avant le rechargement : un échec ne laisse pas l'ancienne scène.
+    // Elle reste en vie jusqu'à la fin du chargement pour que MeshCache reprenne ses maillages.
+    std::shared_ptr<const PreparedScene> previous;
+    if (found != m_entries.end()) {
+        previous = found->second.scene;
+        m_entries.erase(found);
+    }
+    reused = false;
+
+    // Dates relevées avant la lecture : un fichier modifié pendant le chargement sera relu la fois suivante
+    Entry entry;
+    entry.files.emplace_back(filename, std::filesystem::last_write_time(filename, error));
+    if (error)
+        throw GlobalException("SceneCache: cannot read " + filename + ": " + error.message());
+    auto prepared = std::make_shared<PreparedScene>();
+    SceneParser parser(filename, prepared->scene);
+    {
+        RenderStats::ScopedPhase phase(RenderStats::PARSE);
+        if (!parser.parse())
+            throw GlobalException("SceneCache: failed to parse " + filename);
+    }
+    for (size_t i = 1; i < parser.getFiles().size(); ++i) {
+        const std::string& file = parser.getFiles()[i];
+        entry.files.emplace_back(file, std::filesystem::last_write_time(file, error));
+        if (error)
+            throw GlobalException("SceneCache: cannot read " + file + ": " + error.message());
+    }
+    {
+        RenderStats::ScopedPhase phase(RenderStats::BUILD);
+        prepared->lights = std::make_shared<const LightTable>(prepared->scene.createLightTable());
+        prepared->geometry = std::make_shared<const CompiledScene>(prepared->scene.compile());
+    }
+    entry.scene = std::move(prepared);
+    return m_entries.emplace(key, std::move(entry)).first->second.scene;
+}
+
+bool SceneCache::isFresh(const Entry& entry)
+{
+    for (const auto& [file, time] : entry.files) {
+        std::error_code error;
+        if (std::filesystem::last_write_time(file, error) != time || error)
+            return false;
+    }
+    return true;
+}
+
+void SceneCache::clear()
+{
+    m_entries.clear();
+}
+
+size_t SceneCache::getSize() const
+{
+    return m_entries.size();
+}
+
+}
@@ -9,10 +9,12 @@
 #include "Material/Material.hpp"
 #include "Primitives/Cone.hpp"
 #include "Primitives/Cylinder.hpp"
+#include "Primitives/MeshInstance.hpp"
 #include "Primitives/Plane.hpp"
 #include "Primitives/Torus.hpp"
 #include "Primitives/Sphere.hpp"
 #include "Primitives/Triangle.hpp"
+#include "Primitives/TriangleMesh.hpp"
 #include "Primitives/Torus.hpp"
 #include "Primitives/TangleCube.hpp"
 #include "Primitives/CompositePrimitive.hpp"
@@ -37,6 +39,14 @@ std::shared_ptr<Raytracer::IPrimitive> Raytracer::PrimitiveFactory::createTriang
   return std::make_shared<Triangle>(a, b, c, material);
 }
 
+std::shared_ptr<Raytracer::IPrimitive> Raytracer::PrimitiveFactory::createTriangleMesh(std::vector<Vector3> vertices, std::vector<uint32_t> indices, const Material& material) {
+  return std::make_shared<TriangleMesh>(std::move(vertices), std::move(indices), material);
+}
+
+std::shared_ptr<Raytracer::IPrimitive> Raytracer::PrimitiveFactory::createMeshInstance(std::shared_ptr<const TriangleMesh> mesh, const Transform& transform, const Material& material) {
+  return std::make_shared<MeshInstance>(std::move(mesh), transform, material);
+}
+
 std::shared_ptr<Raytracer::IPrimitive> Raytracer::PrimitiveFactory::createTorus(const Vector3& center, float majorRadius, float minorRadius, const Vector3& rotation, const Material& material)
 {
     return std::make_shared<Torus>(center, majorRadius, minorRadius, rotation, material);
@@ -0,0 +1,44 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** LightTable
+*/
+
+#include "Lights/LightTable.hpp"
+#include <utility>
+#include "Lights/AmbientLight.hpp"
+#include "Lights/CompositeLight.hpp"
+#include "Lights/DirectionalLight.hpp"
+#include "Lights/PointLight.hpp"
+
+Raytracer::LightTable::LightTable(const std::vector<std::shared_ptr<ILight>>& lights) {
+  // Classement fait une fois par image : plus aucun dynamic_cast pendant l'éclairage
+  std::vector<float> pointIntensity, directionalIntensity, otherIntensity;
+  for (const auto& light : lights) {
+    if (dynamic_cast<const AmbientLight*>(light.get())) {
+      m_ambient += light->getIntensity();
+    } else if (dynamic_cast<const CompositeLight*>(light.get())) {
+      continue;
+    } else if (auto point = dynamic_cast<const PointLight*>(light.get())) {
+      Vector3 position = point->getPosition();
+      m_pointX.push_back(position.x);
+      m_pointY.push_back(position.y);
+      m_pointZ.push_back(position.z);
+      pointIntensity.push_back(point->getIntensity());
+    } else if (dynamic_cast<const DirectionalLight*>(light.get())) {
+      Vector3 direction = light->getDirectionFrom(Vector3(0.0f, 0.0f, 0.0f)).normalized();
+      m_directionX.push_back(direction.x);
+      m_directionY.push_back(direction.y);
+      m_directionZ.push_back(direction.z);
+      directionalIntensity.push_back(light->getIntensity());
+    } else {
+      m_others.push_back(light.get());
+      otherIntensity.push_back(light->getIntensity());
+    }
+  }
+  m_intensity = std::move(pointIntensity);
+  m_intensity.insert(m_intensity.end(), directionalIntensity.begin(), directionalIntensity.end());
+  m_intensity.insert(m_intensity.end(), otherIntensity.begin(), otherIntensity.end());
+}
+
@@ -16,6 +16,11 @@ Raytracer::Vector3 Raytracer::PointLight::getDirectionFrom(const Vector3 &point)
     return (m_position - point).normalized();
 }
 
+float Raytracer::PointLight::getDistanceFrom(const Vector3 &point) const
+{
+    return (m_position - point).length();
+}
+
 float Raytracer::PointLight::getIntensity() const
 {
     return m_intensity;
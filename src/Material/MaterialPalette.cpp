@@ -0,0 +1,87 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** MaterialPalette
+*/
+
+#include "Material/MaterialPalette.hpp"
+#include <string>
+#include "GlobalException.hpp"
+
+uint16_t Raytracer::MaterialPalette::add(const Material& material) {
+  const Color& color = material.getColor();
+  Key key(material.getType(), color.getR(), color.getG(), color.getB(), material.getRoughness(), material.getMetalness(),
+    material.getReflectivity(), material.getTransparency(), material.getRefractiveIndex(), material.getEmissiveIntensity());
+  auto found = m_lookup.find(key);
+  if (found != m_lookup.end())
+    return found->second;
+
+  // Termes d'ombrage calculés en double une fois pour toutes, comme le faisait chaque impact
+  Entry entry;
+  entry.red = static_cast<float>(color.getR());
+  entry.green = static_cast<float>(color.getG());
+  entry.blue = static_cast<float>(color.getB());
+  entry.shininess = 64.0f;
+  entry.specular = 0.1f;
+  if (material.getType() == Material::METAL) {
+    entry.shininess = static_cast<float>(128.0f - material.getRoughness() * 120.0f);
+    entry.specular = 0.2f;
+  }
+  entry.reflectance = getReflectance(material);
+  entry.emission = 0.0f;
+  if (material.getType() == Material::EMISSIVE && material.getEmissiveIntensity() > 0)
+    entry.emission = static_cast<float>(material.getEmissiveIntensity());
+  entry.type = material.getType();
+
+  Properties properties;
+  properties.roughness = static_cast<float>(material.getRoughness());
+  properties.metalness = static_cast<float>(material.getMetalness());
+  properties.reflectivity = static_cast<float>(material.getReflectivity());
+  properties.transparency = static_cast<float>(material.getTransparency());
+  properties.refractiveIndex = static_cast<float>(material.getRefractiveIndex());
+  properties.emissiveIntensity = static_cast<float>(material.getEmissiveIntensity());
+  return insert(key, entry, properties);
+}
+
+uint16_t Raytracer::MaterialPalette::add(const MaterialPalette& other, uint16_t index) {
+  const Key& key = other.m_keys[index];
+  auto found = m_lookup.find(key);
+  if (found != m_lookup.end())
+    return found->second;
+  return insert(key, other.m_entries[index], other.m_properties[index]);
+}
+
+uint16_t Raytracer::MaterialPalette::insert(const Key& key, const Entry& entry, const Properties& properties) {
+  if (m_entries.size() >= MAX_SIZE)
+    throw GlobalException("MaterialPalette: More than " + std::to_string(MAX_SIZE) + " distinct materials");
+  uint16_t index = static_cast<uint16_t>(m_entries.size());
+  m_entries.push_back(entry);
+  m_properties.push_back(properties);
+  m_keys.push_back(key);
+  m_lookup.emplace(key, index);
+  return index;
+}
+
+Raytracer::Material Raytracer::MaterialPalette::getMaterial(uint16_t index) const {
+  const Entry& entry = m_entries[index];
+  const Properties& properties = m_properties[index];
+  Material material(entry.type, Color(static_cast<int>(entry.red), static_cast<int>(entry.green), static_cast<int>(entry.blue)));
+  material.setRoughness(properties.roughness);
+  material.setMetalness(properties.metalness);
+  material.setReflectivity(properties.reflectivity);
+  material.setTransparency(properties.transparency);
+  material.setRefractiveIndex(properties.refractiveIndex);
+  material.setEmissiveIntensity(properties.emissiveIntensity);
+  return material;
+}
+
+size_t Raytracer::MaterialPalette::getSize() const {
+  return m_entries.size();
+}
+
+float Raytracer::MaterialPalette::getReflectance(const Material& material) {
+  if (material.getType() == Material::METAL)
+    return 0.8f - material.getRoughness() * 0.6f;
+  return material.getReflectivity();
+}
@@ -7,6 +7,9 @@
 
 #include "Maths/Ray.hpp"
 
+Raytracer::Ray::Ray()
+    : m_origin(0, 0, 0), m_direction(0, 0, 1) {}
+
 Raytracer::Ray::Ray(const Vector3 &origin, const Vector3 &direction)
     : m_origin(origin), m_direction(direction.normalized()) {}
 
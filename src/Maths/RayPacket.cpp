@@ -0,0 +1,57 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** RayPacket
+*/
+
+#include "Maths/RayPacket.hpp"
+
+namespace Raytracer {
+
+RayPacket::RayPacket(const Ray* source, int count)
+{
+    float values[9][PACKET_SIZE];
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        if (i < count)
+            rays[i] = source[i];
+        const Vector3& origin = rays[i].getOrigin();
+        const Vector3& dir = rays[i].getDirection();
+        values[0][i] = origin.x;
+        values[1][i] = origin.y;
+        values[2][i] = origin.z;
+        values[3][i] = dir.x;
+        values[4][i] = dir.y;
+        values[5][i] = dir.z;
+        values[6][i] = 1.0f / dir.x;
+        values[7][i] = 1.0f / dir.y;
+        values[8][i] = 1.0f / dir.z;
+        octants[i] = static_cast<uint8_t>((dir.x < 0.0f) | ((dir.y < 0.0f) << 1) | ((dir.z < 0.0f) << 2));
+    }
+    ox = FloatV::load(values[0]);
+    oy = FloatV::load(values[1]);
+    oz = FloatV::load(values[2]);
+    dx = FloatV::load(values[3]);
+    dy = FloatV::load(values[4]);
+    dz = FloatV::load(values[5]);
+    invDx = FloatV::load(values[6]);
+    invDy = FloatV::load(values[7]);
+    invDz = FloatV::load(values[8]);
+}
+
+bool RayPacket::isCoherent(uint32_t mask) const
+{
+    int active = 0;
+    int octant = -1;
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        if (!(mask & (1u << i)))
+            continue;
+        if (octant >= 0 && octants[i] != octant)
+            return false;
+        octant = octants[i];
+        ++active;
+    }
+    return active >= MIN_COHERENT_RAYS;
+}
+
+}
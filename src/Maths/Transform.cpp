@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** Transform
+*/
+
+#include "Maths/Transform.hpp"
+#include <cmath>
+#include "GlobalException.hpp"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace Raytracer {
+
+Transform::Transform()
+    : m_rows{Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f)}, m_translation(0.0f, 0.0f, 0.0f)
+{
+}
+
+Transform::Transform(const Vector3& row0, const Vector3& row1, const Vector3& row2, const Vector3& translation)
+    : m_rows{row0, row1, row2}, m_translation(translation)
+{
+}
+
+Transform Transform::fromPlacement(float scale, const Vector3& rotation, const Vector3& offset)
+{
+    const float radX = rotation.x * M_PI / 180.0f;
+    const float radY = rotation.y * M_PI / 180.0f;
+    const float radZ = rotation.z * M_PI / 180.0f;
+    const float cx = std::cos(radX), sx = std::sin(radX);
+    const float cy = std::cos(radY), sy = std::sin(radY);
+    const float cz = std::cos(radZ), sz = std::sin(radZ);
+    // Rz * Ry * Rx * scale, comme ObjParser qui tourne autour de X, puis Y, puis Z
+    return Transform(
+        Vector3(cz * cy, cz * sy * sx - sz * cx, cz * sy * cx + sz * sx) * scale,
+        Vector3(sz * cy, sz * sy * sx + cz * cx, sz * sy * cx - cz * sx) * scale,
+        Vector3(-sy, cy * sx, cy * cx) * scale,
+        offset);
+}
+
+RayPacket Transform::applyToPacket(const RayPacket& packet, uint32_t mask, float* scale) const
+{
+    Ray rays[PACKET_SIZE];
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        if (mask & (1u << i))
+            rays[i] = applyToRay(packet.rays[i], scale[i]);
+    }
+    return RayPacket(rays, PACKET_SIZE);
+}
+
+AABB Transform::applyToBox(const AABB& box) const
+{
+    AABB result;
+    if (box.isEmpty())
+        return result;
+    for (int corner = 0; corner < 8; ++corner) {
+        result.expand(applyToPoint(Vector3(corner & 1 ? box.max.x : box.min.x, corner & 2 ? box.max.y : box.min.y,
+            corner & 4 ? box.max.z : box.min.z)));
+    }
+    return result;
+}
+
+Transform Transform::operator*(const Transform& other) const
+{
+    // Colonnes de l'autre matrice : les lignes de la composée sont nos lignes appliquées à ces colonnes
+    const Vector3 columns[3] = {other.applyToVector(Vector3(1.0f, 0.0f, 0.0f)),
+        other.applyToVector(Vector3(0.0f, 1.0f, 0.0f)), other.applyToVector(Vector3(0.0f, 0.0f, 1.0f))};
+    Vector3 rows[3];
+    for (int i = 0; i < 3; ++i)
+        rows[i] = Vector3(m_rows[i].dot(columns[0]), m_rows[i].dot(columns[1]), m_rows[i].dot(columns[2]));
+    return Transform(rows[0], rows[1], rows[2], applyToPoint(other.m_translation));
+}
+
+Transform Transform::inverse() const
+{
+    // Inverse par la comatrice : les colonnes de l'inverse sont les produits vectoriels des lignes
+    const Vector3 c0 = m_rows[1].cross(m_rows[2]);
+    const Vector3 c1 = m_rows[2].cross(m_rows[0]);
+    const Vector3 c2 = m_rows[0].cross(m_rows[1]);
+    const float determinant = m_rows[0].dot(c0);
+    if (std::abs(determinant) < 1e-12f)
+        throw GlobalException("Transform: singular matrix cannot be inverted");
+    const float inv = 1.0f / determinant;
+    Transform result(Vector3(c0.x, c1.x, c2.x) * inv, Vector3(c0.y, c1.y, c2.y) * inv, Vector3(c0.z, c1.z, c2.z) * inv,
+        Vector3(0.0f, 0.0f, 0.0f));
+    result.m_translation = result.applyToVector(m_translation) * -1.0f;
+    return result;
+}
+
+const Vector3& Transform::getRow(int index) const
+{
+    return m_rows[index];
+}
+
+const Vector3& Transform::getTranslation() const
+{
+    return m_translation;
+}
+
+}
@@ -0,0 +1,278 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** MeshCache
+*/
+
+#include "Parser/MeshCache.hpp"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <unistd.h>
+#include "GlobalException.hpp"
+#include "Parser/ObjParser.hpp"
+#include "Utils/MappedFile.hpp"
+#include "Utils/RenderStats.hpp"
+
+namespace Raytracer {
+
+    static constexpr char CACHE_MAGIC[8] = {'R', 'T', 'M', 'E', 'S', 'H', '\0', '\0'};
+    static constexpr uint32_t CACHE_VERSION = 1;
+
+    /**
+     * @brief Fixed-size header at the start of every cache file
+     */
+    struct MeshCacheHeader {
+        char magic[8];          ///< CACHE_MAGIC
+        uint32_t version;       ///< CACHE_VERSION
+        uint32_t nodeSize;      ///< sizeof(BVH::Node), guards against layout changes
+        uint64_t key;           ///< MeshCache::computeKey() of the source
+        uint64_t vertexCount;   ///< Number of vertices
+        uint64_t indexCount;    ///< Number of triangle indices
+        uint64_t nodeCount;     ///< Number of BVH nodes, 0 if no hierarchy is stored
+        uint64_t bvhIndexCount; ///< Number of BVH leaf indices
+    };
+
+    static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 must be three packed floats");
+
+    static size_t align16(size_t size)
+    {
+        return (size + 15) & ~static_cast<size_t>(15);
+    }
+
+    // Hachage FNV-1a par mots de 8 octets, avec repliement pour mélanger les bits hauts
+    static uint64_t hashBytes(uint64_t hash, const void *data, size_t size)
+    {
+        constexpr uint64_t PRIME = 0x100000001b3ULL;
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            uint64_t word;
+            std::memcpy(&word, bytes + i, sizeof(word));
+            hash = (hash ^ word) * PRIME;
+            hash ^= hash >> 32;
+        }
+        for (; i < size; ++i)
+            hash = (hash ^ bytes[i]) * PRIME;
+        return hash;
+    }
+
+    std::string MeshCache::s_directory = MeshCache::DEFAULT_DIRECTORY;
+    bool MeshCache::s_memoryEnabled = false;
+    std::map<std::string, MeshCache::MemoryEntry> MeshCache::s_memory;
+    std::mutex MeshCache::s_memoryMutex;
+
+    void MeshCache::setDirectory(const std::string &directory)
+    {
+        s_directory = directory;
+    }
+
+    const std::string &MeshCache::getDirectory()
+    {
+        return s_directory;
+    }
+
+    void MeshCache::setMemoryCache(bool enabled)
+    {
+        std::lock_guard<std::mutex> lock(s_memoryMutex);
+        s_memoryEnabled = enabled;
+        if (!enabled)
+            s_memory.clear();
+    }
+
+    size_t MeshCache::getMemoryCount()
+    {
+        std::lock_guard<std::mutex> lock(s_memoryMutex);
+        pruneMemory();
+        return s_memory.size();
+    }
+
+    void MeshCache::pruneMemory()
+    {
+        std::erase_if(s_memory, [](const auto &entry) { return entry.second.data.expired(); });
+    }
+
+    uint64_t MeshCache::computeKey(std::string_view content, float scale, const Vector3 &offset, const Vector3 &rotation)
+    {
+        const float transform[7] = {scale, offset.x, offset.y, offset.z, rotation.x, rotation.y, rotation.z};
+        const uint64_t sizes[3] = {CACHE_VERSION, sizeof(BVH::Node), content.size()};
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        hash = hashBytes(hash, sizes, sizeof(sizes));
+        hash = hashBytes(hash, transform, sizeof(transform));
+        return hashBytes(hash, content.data(), content.size());
+    }
+
+    std::string MeshCache::getCachePath(const std::string &filename, uint64_t key)
+    {
+        char hex[17];
+        std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(key));
+        std::string stem = std::filesystem::path(filename).stem().string();
+        return (std::filesystem::path(s_directory) / (stem + "-" + hex + ".mesh")).string();
+    }
+
+    std::shared_ptr<TriangleMesh> MeshCache::loadObj(const std::string &filename, float scale, const Vector3 &offset, const Vector3 &rotation, const Material &material)
+    {
+        RenderStats::ScopedPhase phase(RenderStats::OBJ_LOAD);
+        std::unique_lock<std::mutex> lock(s_memoryMutex);
+        if (!s_memoryEnabled) {
+            lock.unlock();
+            return loadFile(filename, scale, offset, rotation, material);
+        }
+        // Clé mémoire : chemin et transformation ; la date et la taille disent si le fichier a changé
+        const float transform[7] = {scale, offset.x, offset.y, offset.z, rotation.x, rotation.y, rotation.z};
+        char hex[17];
+        std::snprintf(hex, sizeof(hex), "%016llx",
+            static_cast<unsigned long long>(hashBytes(0xcbf29ce484222325ULL, transform, sizeof(transform))));
+        std::error_code error;
+        const std::filesystem::file_time_type time = std::filesystem::last_write_time(filename, error);
+        const uintmax_t size = error ? 0 : std::filesystem::file_size(filename, error);
+        if (error) {
+            lock.unlock();
+            return loadFile(filename, scale, offset, rotation, material);
+        }
+        const std::string key = filename + "#" + hex;
+        auto found = s_memory.find(key);
+        if (found != s_memory.end() && found->second.time == time && found->second.size == size) {
+            // Tableaux et BVH partagés : seul le matériau peut différer
+            if (std::shared_ptr<const MeshData> data = found->second.data.lock())
+                return std::make_shared<TriangleMesh>(std::move(data), material);
+        }
+        pruneMemory();
+        // Verrou relâché pendant la lecture : deux fils chargeant le même fichier le liront chacun
+        lock.unlock();
+        auto mesh = loadFile(filename, scale, offset, rotation, material);
+        lock.lock();
+        if (s_memoryEnabled)
+            s_memory.insert_or_assign(key, MemoryEntry{time, size, mesh->getData()});
+        return mesh;
+    }
+
+    std::shared_ptr<TriangleMesh> MeshCache::loadFile(const std::string &filename, float scale, const Vector3 &offset, const Vector3 &rotation, const Material &material)
+    {
+        if (s_directory.empty()) {
+            ParsedMesh parsed = ObjParser::loadMesh(filename, scale, offset, rotation);
+            return std::make_shared<TriangleMesh>(std::move(parsed.vertices), std::move(parsed.indices), material);
+        }
+
+        uint64_t key;
+        {
+            MappedFile source(filename);
+            key = computeKey(source.view(), scale, offset, rotation);
+        }
+        std::string path = getCachePath(filename, key);
+        if (auto mesh = read(path, key, material))
+            return mesh;
+
+        ParsedMesh parsed = ObjParser::loadMesh(filename, scale, offset, rotation);
+        auto mesh = std::make_shared<TriangleMesh>(std::move(parsed.vertices), std::move(parsed.indices), material);
+        if (!write(path, key, *mesh))
+            std::cerr << "MeshCache: could not write " << path << std::endl;
+        return mesh;
+    }
+
+    std::shared_ptr<TriangleMesh> MeshCache::read(const std::string &path, uint64_t key, const Material &material)
+    {
+        try {
+            if (!std::filesystem::exists(path))
+                return nullptr;
+            MappedFile file(path);
+            MeshCacheHeader header;
+            if (file.size() < sizeof(header))
+                return nullptr;
+            std::memcpy(&header, file.data(), sizeof(header));
+            if (std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || header.version != CACHE_VERSION
+                || header.nodeSize != sizeof(BVH::Node) || header.key != key)
+                return nullptr;
+
+            // Les tailles sont vérifiées avant toute copie : un fichier tronqué est ignoré
+            const uint64_t limit = file.size();
+            if (header.vertexCount > limit / sizeof(Vector3) || header.indexCount > limit / sizeof(uint32_t)
+                || header.nodeCount > limit / sizeof(BVH::Node) || header.bvhIndexCount > limit / sizeof(uint32_t))
+                return nullptr;
+            size_t vertexOffset = align16(sizeof(header));
+            size_t indexOffset = align16(vertexOffset + header.vertexCount * sizeof(Vector3));
+            size_t nodeOffset = align16(indexOffset + header.indexCount * sizeof(uint32_t));
+            size_t bvhIndexOffset = align16(nodeOffset + header.nodeCount * sizeof(BVH::Node));
+            size_t end = bvhIndexOffset + header.bvhIndexCount * sizeof(uint32_t);
+            if (end != file.size())
+                return nullptr;
+
+            std::vector<Vector3> vertices(header.vertexCount);
+            std::vector<uint32_t> indices(header.indexCount);
+            std::memcpy(vertices.data(), file.data() + vertexOffset, vertices.size() * sizeof(Vector3));
+            std::memcpy(indices.data(), file.data() + indexOffset, indices.size() * sizeof(uint32_t));
+            if (header.nodeCount == 0)
+                return std::make_shared<TriangleMesh>(std::move(vertices), std::move(indices), material);
+
+            std::vector<BVH::Node> nodes(header.nodeCount);
+            std::vector<uint32_t> bvhIndices(header.bvhIndexCount);
+            std::memcpy(nodes.data(), file.data() + nodeOffset, nodes.size() * sizeof(BVH::Node));
+            std::memcpy(bvhIndices.data(), file.data() + bvhIndexOffset, bvhIndices.size() * sizeof(uint32_t));
+            BVH bvh;
+            if (!bvh.assign(std::move(nodes), std::move(bvhIndices), static_cast<uint32_t>(indices.size() / 3)))
+                return nullptr;
+            return std::make_shared<TriangleMesh>(std::move(vertices), std::move(indices), material, std::move(bvh));
+        } catch (const GlobalException &) {
+            return nullptr;
+        } catch (const std::filesystem::filesystem_error &) {
+            return nullptr;
+        }
+    }
+
+    bool MeshCache::write(const std::string &path, uint64_t key, const TriangleMesh &mesh)
+    {
+        std::error_code error;
+        std::filesystem::create_directories(s_directory, error);
+        if (error)
+            return false;
+
+        const auto &vertices = mesh.getVertices();
+        const auto &indices = mesh.getIndices();
+        const auto &nodes = mesh.getBVH().getNodes();
+        const auto &bvhIndices = mesh.getBVH().getIndices();
+        MeshCacheHeader header;
+        std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+        header.version = CACHE_VERSION;
+        header.nodeSize = sizeof(BVH::Node);
+        header.key = key;
+        header.vertexCount = vertices.size();
+        header.indexCount = indices.size();
+        header.nodeCount = nodes.size();
+        header.bvhIndexCount = bvhIndices.size();
+
+        // Écriture dans un fichier temporaire puis renommage : un lecteur ne voit jamais un fichier partiel
+        std::string tmpPath = path + ".tmp" + std::to_string(getpid());
+        {
+            std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!out.is_open())
+                return false;
+            const char padding[16] = {};
+            size_t written = 0;
+            auto put = [&](const void *data, size_t size) {
+                out.write(padding, align16(written) - written);
+                written = align16(written);
+                out.write(static_cast<const char *>(data), size);
+                written += size;
+            };
+            put(&header, sizeof(header));
+            put(vertices.data(), vertices.size() * sizeof(Vector3));
+            put(indices.data(), indices.size() * sizeof(uint32_t));
+            put(nodes.data(), nodes.size() * sizeof(BVH::Node));
+            put(bvhIndices.data(), bvhIndices.size() * sizeof(uint32_t));
+            if (!out.good()) {
+                out.close();
+                std::filesystem::remove(tmpPath, error);
+                return false;
+            }
+        }
+        std::filesystem::rename(tmpPath, path, error);
+        if (error) {
+            std::filesystem::remove(tmpPath, error);
+            return false;
+        }
+        return true;
+    }
+
+}
@@ -7,9 +7,12 @@
 
 #include "Parser/ObjParser.hpp"
 #include "GlobalException.hpp"
-#include <fstream>
-#include <sstream>
+#include "Utils/MappedFile.hpp"
+#include <charconv>
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <thread>
 #include <future>
@@ -22,135 +25,280 @@
 
 namespace Raytracer {
 
-    inline Vector3 applyRotation(const Vector3 &point, const Vector3 &rotation)
+    // Taille minimale d'une tranche de fichier confiée à un thread
+    static constexpr size_t MIN_CHUNK_SIZE = 256 * 1024;
+
+    /**
+     * @brief Sines and cosines of the model rotation, computed once per file
+     */
+    struct ObjRotation {
+        float cosX, sinX, cosY, sinY, cosZ, sinZ;
+
+        explicit ObjRotation(const Vector3 &rotation)
+        {
+            const float radX = rotation.x * M_PI / 180.0f;
+            const float radY = rotation.y * M_PI / 180.0f;
+            const float radZ = rotation.z * M_PI / 180.0f;
+            cosX = std::cos(radX); sinX = std::sin(radX);
+            cosY = std::cos(radY); sinY = std::sin(radY);
+            cosZ = std::cos(radZ); sinZ = std::sin(radZ);
+        }
+    };
+
+    inline Vector3 applyRotation(const Vector3 &point, const ObjRotation &r)
     {
-        const float radX = rotation.x * M_PI / 180.0f;
-        const float radY = rotation.y * M_PI / 180.0f;
-        const float radZ = rotation.z * M_PI / 180.0f;
-        float cosX = std::cos(radX), sinX = std::sin(radX);
-        float cosY = std::cos(radY), sinY = std::sin(radY);
-        float cosZ = std::cos(radZ), sinZ = std::sin(radZ);
         Vector3 p = point;
-        float y1 = p.y * cosX - p.z * sinX;
-        float z1 = p.y * sinX + p.z * cosX;
+        float y1 = p.y * r.cosX - p.z * r.sinX;
+        float z1 = p.y * r.sinX + p.z * r.cosX;
         p.y = y1; p.z = z1;
-        float x2 = p.x * cosY + p.z * sinY;
-        float z2 = -p.x * sinY + p.z * cosY;
+        float x2 = p.x * r.cosY + p.z * r.sinY;
+        float z2 = -p.x * r.sinY + p.z * r.cosY;
         p.x = x2; p.z = z2;
-        float x3 = p.x * cosZ - p.y * sinZ;
-        float y3 = p.x * sinZ + p.y * cosZ;
+        float x3 = p.x * r.cosZ - p.y * r.sinZ;
+        float y3 = p.x * r.sinZ + p.y * r.cosZ;
         p.x = x3; p.y = y3;
         return p;
     }
 
-    std::vector<ParsedTriangle> ObjParser::loadFromFile(const std::string &filename, float scale, const Vector3 &offset, const Vector3 &rotation)
+    /**
+     * @brief Result of parsing one slice of the file
+     *
+     * Face indices stay as read (zero-based, unchecked) until every slice is
+     * done, since a face may use vertices declared in a later slice.
+     */
+    struct ObjChunk {
+        std::vector<Vector3> vertices;
+        std::vector<int> triangles;
+    };
+
+    // Mêmes séparateurs que l'extraction d'un std::istringstream
+    static inline bool isBlank(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    static inline const char *skipBlanks(const char *p, const char *end)
+    {
+        while (p < end && isBlank(*p))
+            ++p;
+        return p;
+    }
+
+    /**
+     * @brief Exact fast path for plain decimal numbers (Clinger)
+     *
+     * With at most 15 significant digits and |exponent| <= 22, mantissa and power
+     * of ten are exact doubles, so one division or multiplication gives the
+     * correctly rounded double. Rounding that double to float gives the correctly
+     * rounded float, unless it falls exactly halfway between two floats: such
+     * numbers, like any other unusual syntax, are left to std::from_chars.
+     */
+    static inline bool parseFloatFast(const char *&p, const char *end, float &value)
     {
-        std::ifstream file(filename);
-        if (!file.is_open())
-            throw GlobalException("ObjParser: Failed to open file: " + filename);
-        std::vector<std::string> lines;
-        std::string line;
-        while (std::getline(file, line)) {
-            if (!line.empty() && line[0] != '#')
-                lines.push_back(std::move(line));
+        static constexpr double POW10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+        const char *q = p;
+        bool negative = q < end && *q == '-';
+        if (negative)
+            ++q;
+        uint64_t mantissa = 0;
+        int digits = 0, exponent = 0;
+        bool any = false;
+        for (; q < end && *q >= '0' && *q <= '9'; ++q, any = true) {
+            if (mantissa || *q != '0')
+                digits++;
+            mantissa = mantissa * 10 + (*q - '0');
         }
-        file.close();
-        std::vector<size_t> vertexLineIndices;
-        std::vector<const char*> faceLines;
-        for (size_t i = 0; i < lines.size(); ++i) {
-            const std::string &l = lines[i];
-            if (l.size() > 1 && l[0] == 'v' && l[1] == ' ')
-                vertexLineIndices.push_back(i);
-            else if (l.size() > 1 && l[0] == 'f' && l[1] == ' ')
-                faceLines.push_back(l.c_str());
+        if (q < end && *q == '.') {
+            for (++q; q < end && *q >= '0' && *q <= '9'; ++q, any = true) {
+                if (mantissa || *q != '0')
+                    digits++;
+                mantissa = mantissa * 10 + (*q - '0');
+                exponent--;
+            }
         }
-        size_t vertexCount = vertexLineIndices.size();
-        std::vector<Vector3> vertices(vertexCount);
+        if (!any || digits > 15)
+            return false;
+        if (q < end && (*q == 'e' || *q == 'E')) {
+            const char *e = q + 1;
+            bool expNegative = e < end && *e == '-';
+            if (e < end && (*e == '-' || *e == '+'))
+                ++e;
+            if (e >= end || *e < '0' || *e > '9')
+                return false;
+            int exp = 0;
+            for (; e < end && *e >= '0' && *e <= '9' && exp < 1000; ++e)
+                exp = exp * 10 + (*e - '0');
+            exponent += expNegative ? -exp : exp;
+            q = e;
+        }
+        if (q < end && ((*q >= '0' && *q <= '9') || *q == '.' || *q == 'e' || *q == 'E'))
+            return false;
+        if (exponent < -22 || exponent > 22)
+            return false;
+        double d = static_cast<double>(mantissa);
+        d = exponent < 0 ? d / POW10[-exponent] : d * POW10[exponent];
+        // Milieu exact entre deux floats : les 29 bits perdus valent 1000...0
+        uint64_t bits;
+        std::memcpy(&bits, &d, sizeof(bits));
+        if ((bits & 0x1FFFFFFF) == 0x10000000)
+            return false;
+        value = static_cast<float>(negative ? -d : d);
+        p = q;
+        return true;
+    }
+
+    // Équivalent de "iss >> value" : en cas d'échec la valeur n'est pas lue
+    static inline bool parseFloat(const char *&p, const char *end, float &value)
+    {
+        p = skipBlanks(p, end);
+        if (p < end && *p == '+')
+            ++p;
+        if (parseFloatFast(p, end, value))
+            return true;
+        auto [ptr, ec] = std::from_chars(p, end, value);
+        if (ec != std::errc())
+            return false;
+        p = ptr;
+        return true;
+    }
+
+    // Équivalent de std::stoi sur la partie d'un jeton "v/vt/vn" avant le premier '/'
+    // (from_chars s'arrête de lui-même sur le '/')
+    static inline bool parseIndex(const char *begin, const char *end, int &value)
+    {
+        if (begin < end && *begin == '+')
+            ++begin;
+        auto [ptr, ec] = std::from_chars(begin, end, value);
+        return ec == std::errc() && ptr != begin;
+    }
+
+    static void parseVertexLine(const char *p, const char *end, float scale, const Vector3 &offset, const ObjRotation &rotation, std::vector<Vector3> &vertices)
+    {
+        float x = 0, y = 0, z = 0;
+        if (parseFloat(p, end, x) && parseFloat(p, end, y))
+            parseFloat(p, end, z);
+        Vector3 v(x * scale, y * scale, z * scale);
+        vertices.push_back(applyRotation(v, rotation) + offset);
+    }
+
+    // Les polygones sont découpés en éventail : (0, j, j + 1)
+    static void parseFaceLine(const char *p, const char *end, size_t chunk, std::vector<int> &triangles)
+    {
+        int first = 0, previous = 0;
+        size_t count = 0;
+        while (true) {
+            p = skipBlanks(p, end);
+            if (p >= end)
+                break;
+            const char *tokenEnd = p;
+            while (tokenEnd < end && !isBlank(*tokenEnd))
+                ++tokenEnd;
+            int idx;
+            if (!parseIndex(p, tokenEnd, idx)) {
+                std::cerr << "[Thread " << chunk << "] Invalid face token: " << std::string_view(p, tokenEnd - p) << "\n";
+                p = tokenEnd;
+                continue;
+            }
+            p = tokenEnd;
+            idx -= 1;
+            if (count == 0) {
+                first = idx;
+            } else if (count >= 2) {
+                triangles.push_back(first);
+                triangles.push_back(previous);
+                triangles.push_back(idx);
+            }
+            previous = idx;
+            ++count;
+        }
+    }
+
+    static void parseChunk(const char *begin, const char *end, size_t chunk, float scale, const Vector3 &offset, const ObjRotation &rotation, ObjChunk &result)
+    {
+        const char *line = begin;
+        while (line < end) {
+            const char *lineEnd = static_cast<const char *>(std::memchr(line, '\n', end - line));
+            if (!lineEnd)
+                lineEnd = end;
+            if (lineEnd - line > 1 && line[1] == ' ') {
+                if (line[0] == 'v')
+                    parseVertexLine(line + 2, lineEnd, scale, offset, rotation, result.vertices);
+                else if (line[0] == 'f')
+                    parseFaceLine(line + 2, lineEnd, chunk, result.triangles);
+            }
+            line = lineEnd + 1;
+        }
+    }
+
+    std::vector<ParsedTriangle> ObjParser::loadFromFile(const std::string &filename, float scale, const Vector3 &offset, const Vector3 &rotation)
+    {
+        ParsedMesh mesh = loadMesh(filename, scale, offset, rotation);
+        std::vector<ParsedTriangle> triangles;
+        triangles.reserve(mesh.indices.size() / 3);
+        for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3)
+            triangles.push_back(ParsedTriangle{mesh.vertices[mesh.indices[i]], mesh.vertices[mesh.indices[i + 1]], mesh.vertices[mesh.indices[i + 2]]});
+        return triangles;
+    }
+
+    ParsedMesh ObjParser::loadMesh(const std::string &filename, float scale, const Vector3 &offset, const Vector3 &rotation)
+    {
+        MappedFile file(filename);
+        const char *data = file.data();
+        const char *end = data + file.size();
+        ObjRotation objRotation(rotation);
+
+        // Découpe du fichier en tranches qui commencent toutes en début de ligne
         unsigned int threadCount = std::thread::hardware_concurrency();
         if (threadCount == 0) threadCount = 4;
-        size_t vertexChunkSize = (vertexCount + threadCount - 1) / threadCount;
-        std::vector<std::future<void>> vertexFutures;
-        for (size_t t = 0; t < threadCount; ++t) {
-            size_t start = t * vertexChunkSize;
-            size_t end = std::min(start + vertexChunkSize, vertexCount);
-            vertexFutures.emplace_back(std::async(std::launch::async, [&, start, end, t]() {
-                for (size_t i = start; i < end; ++i) {
-                    if (i >= vertexLineIndices.size()) {
-                        std::cerr << "[Thread " << t << "] Invalid vertexLineIndices index: " << i << "\n";
-                        continue;
-                    }
-                    size_t lineIndex = vertexLineIndices[i];
-                    if (lineIndex >= lines.size()) {
-                        std::cerr << "[Thread " << t << "] Line index out of range: " << lineIndex << "\n";
-                        continue;
-                    }
-                    const char* vLine = lines[lineIndex].c_str() + 2;
-                    std::istringstream iss(vLine);
-                    float x = 0, y = 0, z = 0;
-                    iss >> x >> y >> z;
-                    Vector3 v(x * scale, y * scale, z * scale);
-                    v = applyRotation(v, rotation) + offset;
-                    if (i >= vertices.size()) {
-                        std::cerr << "[Thread " << t << "] Vertex index out of range on write: " << i << "\n";
-                        continue;
-                    }
-                    vertices[i] = v;
-                }
+        size_t chunkCount = std::clamp<size_t>(file.size() / MIN_CHUNK_SIZE, 1, threadCount);
+        std::vector<const char *> bounds(chunkCount + 1, end);
+        bounds[0] = data;
+        for (size_t t = 1; t < chunkCount; ++t) {
+            const char *cut = std::max(bounds[t - 1], data + file.size() * t / chunkCount);
+            const char *newline = static_cast<const char *>(std::memchr(cut, '\n', end - cut));
+            bounds[t] = newline ? newline + 1 : end;
+        }
+
+        std::vector<ObjChunk> chunks(chunkCount);
+        std::vector<std::future<void>> futures;
+        for (size_t t = 1; t < chunkCount; ++t) {
+            futures.emplace_back(std::async(std::launch::async, [&, t]() {
+                parseChunk(bounds[t], bounds[t + 1], t, scale, offset, objRotation, chunks[t]);
             }));
         }
-        for (auto &f : vertexFutures) f.get();
-        std::vector<std::vector<ParsedTriangle>> threadTriangles(threadCount);
-        size_t faceCount = faceLines.size();
-        size_t faceChunkSize = (faceCount + threadCount - 1) / threadCount;
-        std::vector<std::future<void>> faceFutures;
-        for (size_t t = 0; t < threadCount; ++t) {
-            size_t start = t * faceChunkSize;
-            size_t end = std::min(start + faceChunkSize, faceCount);
-            faceFutures.emplace_back(std::async(std::launch::async, [&, start, end, t]() {
-                std::vector<ParsedTriangle> &local = threadTriangles[t];
-                for (size_t i = start; i < end; ++i) {
-                    if (!faceLines[i]) {
-                        std::cerr << "[Thread " << t << "] Null face line pointer at " << i << "\n";
-                        continue;
-                    }
-                    const char* fLine = faceLines[i] + 2;
-                    std::istringstream iss(fLine);
-                    std::vector<int> indices;
-                    std::string token;
-                    while (iss >> token) {
-                        size_t pos = token.find('/');
-                        std::string idxStr = (pos == std::string::npos) ? token : token.substr(0, pos);
-                        try {
-                            int idx = std::stoi(idxStr) - 1;
-                            indices.push_back(idx);
-                        } catch (...) {
-                            std::cerr << "[Thread " << t << "] Invalid face token: " << token << "\n";
-                        }
-                    }
-                    if (indices.size() >= 3) {
-                        for (size_t j = 1; j + 1 < indices.size(); ++j) {
-                            int i0 = indices[0], i1 = indices[j], i2 = indices[j + 1];
-                            if (i0 < 0 || i1 < 0 || i2 < 0 ||
-                                i0 >= static_cast<int>(vertices.size()) ||
-                                i1 >= static_cast<int>(vertices.size()) ||
-                                i2 >= static_cast<int>(vertices.size())) {
-                                std::cerr << "[Thread " << t << "] Face index out of bounds: "
-                                          << i0 << ", " << i1 << ", " << i2 << "\n";
-                                continue;
-                            }
-                            local.emplace_back(ParsedTriangle{
-                                vertices[i0], vertices[i1], vertices[i2]
-                            });
-                        }
-                    }
+        parseChunk(bounds[0], bounds[1], 0, scale, offset, objRotation, chunks[0]);
+        for (auto &f : futures) f.get();
+
+        // Concaténation dans l'ordre du fichier, puis vérification des indices
+        ParsedMesh mesh;
+        size_t vertexCount = 0, indexCount = 0;
+        for (const auto &chunk : chunks) {
+            vertexCount += chunk.vertices.size();
+            indexCount += chunk.triangles.size();
+        }
+        mesh.vertices.reserve(vertexCount);
+        mesh.indices.reserve(indexCount);
+        for (const auto &chunk : chunks)
+            mesh.vertices.insert(mesh.vertices.end(), chunk.vertices.begin(), chunk.vertices.end());
+        for (size_t t = 0; t < chunkCount; ++t) {
+            const std::vector<int> &triangles = chunks[t].triangles;
+            for (size_t j = 0; j + 2 < triangles.size(); j += 3) {
+                int i0 = triangles[j], i1 = triangles[j + 1], i2 = triangles[j + 2];
+                if (i0 < 0 || i1 < 0 || i2 < 0 ||
+                    i0 >= static_cast<int>(vertexCount) ||
+                    i1 >= static_cast<int>(vertexCount) ||
+                    i2 >= static_cast<int>(vertexCount)) {
+                    std::cerr << "[Thread " << t << "] Face index out of bounds: "
+                              << i0 << ", " << i1 << ", " << i2 << "\n";
+                    continue;
                 }
-            }));
+                mesh.indices.push_back(static_cast<uint32_t>(i0));
+                mesh.indices.push_back(static_cast<uint32_t>(i1));
+                mesh.indices.push_back(static_cast<uint32_t>(i2));
+            }
         }
-        for (auto &f : faceFutures) f.get();
-        std::vector<ParsedTriangle> triangles;
-        for (auto &local : threadTriangles)
-            triangles.insert(triangles.end(), local.begin(), local.end());
-        return triangles;
+        return mesh;
     }
 
-}
\ No newline at end of file
+}
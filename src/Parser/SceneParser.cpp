@@ -6,13 +6,15 @@
 */
 
 #include "Parser/SceneParser.hpp"
+#include <algorithm>
 #include <limits>
+#include <map>
 #include <string>
 #include "Core/Camera.hpp"
 #include "Factory/LightFactory.hpp"
 #include "Factory/PrimitiveFactory.hpp"
 #include "GlobalException.hpp"
-#include "Parser/ObjParser.hpp"
+#include "Parser/MeshCache.hpp"
 #include "Primitives/Triangle.hpp"
 #include "Utils/Vector3.hpp"
 
@@ -21,12 +23,14 @@ Raytracer::SceneParser::SceneParser(const std::string &filename, Scene &scene) :
 
 bool Raytracer::SceneParser::parse() {
     try {
+        m_files.assign(1, m_filename);
         m_cfg.readFile(m_filename.c_str());
         const libconfig::Setting &root = m_cfg.getRoot();
         if (!parseCamera(root))
             throw GlobalException("[SceneParser] Failed to parse camera.");
         if (!parseLights(root))
             throw GlobalException("[SceneParser] Failed to parse lights.");
+        parseGroups(root);
         if (!parsePrimitives(root))
             throw GlobalException("[SceneParser] Failed to parse primitives.");
         return true;
@@ -38,6 +42,10 @@ bool Raytracer::SceneParser::parse() {
     return false;
 }
 
+const std::vector<std::string> &Raytracer::SceneParser::getFiles() const {
+    return m_files;
+}
+
 bool Raytracer::SceneParser::parseCamera(const libconfig::Setting &root) {
     try {
         const libconfig::Setting &cam = root.lookup("camera");
@@ -108,317 +116,473 @@ bool Raytracer::SceneParser::parsePrimitives(const libconfig::Setting &root) {
     if (!root.exists("primitives"))
       return true;
     const auto &prims = root.lookup("primitives");
-    if (prims.exists("spheres")) {
-      const auto &spheres = prims.lookup("spheres");
-      for (int i = 0; i < spheres.getLength(); ++i) {
-        const auto &s = spheres[i];
-        Vector3 center;
-        {
-          int xi, yi, zi;
-          float xf, yf, zf;
-          if (s.lookupValue("x", xi) && s.lookupValue("y", yi) && s.lookupValue("z", zi)) {
-            center = Vector3{(float)xi, (float)yi, (float)zi};
-          } else if (s.lookupValue("x", xf) && s.lookupValue("y", yf) && s.lookupValue("z", zf)) {
-            center = Vector3{xf, yf, zf};
-          } else {
-            throw GlobalException("Sphere #" + std::to_string(i) + " : position (x,y,z) invalide ou manquante");
-          }
-        }
-        float radius = 1.0f;
-        if (s.exists("r")) {
-          int ri;
-          float rf;
-          if (s.lookupValue("r", ri))
-            radius = (float)ri;
-          else if (s.lookupValue("r", rf))
-            radius = rf;
-          else
-            throw GlobalException("Sphere #" + std::to_string(i) + " : 'r' existe mais n'est ni int ni float");
+    std::vector<std::shared_ptr<IPrimitive>> shapes;
+    parseShapes(prims, shapes);
+    for (auto &shape : shapes)
+      m_scene.addPrimitive(shape);
+    parsePlacements(prims);
+    return true;
+  } catch (const libconfig::SettingException &e) {
+    throw GlobalException("[SceneParser] Error parsing primitives: " + std::string(e.what()));
+  }
+}
+
+// Groupes nommés : mêmes sections que "primitives", mais rien n'est ajouté à la scène
+// tant qu'un placement ne les copie pas
+void Raytracer::SceneParser::parseGroups(const libconfig::Setting &root) {
+  if (!root.exists("groups"))
+    return;
+  try {
+    const auto &groups = root.lookup("groups");
+    for (int i = 0; i < groups.getLength(); ++i) {
+      const auto &group = groups[i];
+      std::string name;
+      size_t existing;
+      if (!group.lookupValue("name", name))
+        throw GlobalException("Groupe #" + std::to_string(i) + " : champ 'name' manquant");
+      if (m_scene.findGroup(name, existing))
+        throw GlobalException("Groupe #" + std::to_string(i) + " : nom '" + name + "' déjà utilisé");
+      std::vector<std::shared_ptr<IPrimitive>> shapes;
+      parseShapes(group, shapes);
+      m_scene.addGroup(name, std::move(shapes));
+    }
+  } catch (const libconfig::SettingException &e) {
+    throw GlobalException("[SceneParser] Error parsing groups: " + std::string(e.what()));
+  }
+}
+
+// Placements des groupes : seuls les paramètres sont gardés, les copies sont générées à la compilation
+void Raytracer::SceneParser::parsePlacements(const libconfig::Setting &prims) {
+  if (prims.exists("instances")) {
+    const auto &instances = prims.lookup("instances");
+    for (int i = 0; i < instances.getLength(); ++i) {
+      const auto &inst = instances[i];
+      size_t group = findGroup(inst, "Instance #" + std::to_string(i));
+      Vector3 offset(0.0f, 0.0f, 0.0f);
+      Vector3 rotation(0.0f, 0.0f, 0.0f);
+      if (inst.exists("offset"))
+        offset = parseVector3(inst.lookup("offset"));
+      if (inst.exists("rotation"))
+        rotation = parseVector3(inst.lookup("rotation"));
+      m_scene.addPlacement(Placement(group, Transform::fromPlacement(parseNumber(inst, "scale", 1.0f), rotation, offset)));
+    }
+  }
+  if (prims.exists("grids")) {
+    const auto &grids = prims.lookup("grids");
+    for (int i = 0; i < grids.getLength(); ++i) {
+      const auto &grid = grids[i];
+      size_t group = findGroup(grid, "Grille #" + std::to_string(i));
+      int cx = 1, cy = 1, cz = 1;
+      Vector3 spacing(0.0f, 0.0f, 0.0f);
+      Vector3 offset(0.0f, 0.0f, 0.0f);
+      Vector3 rotation(0.0f, 0.0f, 0.0f);
+      if (!grid.exists("count"))
+        throw GlobalException("Grille #" + std::to_string(i) + " : champ 'count' manquant");
+      const auto &count = grid.lookup("count");
+      count.lookupValue("x", cx);
+      count.lookupValue("y", cy);
+      count.lookupValue("z", cz);
+      if (cx < 0 || cy < 0 || cz < 0)
+        throw GlobalException("Grille #" + std::to_string(i) + " : 'count' négatif");
+      if (!Placement::isGridSizeValid(cx, cy, cz))
+        throw GlobalException("Grille #" + std::to_string(i) + " : 'count' trop grand, "
+          + std::to_string(Placement::MAX_COUNT) + " copies au plus");
+      if (grid.exists("spacing"))
+        spacing = parseVector3(grid.lookup("spacing"));
+      if (grid.exists("offset"))
+        offset = parseVector3(grid.lookup("offset"));
+      if (grid.exists("rotation"))
+        rotation = parseVector3(grid.lookup("rotation"));
+      m_scene.addPlacement(Placement::makeGrid(group, Transform::fromPlacement(parseNumber(grid, "scale", 1.0f), rotation, offset),
+        cx, cy, cz, spacing));
+    }
+  }
+  if (prims.exists("scatters")) {
+    const auto &scatters = prims.lookup("scatters");
+    for (int i = 0; i < scatters.getLength(); ++i) {
+      const auto &scatter = scatters[i];
+      size_t group = findGroup(scatter, "Dispersion #" + std::to_string(i));
+      int count = 0;
+      long long seed = 0;
+      Vector3 min(0.0f, 0.0f, 0.0f);
+      Vector3 max(0.0f, 0.0f, 0.0f);
+      Vector3 rotation(0.0f, 0.0f, 0.0f);
+      if (!scatter.lookupValue("count", count))
+        throw GlobalException("Dispersion #" + std::to_string(i) + " : champ 'count' manquant");
+      if (!scatter.lookupValue("seed", seed)) {
+        int seedInt = 0;
+        scatter.lookupValue("seed", seedInt);
+        seed = seedInt;
+      }
+      if (scatter.exists("min"))
+        min = parseVector3(scatter.lookup("min"));
+      if (scatter.exists("max"))
+        max = parseVector3(scatter.lookup("max"));
+      if (scatter.exists("rotation"))
+        rotation = parseVector3(scatter.lookup("rotation"));
+      float minScale = parseNumber(scatter, "minScale", 1.0f);
+      float maxScale = parseNumber(scatter, "maxScale", minScale);
+      if (count < 0)
+        throw GlobalException("Dispersion #" + std::to_string(i) + " : 'count' négatif");
+      if (!(minScale > 0.0f) || !(maxScale > 0.0f))
+        throw GlobalException("Dispersion #" + std::to_string(i) + " : 'minScale' et 'maxScale' doivent être positifs");
+      m_scene.addPlacement(Placement::makeScatter(group, count, static_cast<uint64_t>(seed), min, max, rotation,
+        minScale, maxScale));
+    }
+  }
+}
+
+size_t Raytracer::SceneParser::findGroup(const libconfig::Setting &setting, const std::string &what) {
+  std::string name;
+  size_t index;
+  if (!setting.lookupValue("group", name))
+    throw GlobalException(what + " : champ 'group' manquant");
+  if (!m_scene.findGroup(name, index))
+    throw GlobalException(what + " : groupe '" + name + "' inconnu");
+  return index;
+}
+
+// Nombre écrit en entier ou en réel, valeur par défaut si absent
+float Raytracer::SceneParser::parseNumber(const libconfig::Setting &setting, const char *name, float fallback) {
+  int vi;
+  float vf;
+  if (setting.lookupValue(name, vi))
+    return static_cast<float>(vi);
+  if (setting.lookupValue(name, vf))
+    return vf;
+  return fallback;
+}
+
+// Formes d'une liste "primitives" ou d'un groupe, dans l'ordre des sections
+void Raytracer::SceneParser::parseShapes(const libconfig::Setting &prims, std::vector<std::shared_ptr<IPrimitive>> &shapes) {
+  if (prims.exists("spheres")) {
+    const auto &spheres = prims.lookup("spheres");
+    for (int i = 0; i < spheres.getLength(); ++i) {
+      const auto &s = spheres[i];
+      Vector3 center;
+      {
+        int xi, yi, zi;
+        float xf, yf, zf;
+        if (s.lookupValue("x", xi) && s.lookupValue("y", yi) && s.lookupValue("z", zi)) {
+          center = Vector3{(float)xi, (float)yi, (float)zi};
+        } else if (s.lookupValue("x", xf) && s.lookupValue("y", yf) && s.lookupValue("z", zf)) {
+          center = Vector3{xf, yf, zf};
         } else {
-          throw GlobalException("Sphere #" + std::to_string(i) + " : champ 'r' manquant");
-        }
-        int cr = 255, cg = 255, cb = 255;
-        if (s.exists("color")) {
-          const auto &col = s.lookup("color");
-          col.lookupValue("r", cr);
-          col.lookupValue("g", cg);
-          col.lookupValue("b", cb);
+          throw GlobalException("Sphere #" + std::to_string(i) + " : position (x,y,z) invalide ou manquante");
         }
-        m_scene.addPrimitive(PrimitiveFactory::createSphere(center, radius, parseMaterial(s, Color(cr, cg, cb))));
       }
+      float radius = 1.0f;
+      if (s.exists("r")) {
+        int ri;
+        float rf;
+        if (s.lookupValue("r", ri))
+          radius = (float)ri;
+        else if (s.lookupValue("r", rf))
+          radius = rf;
+        else
+          throw GlobalException("Sphere #" + std::to_string(i) + " : 'r' existe mais n'est ni int ni float");
+      } else {
+        throw GlobalException("Sphere #" + std::to_string(i) + " : champ 'r' manquant");
+      }
+      int cr = 255, cg = 255, cb = 255;
+      if (s.exists("color")) {
+        const auto &col = s.lookup("color");
+        col.lookupValue("r", cr);
+        col.lookupValue("g", cg);
+        col.lookupValue("b", cb);
+      }
+      shapes.push_back(PrimitiveFactory::createSphere(center, radius, parseMaterial(s, Color(cr, cg, cb))));
     }
-    if (prims.exists("planes")) {
-      const auto &planes = prims.lookup("planes");
-      for (int i = 0; i < planes.getLength(); ++i) {
-        const auto &p = planes[i];
-        std::string axis;
-        if (!p.lookupValue("axis", axis))
-          throw GlobalException("Plan #" + std::to_string(i) + " : champ 'axis' manquant");
-        char a = axis.empty() ? 'Y' : axis[0];
-        float pos = 0.0f;
-        {
-          int pi;
-          if (p.lookupValue("position", pi))
-            pos = (float)pi;
-          else if (p.lookupValue("position", pos)) { /* lu */
-          } else
-            throw GlobalException("Plan #" + std::to_string(i) + " : champ 'position' manquant");
-        }
-        int pr = 255, pg = 255, pb = 255;
-        if (p.exists("color")) {
-          const auto &col = p.lookup("color");
-          col.lookupValue("r", pr);
-          col.lookupValue("g", pg);
-          col.lookupValue("b", pb);
-        }
-        Vector3 normal;
-        switch (a) {
-          case 'X':
-          case 'x':
-            normal = {1, 0, 0};
-            break;
-          case 'Y':
-          case 'y':
-            normal = {0, 1, 0};
-            break;
-          case 'Z':
-          case 'z':
-            normal = {0, 0, 1};
-            break;
-          default:
-            throw GlobalException("Plan #" + std::to_string(i) + " : axe invalide '" + axis + "'");
-        }
-        m_scene.addPrimitive(PrimitiveFactory::createPlane(normal, pos, parseMaterial(p, Color(pr, pg, pb))));
+  }
+  if (prims.exists("planes")) {
+    const auto &planes = prims.lookup("planes");
+    for (int i = 0; i < planes.getLength(); ++i) {
+      const auto &p = planes[i];
+      std::string axis;
+      if (!p.lookupValue("axis", axis))
+        throw GlobalException("Plan #" + std::to_string(i) + " : champ 'axis' manquant");
+      char a = axis.empty() ? 'Y' : axis[0];
+      float pos = 0.0f;
+      {
+        int pi;
+        if (p.lookupValue("position", pi))
+          pos = (float)pi;
+        else if (p.lookupValue("position", pos)) { /* lu */
+        } else
+          throw GlobalException("Plan #" + std::to_string(i) + " : champ 'position' manquant");
       }
+      int pr = 255, pg = 255, pb = 255;
+      if (p.exists("color")) {
+        const auto &col = p.lookup("color");
+        col.lookupValue("r", pr);
+        col.lookupValue("g", pg);
+        col.lookupValue("b", pb);
+      }
+      Vector3 normal;
+      switch (a) {
+        case 'X':
+        case 'x':
+          normal = {1, 0, 0};
+          break;
+        case 'Y':
+        case 'y':
+          normal = {0, 1, 0};
+          break;
+        case 'Z':
+        case 'z':
+          normal = {0, 0, 1};
+          break;
+        default:
+          throw GlobalException("Plan #" + std::to_string(i) + " : axe invalide '" + axis + "'");
+      }
+      shapes.push_back(PrimitiveFactory::createPlane(normal, pos, parseMaterial(p, Color(pr, pg, pb))));
     }
-    if (prims.exists("tanglecubes")) {
-      const auto &tanglecubes = prims.lookup("tanglecubes");
-      for (int i = 0; i < tanglecubes.getLength(); ++i) {
-        const auto &tc = tanglecubes[i];
-        Vector3 center;
-        float size = 1.0f;
-        int tr = 255, tg = 255, tb = 255;
-        if (tc.exists("center")) {
-          center = parseVector3(tc.lookup("center"));
-        } else {
-          throw GlobalException("TangleCube #" + std::to_string(i) + " : champ 'center' manquant ou invalide");
-        }
-        if (tc.exists("size")) {
-          int si;
-          float sf;
-          if (tc.lookupValue("size", sf))
-            size = sf;
-          else if (tc.lookupValue("size", si))
-            size = static_cast<float>(si);
-          else
-            throw GlobalException("TangleCube #" + std::to_string(i) + " : champ 'size' invalide");
-        } else {
-          throw GlobalException("TangleCube #" + std::to_string(i) + " : champ 'size' manquant");
-        }
-        if (tc.exists("color")) {
-          const auto &col = tc.lookup("color");
-          col.lookupValue("r", tr);
-          col.lookupValue("g", tg);
-          col.lookupValue("b", tb);
-        }
-        m_scene.addPrimitive(PrimitiveFactory::createTangleCube(center, size, parseMaterial(tc, Color(tr, tg, tb))));
+  }
+  if (prims.exists("tanglecubes")) {
+    const auto &tanglecubes = prims.lookup("tanglecubes");
+    for (int i = 0; i < tanglecubes.getLength(); ++i) {
+      const auto &tc = tanglecubes[i];
+      Vector3 center;
+      float size = 1.0f;
+      int tr = 255, tg = 255, tb = 255;
+      if (tc.exists("center")) {
+        center = parseVector3(tc.lookup("center"));
+      } else {
+        throw GlobalException("TangleCube #" + std::to_string(i) + " : champ 'center' manquant ou invalide");
+      }
+      if (tc.exists("size")) {
+        int si;
+        float sf;
+        if (tc.lookupValue("size", sf))
+          size = sf;
+        else if (tc.lookupValue("size", si))
+          size = static_cast<float>(si);
+        else
+          throw GlobalException("TangleCube #" + std::to_string(i) + " : champ 'size' invalide");
+      } else {
+        throw GlobalException("TangleCube #" + std::to_string(i) + " : champ 'size' manquant");
+      }
+      if (tc.exists("color")) {
+        const auto &col = tc.lookup("color");
+        col.lookupValue("r", tr);
+        col.lookupValue("g", tg);
+        col.lookupValue("b", tb);
       }
+      shapes.push_back(PrimitiveFactory::createTangleCube(center, size, parseMaterial(tc, Color(tr, tg, tb))));
     }
-    if (prims.exists("cylinders")) {
-      const auto &cylinders = prims.lookup("cylinders");
-      for (int i = 0; i < cylinders.getLength(); ++i) {
-        const auto &c = cylinders[i];
-        Vector3 baseCenter;
-        Vector3 rotation(0, 0, 0);
-        float radius = 1.0f;
-        float height = std::numeric_limits<float>::infinity();
-        int cr = 255, cg = 255, cb = 255;
+  }
+  if (prims.exists("cylinders")) {
+    const auto &cylinders = prims.lookup("cylinders");
+    for (int i = 0; i < cylinders.getLength(); ++i) {
+      const auto &c = cylinders[i];
+      Vector3 baseCenter;
+      Vector3 rotation(0, 0, 0);
+      float radius = 1.0f;
+      float height = std::numeric_limits<float>::infinity();
+      int cr = 255, cg = 255, cb = 255;
 
-        if (c.exists("baseCenter")) {
-          baseCenter = parseVector3(c.lookup("baseCenter"));
-        } else {
-          throw GlobalException("Cylinder #" + std::to_string(i) + " : champ 'baseCenter' manquant ou invalide");
-        }
-        if (c.exists("radius")) {
-          int ri;
-          float rf;
-          if (c.lookupValue("radius", ri))
-            radius = static_cast<float>(ri);
-          else if (c.lookupValue("radius", rf))
-            radius = rf;
-          else
-            throw GlobalException("Cylinder #" + std::to_string(i) + " : champ 'radius' manquant ou invalide");
-        }
-        if (c.exists("height")) {
-          int hi;
-          float hf;
-          if (c.lookupValue("height", hi))
-            height = static_cast<float>(hi);
-          else if (c.lookupValue("height", hf))
-            height = hf;
-        }
-        if (c.exists("rotation")) {
-          rotation = parseVector3(c.lookup("rotation"));
-        }
-        if (c.exists("color")) {
-          const auto &col = c.lookup("color");
-          col.lookupValue("r", cr);
-          col.lookupValue("g", cg);
-          col.lookupValue("b", cb);
-        }
-        m_scene.addPrimitive(PrimitiveFactory::createCylinder(baseCenter, radius, height, rotation, parseMaterial(c, Color(cr, cg, cb))));
+      if (c.exists("baseCenter")) {
+        baseCenter = parseVector3(c.lookup("baseCenter"));
+      } else {
+        throw GlobalException("Cylinder #" + std::to_string(i) + " : champ 'baseCenter' manquant ou invalide");
+      }
+      if (c.exists("radius")) {
+        int ri;
+        float rf;
+        if (c.lookupValue("radius", ri))
+          radius = static_cast<float>(ri);
+        else if (c.lookupValue("radius", rf))
+          radius = rf;
+        else
+          throw GlobalException("Cylinder #" + std::to_string(i) + " : champ 'radius' manquant ou invalide");
+      }
+      if (c.exists("height")) {
+        int hi;
+        float hf;
+        if (c.lookupValue("height", hi))
+          height = static_cast<float>(hi);
+        else if (c.lookupValue("height", hf))
+          height = hf;
+      }
+      if (c.exists("rotation")) {
+        rotation = parseVector3(c.lookup("rotation"));
+      }
+      if (c.exists("color")) {
+        const auto &col = c.lookup("color");
+        col.lookupValue("r", cr);
+        col.lookupValue("g", cg);
+        col.lookupValue("b", cb);
       }
+      shapes.push_back(PrimitiveFactory::createCylinder(baseCenter, radius, height, rotation, parseMaterial(c, Color(cr, cg, cb))));
     }
-    if (prims.exists("cones")) {
-      const auto &cones = prims.lookup("cones");
-      for (int i = 0; i < cones.getLength(); ++i) {
-        const auto &c = cones[i];
-        Vector3 baseCenter;
-        Vector3 rotation(0, 0, 0);
-        float radius = 1.0f;
-        float height = std::numeric_limits<float>::infinity();
-        int cr = 255, cg = 255, cb = 255;
-        if (c.exists("baseCenter")) {
-          baseCenter = parseVector3(c.lookup("baseCenter"));
-        } else {
-          throw GlobalException("Cone #" + std::to_string(i) + " : champ 'baseCenter' manquant ou invalide");
-        }
-        if (c.exists("radius")) {
-          int ri;
-          float rf;
-          if (c.lookupValue("radius", ri))
-            radius = static_cast<float>(ri);
-          else if (c.lookupValue("radius", rf))
-            radius = rf;
-          else
-            throw GlobalException("Cone #" + std::to_string(i) + " : champ 'radius' manquant ou invalide");
-        } else {
+  }
+  if (prims.exists("cones")) {
+    const auto &cones = prims.lookup("cones");
+    for (int i = 0; i < cones.getLength(); ++i) {
+      const auto &c = cones[i];
+      Vector3 baseCenter;
+      Vector3 rotation(0, 0, 0);
+      float radius = 1.0f;
+      float height = std::numeric_limits<float>::infinity();
+      int cr = 255, cg = 255, cb = 255;
+      if (c.exists("baseCenter")) {
+        baseCenter = parseVector3(c.lookup("baseCenter"));
+      } else {
+        throw GlobalException("Cone #" + std::to_string(i) + " : champ 'baseCenter' manquant ou invalide");
+      }
+      if (c.exists("radius")) {
+        int ri;
+        float rf;
+        if (c.lookupValue("radius", ri))
+          radius = static_cast<float>(ri);
+        else if (c.lookupValue("radius", rf))
+          radius = rf;
+        else
           throw GlobalException("Cone #" + std::to_string(i) + " : champ 'radius' manquant ou invalide");
-        }
-        if (c.exists("height")) {
-          int hi;
-          float hf;
-          if (c.lookupValue("height", hi))
-            height = static_cast<float>(hi);
-          else if (c.lookupValue("height", hf))
-            height = hf;
-        }
-        if (c.exists("rotation"))
-          rotation = parseVector3(c.lookup("rotation"));
-        if (c.exists("color")) {
-          const auto &col = c.lookup("color");
-          col.lookupValue("r", cr);
-          col.lookupValue("g", cg);
-          col.lookupValue("b", cb);
-        }
-
-        m_scene.addPrimitive(PrimitiveFactory::createCone(baseCenter, radius, height, rotation, parseMaterial(c, Color(cr, cg, cb))));
+      } else {
+        throw GlobalException("Cone #" + std::to_string(i) + " : champ 'radius' manquant ou invalide");
+      }
+      if (c.exists("height")) {
+        int hi;
+        float hf;
+        if (c.lookupValue("height", hi))
+          height = static_cast<float>(hi);
+        else if (c.lookupValue("height", hf))
+          height = hf;
       }
+      if (c.exists("rotation"))
+        rotation = parseVector3(c.lookup("rotation"));
+      if (c.exists("color")) {
+        const auto &col = c.lookup("color");
+        col.lookupValue("r", cr);
+        col.lookupValue("g", cg);
+        col.lookupValue("b", cb);
+      }
+
+      shapes.push_back(PrimitiveFactory::createCone(baseCenter, radius, height, rotation, parseMaterial(c, Color(cr, cg, cb))));
     }
-    if (prims.exists("triangles")) {
-      const auto &triangles = prims.lookup("triangles");
-      for (int i = 0; i < triangles.getLength(); ++i) {
-        const auto &t = triangles[i];
-        if (!t.exists("a") || !t.exists("b") || !t.exists("c"))
-          throw GlobalException("Triangle #" + std::to_string(i) + " : points a, b, c manquants");
+  }
+  if (prims.exists("triangles")) {
+    const auto &triangles = prims.lookup("triangles");
+    for (int i = 0; i < triangles.getLength(); ++i) {
+      const auto &t = triangles[i];
+      if (!t.exists("a") || !t.exists("b") || !t.exists("c"))
+        throw GlobalException("Triangle #" + std::to_string(i) + " : points a, b, c manquants");
 
-        Vector3 a = parseVector3(t.lookup("a"));
-        Vector3 b = parseVector3(t.lookup("b"));
-        Vector3 c = parseVector3(t.lookup("c"));
+      Vector3 a = parseVector3(t.lookup("a"));
+      Vector3 b = parseVector3(t.lookup("b"));
+      Vector3 c = parseVector3(t.lookup("c"));
 
-        int r = 255, g = 255, b_col = 255;
-        if (t.exists("color")) {
-          const auto &col = t.lookup("color");
-          col.lookupValue("r", r);
-          col.lookupValue("g", g);
-          col.lookupValue("b", b_col);
-        }
-        m_scene.addPrimitive(PrimitiveFactory::createTriangle(a, b, c, parseMaterial(t, Color(r, g, b_col))));
+      int r = 255, g = 255, b_col = 255;
+      if (t.exists("color")) {
+        const auto &col = t.lookup("color");
+        col.lookupValue("r", r);
+        col.lookupValue("g", g);
+        col.lookupValue("b", b_col);
       }
+      shapes.push_back(PrimitiveFactory::createTriangle(a, b, c, parseMaterial(t, Color(r, g, b_col))));
     }
-    if (prims.exists("torus")) {
-      const auto &toruses = prims.lookup("torus");
-      for (int i = 0; i < toruses.getLength(); ++i) {
-        const auto &t = toruses[i];
-        Vector3 center;
-        Vector3 rotation(0, 0, 0);
-        float majorRadius = 1.0f;
-        float minorRadius = 0.5f;
-        int cr = 255, cg = 255, cb = 255;
-        if (t.exists("center")) {
-          center = parseVector3(t.lookup("center"));
-        } else {
-          throw GlobalException("Torus #" + std::to_string(i) + " : champ 'center' manquant ou invalide");
-        }
-        if (t.exists("majorRadius")) {
-          int ri;
-          float rf;
-          if (t.lookupValue("majorRadius", ri))
-            majorRadius = static_cast<float>(ri);
-          else if (t.lookupValue("majorRadius", rf))
-            majorRadius = rf;
-          else
-            throw GlobalException("Torus #" + std::to_string(i) + " : champ 'majorRadius' manquant ou invalide");
-        }
-        if (t.exists("minorRadius")) {
-          int ri;
-          float rf;
-          if (t.lookupValue("minorRadius", ri))
-            minorRadius = static_cast<float>(ri);
-          else if (t.lookupValue("minorRadius", rf))
-            minorRadius = rf;
-          else
-            throw GlobalException("Torus #" + std::to_string(i) + " : champ 'minorRadius' manquant ou invalide");
-        }
-        if (t.exists("rotation"))
-          rotation = parseVector3(t.lookup("rotation"));
-        if (t.exists("color")) {
-          const auto &col = t.lookup("color");
-          col.lookupValue("r", cr);
-          col.lookupValue("g", cg);
-          col.lookupValue("b", cb);
-        }
-        m_scene.addPrimitive(PrimitiveFactory::createTorus(center, majorRadius, minorRadius, rotation, parseMaterial(t, Color(cr, cg, cb))));
+  }
+  if (prims.exists("torus")) {
+    const auto &toruses = prims.lookup("torus");
+    for (int i = 0; i < toruses.getLength(); ++i) {
+      const auto &t = toruses[i];
+      Vector3 center;
+      Vector3 rotation(0, 0, 0);
+      float majorRadius = 1.0f;
+      float minorRadius = 0.5f;
+      int cr = 255, cg = 255, cb = 255;
+      if (t.exists("center")) {
+        center = parseVector3(t.lookup("center"));
+      } else {
+        throw GlobalException("Torus #" + std::to_string(i) + " : champ 'center' manquant ou invalide");
+      }
+      if (t.exists("majorRadius")) {
+        int ri;
+        float rf;
+        if (t.lookupValue("majorRadius", ri))
+          majorRadius = static_cast<float>(ri);
+        else if (t.lookupValue("majorRadius", rf))
+          majorRadius = rf;
+        else
+          throw GlobalException("Torus #" + std::to_string(i) + " : champ 'majorRadius' manquant ou invalide");
       }
+      if (t.exists("minorRadius")) {
+        int ri;
+        float rf;
+        if (t.lookupValue("minorRadius", ri))
+          minorRadius = static_cast<float>(ri);
+        else if (t.lookupValue("minorRadius", rf))
+          minorRadius = rf;
+        else
+          throw GlobalException("Torus #" + std::to_string(i) + " : champ 'minorRadius' manquant ou invalide");
+      }
+      if (t.exists("rotation"))
+        rotation = parseVector3(t.lookup("rotation"));
+      if (t.exists("color")) {
+        const auto &col = t.lookup("color");
+        col.lookupValue("r", cr);
+        col.lookupValue("g", cg);
+        col.lookupValue("b", cb);
+      }
+      shapes.push_back(PrimitiveFactory::createTorus(center, majorRadius, minorRadius, rotation, parseMaterial(t, Color(cr, cg, cb))));
     }
-    if (prims.exists("obj")) {
-      const auto &objs = prims.lookup("obj");
-      for (int i = 0; i < objs.getLength(); ++i) {
-        const auto &obj = objs[i];
-        std::string path;
-        int cr = 255, cg = 255, cb = 255;
-        Vector3 offset(0.0f, 0.0f, 0.0f);
-        Vector3 rotation(0.0f, 0.0f, 0.0f);
-        float scale = 1.0f;
-        if (!obj.lookupValue("file", path))
-          throw GlobalException("OBJ #" + std::to_string(i) + " : champ 'file' manquant");
-        if (obj.exists("color")) {
-          const auto &col = obj.lookup("color");
-          col.lookupValue("r", cr);
-          col.lookupValue("g", cg);
-          col.lookupValue("b", cb);
-        }
-        if (obj.exists("scale")) {
-          int si;
-          float sf;
-          if (obj.lookupValue("scale", si))
-            scale = static_cast<float>(si);
-          else if (obj.lookupValue("scale", sf))
-            scale = sf;
-        }
-        if (obj.exists("offset"))
-          offset = parseVector3(obj.lookup("offset"));
-        if (obj.exists("rotation"))
-          rotation = parseVector3(obj.lookup("rotation"));
-        auto triangles = ObjParser::loadFromFile(path, scale, offset, rotation);
-        for (const auto &tri : triangles) {
-          m_scene.addPrimitive(PrimitiveFactory::createTriangle(tri.a, tri.b, tri.c, parseMaterial(obj, Color(cr, cg, cb))));
-        }
+  }
+  if (prims.exists("obj")) {
+    const auto &objs = prims.lookup("obj");
+    // Un fichier placé plusieurs fois n'est chargé qu'une fois, dans son propre repère,
+    // puis placé par des instances : la mémoire ne grandit plus avec le nombre de copies
+    std::map<std::string, int> uses;
+    for (int i = 0; i < objs.getLength(); ++i) {
+      std::string path;
+      if (objs[i].lookupValue("file", path))
+        ++uses[path];
+    }
+    std::map<std::string, std::shared_ptr<const TriangleMesh>> shared;
+    for (int i = 0; i < objs.getLength(); ++i) {
+      const auto &obj = objs[i];
+      std::string path;
+      int cr = 255, cg = 255, cb = 255;
+      Vector3 offset(0.0f, 0.0f, 0.0f);
+      Vector3 rotation(0.0f, 0.0f, 0.0f);
+      float scale = 1.0f;
+      if (!obj.lookupValue("file", path))
+        throw GlobalException("OBJ #" + std::to_string(i) + " : champ 'file' manquant");
+      if (std::find(m_files.begin(), m_files.end(), path) == m_files.end())
+        m_files.push_back(path);
+      if (obj.exists("color")) {
+        const auto &col = obj.lookup("color");
+        col.lookupValue("r", cr);
+        col.lookupValue("g", cg);
+        col.lookupValue("b", cb);
+      }
+      if (obj.exists("scale")) {
+        int si;
+        float sf;
+        if (obj.lookupValue("scale", si))
+          scale = static_cast<float>(si);
+        else if (obj.lookupValue("scale", sf))
+          scale = sf;
+      }
+      if (obj.exists("offset"))
+        offset = parseVector3(obj.lookup("offset"));
+      if (obj.exists("rotation"))
+        rotation = parseVector3(obj.lookup("rotation"));
+      if (uses[path] > 1) {
+        std::shared_ptr<const TriangleMesh> &mesh = shared[path];
+        if (!mesh)
+          mesh = MeshCache::loadObj(path, 1.0f, Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 0.0f), Material());
+        if (mesh->getTriangleCount() > 0)
+          shapes.push_back(PrimitiveFactory::createMeshInstance(mesh, Transform::fromPlacement(scale, rotation, offset),
+            parseMaterial(obj, Color(cr, cg, cb))));
+        continue;
       }
+      // Un seul maillage indexé par fichier : sommets partagés, un matériau, BVH interne.
+      // Le cache binaire évite de reparser le même fichier avec la même transformation.
+      auto mesh = MeshCache::loadObj(path, scale, offset, rotation, parseMaterial(obj, Color(cr, cg, cb)));
+      if (mesh->getTriangleCount() > 0)
+        shapes.push_back(mesh);
     }
-    return true;
-  } catch (const libconfig::SettingException &e) {
-    throw GlobalException("[SceneParser] Error parsing primitives: " + std::string(e.what()));
   }
 }
 
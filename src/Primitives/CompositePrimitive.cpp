@@ -7,16 +7,15 @@
 
 #include "Primitives/CompositePrimitive.hpp"
 #include <limits>
-#include <numeric>
 #include "Maths/Ray.hpp"
 
 constexpr float COMP_EPSILON = 0.001f; // Epsilon pour éviter les auto-intersections
 
-Raytracer::CompositePrimitive::CompositePrimitive() : m_lastHitPrimitive(nullptr) {
+Raytracer::CompositePrimitive::CompositePrimitive() {
 }
 
 Raytracer::CompositePrimitive::CompositePrimitive(const Material& material) 
-    : m_material(material), m_lastHitPrimitive(nullptr) {
+    : m_material(material) {
 }
 
 void Raytracer::CompositePrimitive::addPrimitive(std::shared_ptr<IPrimitive> primitive) {
@@ -34,51 +33,74 @@ void Raytracer::CompositePrimitive::addPrimitive(std::shared_ptr<IPrimitive> pri
 }
 
 bool Raytracer::CompositePrimitive::intersect(const Ray& ray, float& t) const {
+    HitRecord hit;
+    if (!intersect(ray, hit))
+        return false;
+    t = hit.t;
+    return true;
+}
+
+bool Raytracer::CompositePrimitive::intersect(const Ray& ray, HitRecord& hit) const {
     if (m_primitives.empty())
         return false;
         
     float closestT = std::numeric_limits<float>::infinity();
-    bool anyHit = false;
-    m_lastHitPrimitive = nullptr;
+    bool found = false;
 
-    for (const auto& prim : m_primitives) {
+    // Chaque candidat remplit son propre record, seul le plus proche est conservé
+    for (const auto& primitive : m_primitives) {
         // Ne pas tester l'intersection avec soi-même
-        if (prim.get() == this)
+        if (primitive.get() == this)
             continue;
-            
-        float tempT;
-        if (prim->intersect(ray, tempT) && tempT > COMP_EPSILON && tempT < closestT) {
-            closestT = tempT;
-            m_lastHitPrimitive = prim;
-            anyHit = true;
+        HitRecord candidate;
+        if (primitive->intersect(ray, candidate) && candidate.t > COMP_EPSILON && candidate.t < closestT) {
+            closestT = candidate.t;
+            hit = candidate;
+            found = true;
         }
     }
+    return found;
+}
 
-    if (anyHit) {
-        t = closestT;
-        return true;
+bool Raytracer::CompositePrimitive::occludes(const Ray& ray, float tMax) const {
+    for (const auto& primitive : m_primitives) {
+        if (primitive.get() != this && primitive->occludes(ray, tMax))
+            return true;
     }
     return false;
 }
 
-Raytracer::Vector3 Raytracer::CompositePrimitive::getNormal(const Vector3& point) const {
-    if (m_lastHitPrimitive) {
-        return m_lastHitPrimitive->getNormal(point);
+void Raytracer::CompositePrimitive::intersectPacket(const RayPacket& packet, uint32_t mask, PacketHit& hits) const {
+    if (!packet.isCoherent(mask)) {
+        IPrimitive::intersectPacket(packet, mask, hits);
+        return;
+    }
+    // Chaque enfant trace le paquet à sa façon et ne garde que les impacts plus proches
+    for (const auto& primitive : m_primitives)
+        primitive->intersectPacket(packet, mask, hits);
+}
+
+uint32_t Raytracer::CompositePrimitive::occludesPacket(const RayPacket& packet, uint32_t mask, const float* tMax) const {
+    if (!packet.isCoherent(mask))
+        return IPrimitive::occludesPacket(packet, mask, tMax);
+    uint32_t occluded = 0;
+    for (const auto& primitive : m_primitives) {
+        occluded |= primitive->occludesPacket(packet, mask & ~occluded, tMax);
+        if (occluded == mask)
+            break;
     }
-    return Vector3(0, 1, 0); // Normal par défaut si aucun hit
+    return occluded;
+}
+
+Raytracer::Vector3 Raytracer::CompositePrimitive::getNormal(const Vector3&) const {
+    return Vector3(0, 1, 0); // Pas de surface propre : la normale vient du HitRecord
 }
 
 Raytracer::Color Raytracer::CompositePrimitive::getColor() const {
-    if (m_lastHitPrimitive) {
-        return m_lastHitPrimitive->getColor();
-    }
     return m_material.getColor();
 }
 
 const Raytracer::Material& Raytracer::CompositePrimitive::getMaterial() const {
-    if (m_lastHitPrimitive) {
-        return m_lastHitPrimitive->getMaterial();
-    }
     return m_material;
 }
 
@@ -95,6 +117,25 @@ Raytracer::Vector3 Raytracer::CompositePrimitive::getCenter() const {
     return sum * (1.0f / m_primitives.size());
 }
 
+bool Raytracer::CompositePrimitive::isBounded() const {
+    if (m_primitives.empty())
+        return false;
+    for (const auto& prim : m_primitives) {
+        if (!prim->isBounded())
+            return false;
+    }
+    return true;
+}
+
+Raytracer::AABB Raytracer::CompositePrimitive::getBoundingBox() const {
+    AABB box;
+    for (const auto& prim : m_primitives) {
+        if (prim->isBounded())
+            box.expand(prim->getBoundingBox());
+    }
+    return box;
+}
+
 size_t Raytracer::CompositePrimitive::getSize() const {
     return m_primitives.size();
 }
@@ -35,6 +35,14 @@ static Vector3 rotateAroundZ(const Vector3& v, float angle)
     };
 }
 
+static Vector3 applyRotation(const Vector3& v, const Vector3& rotation)
+{
+    Vector3 out = rotateAroundX(v, rotation.x);
+    out = rotateAroundY(out, rotation.y);
+    out = rotateAroundZ(out, rotation.z);
+    return out;
+}
+
 static Vector3 applyInverseRotation(const Vector3& v, const Vector3& rotation)
 {
     Vector3 out = rotateAroundZ(v, -rotation.z);
@@ -132,6 +140,26 @@ const Material& Cone::getMaterial() const
     return m_material;
 }
 
+bool Cone::isBounded() const
+{
+    return !m_infinite;
+}
+
+AABB Cone::getBoundingBox() const
+{
+    AABB box;
+    if (!isBounded())
+        return box;
+    // The body is clipped to 0 <= y <= height in local space, its radius
+    // growing linearly with the distance to the apex
+    Vector3 axis = applyRotation(Vector3(0, 1, 0), m_rotation);
+    float apexY = (m_apex - m_baseCenter).y;
+    float topRadius = m_height > 0 ? std::abs(m_radius) * std::abs(m_height - apexY) / m_height : 0.0f;
+    box.expandDisk(m_baseCenter, axis, std::abs(m_radius));
+    box.expandDisk(m_baseCenter + axis * m_height, axis, topRadius);
+    return box;
+}
+
 Vector3 Cone::getBaseCenter() const
 {
     return m_baseCenter;
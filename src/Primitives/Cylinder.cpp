@@ -38,6 +38,14 @@ static Vector3 rotateAroundZ(const Vector3& v, float angle)
     };
 }
 
+static Vector3 applyRotation(const Vector3& v, const Vector3& rotation)
+{
+    Vector3 out = rotateAroundX(v, rotation.x);
+    out = rotateAroundY(out, rotation.y);
+    out = rotateAroundZ(out, rotation.z);
+    return out;
+}
+
 static Vector3 applyInverseRotation(const Vector3& v, const Vector3& rotation)
 {
     Vector3 out = rotateAroundZ(v, -rotation.z);
@@ -124,6 +132,22 @@ const Material& Cylinder::getMaterial() const
     return m_material;
 }
 
+bool Cylinder::isBounded() const
+{
+    return !std::isinf(m_height);
+}
+
+AABB Cylinder::getBoundingBox() const
+{
+    AABB box;
+    if (!isBounded())
+        return box;
+    Vector3 axis = applyRotation(Vector3(0, 1, 0), m_rotation);
+    box.expandDisk(m_baseCenter, axis, std::abs(m_radius));
+    box.expandDisk(m_baseCenter + axis * m_height, axis, std::abs(m_radius));
+    return box;
+}
+
 Vector3 Cylinder::getBaseCenter() const
 {
     return m_baseCenter;
@@ -0,0 +1,126 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** MeshInstance
+*/
+
+#include "Primitives/MeshInstance.hpp"
+
+namespace Raytracer {
+
+MeshInstance::MeshInstance(std::shared_ptr<const TriangleMesh> mesh, const Transform& transform, const Material& material)
+    : m_mesh(std::move(mesh)), m_toWorld(transform), m_toObject(transform.inverse()), m_material(material),
+      m_bounds(transform.applyToBox(m_mesh->getBoundingBox()))
+{
+}
+
+bool MeshInstance::intersect(const Ray& ray, float& t) const
+{
+    float scale;
+    if (!m_mesh->intersect(m_toObject.applyToRay(ray, scale), t))
+        return false;
+    t /= scale;
+    return true;
+}
+
+bool MeshInstance::intersect(const Ray& ray, HitRecord& hit) const
+{
+    float scale;
+    if (!m_mesh->intersect(m_toObject.applyToRay(ray, scale), hit))
+        return false;
+    // Distance et point en unités du monde ; normale par la transposée de l'inverse
+    hit.t /= scale;
+    hit.point = ray.at(hit.t);
+    hit.normal = m_toObject.applyTransposed(hit.normal).normalized();
+    hit.primitive = this;
+    return true;
+}
+
+bool MeshInstance::occludes(const Ray& ray, float tMax) const
+{
+    float scale;
+    Ray local = m_toObject.applyToRay(ray, scale);
+    return m_mesh->occludes(local, tMax * scale);
+}
+
+void MeshInstance::intersectPacket(const RayPacket& packet, uint32_t mask, PacketHit& hits) const
+{
+    float scale[PACKET_SIZE];
+    const RayPacket objectPacket = m_toObject.applyToPacket(packet, mask, scale);
+    PacketHit local;
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        if (mask & (1u << i))
+            local.t[i] = hits.t[i] * scale[i];
+    }
+    m_mesh->intersectPacket(objectPacket, mask, local);
+    // Seules les voies rapprochées par le maillage ont un record rempli
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        if (!(mask & (1u << i)) || !local.records[i].primitive)
+            continue;
+        float t = local.t[i] / scale[i];
+        if (t <= OCCLUSION_EPSILON || t >= hits.t[i])
+            continue;
+        HitRecord& hit = hits.records[i];
+        hit = local.records[i];
+        hit.t = t;
+        hit.point = packet.rays[i].at(t);
+        hit.normal = m_toObject.applyTransposed(hit.normal).normalized();
+        hit.primitive = this;
+        hits.t[i] = t;
+    }
+}
+
+uint32_t MeshInstance::occludesPacket(const RayPacket& packet, uint32_t mask, const float* tMax) const
+{
+    float scale[PACKET_SIZE];
+    float bounds[PACKET_SIZE] = {};
+    const RayPacket objectPacket = m_toObject.applyToPacket(packet, mask, scale);
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        if (mask & (1u << i))
+            bounds[i] = tMax[i] * scale[i];
+    }
+    return m_mesh->occludesPacket(objectPacket, mask, bounds);
+}
+
+Vector3 MeshInstance::getNormal(const Vector3&) const
+{
+    return Vector3(0, 1, 0);
+}
+
+Color MeshInstance::getColor() const
+{
+    return m_material.getColor();
+}
+
+const Material& MeshInstance::getMaterial() const
+{
+    return m_material;
+}
+
+Vector3 MeshInstance::getCenter() const
+{
+    return m_bounds.centroid();
+}
+
+bool MeshInstance::isBounded() const
+{
+    return m_mesh->isBounded();
+}
+
+AABB MeshInstance::getBoundingBox() const
+{
+    return m_bounds;
+}
+
+const std::shared_ptr<const TriangleMesh>& MeshInstance::getMesh() const
+{
+    return m_mesh;
+}
+
+const Transform& MeshInstance::getTransform() const
+{
+    return m_toWorld;
+}
+
+}
@@ -7,6 +7,7 @@
 
 #include "Primitives/Plane.hpp"
 #include <cmath>
+#include <limits>
 #include "Material/Material.hpp"
 
 namespace Raytracer {
@@ -20,15 +21,53 @@ Plane::Plane(const Vector3& normal, float d, const Material& material)
 
 bool Plane::intersect(const Ray& ray, float& t) const
 {
-    float denom = ray.getDirection().dot(m_normal);
+    return hitDistance(m_normal, m_distance, ray, t);
+}
+
+bool Plane::hitDistance(const Vector3& normal, float distance, const Ray& ray, float& t)
+{
+    float denom = ray.getDirection().dot(normal);
     if (std::fabs(denom) < 1e-6f)
         return false;
 
     // t = (d − origin·n) / (dir·n)
-    t = (m_distance - ray.getOrigin().dot(m_normal)) / denom;
+    t = (distance - ray.getOrigin().dot(normal)) / denom;
     return t >= 0.0f;
 }
 
+// Même formule que intersect(), une voie SIMD par rayon ; +inf si raté
+FloatV Plane::packetDistance(const RayPacket& packet, const Vector3& normal, float distance)
+{
+    FloatV nx = FloatV::broadcast(normal.x);
+    FloatV ny = FloatV::broadcast(normal.y);
+    FloatV nz = FloatV::broadcast(normal.z);
+    FloatV denom = packet.dx * nx + packet.dy * ny + packet.dz * nz;
+    FloatV t = (FloatV::broadcast(distance) - (packet.ox * nx + packet.oy * ny + packet.oz * nz)) / denom;
+    FloatV valid = (vabs(denom) >= FloatV::broadcast(1e-6f)) & (t >= FloatV::broadcast(0.0f));
+    return select(valid, t, FloatV::broadcast(std::numeric_limits<float>::infinity()));
+}
+
+void Plane::intersectPacket(const RayPacket& packet, uint32_t mask, PacketHit& hits) const
+{
+    uint32_t closer = hits.closer(packetDistance(packet, m_normal, m_distance), mask, OCCLUSION_EPSILON);
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        if (!(closer & (1u << i)))
+            continue;
+        HitRecord& hit = hits.records[i];
+        hit.t = hits.t[i];
+        hit.point = packet.rays[i].at(hit.t);
+        hit.normal = m_normal;
+        hit.primitive = this;
+        hit.hasUV = false;
+    }
+}
+
+uint32_t Plane::occludesPacket(const RayPacket& packet, uint32_t mask, const float* tMax) const
+{
+    FloatV t = packetDistance(packet, m_normal, m_distance);
+    return movemask((t > FloatV::broadcast(OCCLUSION_EPSILON)) & (t < FloatV::load(tMax)) & laneMask(mask));
+}
+
 Vector3 Plane::getNormal(const Vector3& /*point*/) const
 {
     return m_normal;
@@ -44,6 +83,21 @@ const Material& Plane::getMaterial() const
     return m_material;
 }
 
+bool Plane::isBounded() const
+{
+    return false;
+}
+
+AABB Plane::getBoundingBox() const
+{
+    return AABB();
+}
+
+float Plane::getDistance() const
+{
+    return m_distance;
+}
+
 Vector3 Plane::getCenter() const
 {
     // Un point quelconque sur le plan : d * n
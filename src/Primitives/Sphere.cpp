@@ -7,6 +7,7 @@
 
 #include "Primitives/Sphere.hpp"
 #include <cmath>
+#include <limits>
 #include "Maths/Ray.hpp"
 
 Raytracer::Sphere::Sphere(const Vector3 &center, float radius, const Material &material) : m_center(center), m_radius(radius), m_material(material) {
@@ -24,15 +25,32 @@ const Raytracer::Material& Raytracer::Sphere::getMaterial() const {
   return m_material;
 }
 
+bool Raytracer::Sphere::isBounded() const {
+  return true;
+}
+
+Raytracer::AABB Raytracer::Sphere::getBoundingBox() const {
+  Vector3 extent(std::abs(m_radius), std::abs(m_radius), std::abs(m_radius));
+  return AABB(m_center - extent, m_center + extent);
+}
+
 Raytracer::Vector3 Raytracer::Sphere::getNormal(const Vector3 &point) const {
   return (point - m_center).normalized();
 }
 
+float Raytracer::Sphere::getRadius() const {
+  return m_radius;
+}
+
 bool Raytracer::Sphere::intersect(const Ray &ray, float &t) const {
-  Vector3 oc = ray.getOrigin() - m_center;
+  return hitDistance(m_center, m_radius, ray, t);
+}
+
+bool Raytracer::Sphere::hitDistance(const Vector3 &center, float radius, const Ray &ray, float &t) {
+  Vector3 oc = ray.getOrigin() - center;
   float a = ray.getDirection().dot(ray.getDirection());
   float b = 2.0f * oc.dot(ray.getDirection());
-  float c = oc.dot(oc) - m_radius * m_radius;
+  float c = oc.dot(oc) - radius * radius;
   float discriminant = b * b - 4 * a * c;
   if (discriminant < 0)
     return false;
@@ -49,3 +67,41 @@ bool Raytracer::Sphere::intersect(const Ray &ray, float &t) const {
   }
   return false;
 }
+
+// Mêmes opérations que hitDistance(), dans le même ordre, une voie SIMD par rayon ; +inf si raté
+Raytracer::FloatV Raytracer::Sphere::packetDistance(const RayPacket &packet, const Vector3 &center, float radius) {
+  FloatV ocx = packet.ox - FloatV::broadcast(center.x);
+  FloatV ocy = packet.oy - FloatV::broadcast(center.y);
+  FloatV ocz = packet.oz - FloatV::broadcast(center.z);
+  FloatV a = packet.dx * packet.dx + packet.dy * packet.dy + packet.dz * packet.dz;
+  FloatV b = FloatV::broadcast(2.0f) * (ocx * packet.dx + ocy * packet.dy + ocz * packet.dz);
+  FloatV c = ocx * ocx + ocy * ocy + ocz * ocz - FloatV::broadcast(radius * radius);
+  FloatV discriminant = b * b - FloatV::broadcast(4.0f) * a * c;
+  FloatV sqrtDiscriminant = Raytracer::vsqrt(Raytracer::vmax(discriminant, FloatV::broadcast(0.0f)));
+  FloatV twoA = FloatV::broadcast(2.0f) * a;
+  FloatV t0 = (FloatV::broadcast(0.0f) - b - sqrtDiscriminant) / twoA;
+  FloatV t1 = (FloatV::broadcast(0.0f) - b + sqrtDiscriminant) / twoA;
+  FloatV epsilon = FloatV::broadcast(0.001f);
+  FloatV miss = FloatV::broadcast(std::numeric_limits<float>::infinity());
+  FloatV t = Raytracer::select(t0 > epsilon, t0, Raytracer::select(t1 > epsilon, t1, miss));
+  return Raytracer::select(discriminant >= FloatV::broadcast(0.0f), t, miss);
+}
+
+void Raytracer::Sphere::intersectPacket(const RayPacket &packet, uint32_t mask, PacketHit &hits) const {
+  uint32_t closer = hits.closer(packetDistance(packet, m_center, m_radius), mask, OCCLUSION_EPSILON);
+  for (int i = 0; i < PACKET_SIZE; ++i) {
+    if (!(closer & (1u << i)))
+      continue;
+    HitRecord &hit = hits.records[i];
+    hit.t = hits.t[i];
+    hit.point = packet.rays[i].at(hit.t);
+    hit.normal = getNormal(hit.point);
+    hit.primitive = this;
+    hit.hasUV = false;
+  }
+}
+
+uint32_t Raytracer::Sphere::occludesPacket(const RayPacket &packet, uint32_t mask, const float *tMax) const {
+  FloatV t = packetDistance(packet, m_center, m_radius);
+  return movemask((t > FloatV::broadcast(OCCLUSION_EPSILON)) & (t < FloatV::load(tMax)) & laneMask(mask));
+}
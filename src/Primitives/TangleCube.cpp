@@ -8,6 +8,8 @@
 #include "Primitives/TangleCube.hpp"
 #include <cmath>
 #include <algorithm>
+#include <limits>
+#include "Utils/RenderStats.hpp"
 
 namespace Raytracer {
 
@@ -17,7 +19,11 @@ TangleCube::TangleCube(const Vector3& center, float size, const Material& materi
 
 float TangleCube::tangle_cube_equation(const Vector3& point) const
 {
-    Vector3 p = (point - m_center) / m_size;
+    return tangle_cube_value((point - m_center) / m_size);
+}
+
+float TangleCube::tangle_cube_value(const Vector3& p)
+{
     float x = p.x;
     float y = p.y;
     float z = p.z;
@@ -42,31 +48,76 @@ Vector3 TangleCube::tangle_cube_gradient(const Vector3& point) const
 
 bool TangleCube::intersect(const Ray& ray, float& t) const
 {
-    const float stepSize = 0.1f;
-    const float minStep = 0.001f;
-    const int maxSteps = 1000;
-    const float hitThreshold = 0.001f;
-    float currentT = 0.0f;
-    Vector3 rayOrigin = ray.getOrigin();
-    Vector3 rayDir = ray.getDirection();
-    
-    for (int i = 0; i < maxSteps; ++i) {
-        Vector3 point = rayOrigin + rayDir * currentT;
-        float dist = std::abs(tangle_cube_equation(point));
-        if (dist < hitThreshold) {
-            t = currentT;
+    // Rayon en coordonnées normalisées : P(s) = o + s * d, s restant le paramètre du rayon
+    Vector3 o = (ray.getOrigin() - m_center) / m_size;
+    Vector3 d = ray.getDirection() / m_size;
+
+    // Seule la partie du rayon dans la boîte [-TANGLE_EXTENT, TANGLE_EXTENT]³ est parcourue
+    const AABB box(Vector3(-TANGLE_EXTENT, -TANGLE_EXTENT, -TANGLE_EXTENT), Vector3(TANGLE_EXTENT, TANGLE_EXTENT, TANGLE_EXTENT));
+    float sNear = TANGLE_EPSILON;
+    float sFar = std::numeric_limits<float>::max();
+    if (d.length() == 0.0f || !box.clip(o, Vector3(1.0f / d.x, 1.0f / d.y, 1.0f / d.z), sNear, sFar))
+        return false;
+
+    // Constante de Lipschitz de s -> f(P(s)) dans la boîte : |∂f/∂x| = |4x³ - 10x|
+    // atteint son maximum M en |x| = TANGLE_EXTENT, donc |f'(s)| <= M(|dx| + |dy| + |dz|)
+    const float maxPartial = 4.0f * TANGLE_EXTENT * TANGLE_EXTENT * TANGLE_EXTENT - 10.0f * TANGLE_EXTENT;
+    const float lipschitz = maxPartial * (std::abs(d.x) + std::abs(d.y) + std::abs(d.z));
+    const float minStep = TANGLE_MIN_STEP / d.length();
+
+    auto evaluate = [&](float s) { return tangle_cube_value(o + d * s); };
+    float s = sNear;
+    float value = evaluate(s);
+    RenderStats::Tally steps(RenderStats::TANGLECUBE_STEPS);
+    for (int i = 0; i < TANGLE_MAX_STEPS && s < sFar; ++i) {
+        ++steps;
+        if (value == 0.0f) {
+            t = s;
             return true;
         }
-        if (currentT > 1000.0f) {
-            return false;
+        // Aucune racine à moins de |f| / L : le pas ne peut pas traverser la surface,
+        // sauf quand le pas minimal s'applique, d'où la détection du changement de signe
+        float next = std::min(s + std::max(std::abs(value) / lipschitz, minStep), sFar);
+        float nextValue = evaluate(next);
+        if ((value < 0.0f) != (nextValue < 0.0f)) {
+            t = refineRoot(o, d, s, value, next);
+            return true;
         }
-        float step = std::max(dist * stepSize, minStep);
-        currentT += step;
+        s = next;
+        value = nextValue;
     }
-    
     return false;
 }
 
+float TangleCube::refineRoot(const Vector3& origin, const Vector3& dir, float low, float lowValue, float high)
+{
+    // Newton protégé : tout pas qui sort de l'intervalle [low, high] est remplacé par une bissection
+    float s = 0.5f * (low + high);
+    RenderStats::Tally steps(RenderStats::TANGLECUBE_STEPS);
+    for (int i = 0; i < TANGLE_REFINE_STEPS; ++i) {
+        ++steps;
+        Vector3 p = origin + dir * s;
+        float value = tangle_cube_value(p);
+        if (value == 0.0f)
+            break;
+        if ((value < 0.0f) == (lowValue < 0.0f)) {
+            low = s;
+            lowValue = value;
+        } else {
+            high = s;
+        }
+        Vector3 grad(4*p.x*p.x*p.x - 10*p.x, 4*p.y*p.y*p.y - 10*p.y, 4*p.z*p.z*p.z - 10*p.z);
+        float slope = grad.dot(dir);
+        float next = slope != 0.0f ? s - value / slope : low;
+        if (!(next > low && next < high))
+            next = 0.5f * (low + high);
+        if (next == s)
+            break;
+        s = next;
+    }
+    return s;
+}
+
 Vector3 TangleCube::getNormal(const Vector3& point) const
 {
     return tangle_cube_gradient(point);
@@ -87,6 +138,18 @@ Vector3 TangleCube::getCenter() const
     return m_center;
 }
 
+bool TangleCube::isBounded() const
+{
+    return true;
+}
+
+AABB TangleCube::getBoundingBox() const
+{
+    float half = TANGLE_EXTENT * std::abs(m_size);
+    Vector3 extent(half, half, half);
+    return AABB(m_center - extent, m_center + extent);
+}
+
 Vector3 TangleCube::getBaseCenter() const
 {
     return m_center;
@@ -2,16 +2,21 @@
 ** EPITECH PROJECT, 2025
 ** raytracer
 ** File description:
-** Torus with SDF and rotation
+** Torus with analytic intersection and rotation
 */
 
 #include "Primitives/Torus.hpp"
 #include "Maths/Ray.hpp"
+#include "Utils/PolynomialSolver.hpp"
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
 namespace Raytracer {
 
+// Distance minimale d'une intersection, comme pour les autres primitives
+static constexpr double TORUS_EPSILON = 0.001;
+
 Torus::Torus(const Vector3& center, float majorRadius, float minorRadius, const Vector3& rotation, const Material& material)
     : m_center(center), m_majorRadius(majorRadius), m_minorRadius(minorRadius), m_rotation(rotation), m_material(material) {}
 
@@ -67,36 +72,69 @@ Vector3 applyInverseRotation(const Vector3& v, const Vector3& rotation)
 }
 
 
+Vector3 Torus::worldToLocal(const Vector3& point) const
+{
+    return applyInverseRotation(point - m_center, m_rotation);
+}
+
+Vector3 Torus::worldToLocalDirection(const Vector3& dir) const
+{
+    return applyInverseRotation(dir, m_rotation);
+}
+
 bool Torus::intersect(const Ray& ray, float& t) const
 {
-    Vector3 localOrigin = applyInverseRotation(ray.getOrigin() - m_center, m_rotation);
-    Vector3 localDir = applyInverseRotation(ray.getDirection(), m_rotation);
-    Vector3 p = localOrigin;
-    Vector3 d = localDir.normalized();
-    float maxDistance = 1000.0f;
-    float minDist = 1e-3f;
-    float totalDist = 0.0f;
-
-    for (int i = 0; i < 256; ++i) {
-        Vector3 current = p + d * totalDist;
-        float len = std::sqrt(current.x * current.x + current.z * current.z);
-        float qx = len - m_majorRadius;
-        float qy = current.y;
-        float dist = std::sqrt(qx * qx + qy * qy) - m_minorRadius;
-        if (std::abs(dist) < minDist) {
-            t = totalDist;
+    Vector3 localOrigin = worldToLocal(ray.getOrigin());
+    Vector3 localDir = worldToLocalDirection(ray.getDirection());
+    double ox = localOrigin.x, oy = localOrigin.y, oz = localOrigin.z;
+    double dx = localDir.x, dy = localDir.y, dz = localDir.z;
+    double R = m_majorRadius;
+    double r = m_minorRadius;
+
+    // Sphère englobante de rayon R + r : rejet rapide, et le point d'entrée
+    // sert d'origine pour garder des coefficients bien conditionnés
+    double dd = dx * dx + dy * dy + dz * dz;
+    double od = ox * dx + oy * dy + oz * dz;
+    double bound = std::abs(R) + std::abs(r);
+    double discriminant = od * od - dd * (ox * ox + oy * oy + oz * oz - bound * bound);
+    if (dd == 0.0 || discriminant < 0.0)
+        return false;
+    double sqrtDiscriminant = std::sqrt(discriminant);
+    double tFar = (-od + sqrtDiscriminant) / dd;
+    if (tFar <= TORUS_EPSILON)
+        return false;
+    double tNear = std::max((-od - sqrtDiscriminant) / dd, 0.0);
+    ox += dx * tNear;
+    oy += dy * tNear;
+    oz += dz * tNear;
+    od = ox * dx + oy * dy + oz * dz;
+
+    // (|p|² + R² - r²)² = 4R²(px² + pz²), l'axe du tore étant Y
+    double f = ox * ox + oy * oy + oz * oz + R * R - r * r;
+    double fourR2 = 4.0 * R * R;
+    double roots[4];
+    int count = PolynomialSolver::solveQuartic(
+        dd * dd,
+        4.0 * dd * od,
+        2.0 * dd * f + 4.0 * od * od - fourR2 * (dx * dx + dz * dz),
+        4.0 * od * f - 2.0 * fourR2 * (ox * dx + oz * dz),
+        f * f - fourR2 * (ox * ox + oz * oz),
+        roots);
+
+    // Racines triées : la première au-delà de l'epsilon est la plus proche
+    for (int i = 0; i < count; ++i) {
+        double hit = tNear + roots[i];
+        if (hit > TORUS_EPSILON) {
+            t = static_cast<float>(hit);
             return true;
         }
-        totalDist += dist;
-        if (totalDist > maxDistance)
-            break;
     }
     return false;
 }
 
 Vector3 Torus::getNormal(const Vector3& point) const
 {
-    Vector3 local = applyInverseRotation(point - m_center, m_rotation);
+    Vector3 local = worldToLocal(point);
 
     float len = std::sqrt(local.x * local.x + local.z * local.z);
     Vector3 q = {
@@ -122,6 +160,21 @@ const Material& Torus::getMaterial() const
     return m_material;    
 } 
 
+bool Torus::isBounded() const
+{
+    return true;
+}
+
+AABB Torus::getBoundingBox() const
+{
+    // Central ring swept by a sphere of the minor radius
+    Vector3 axis = applyRotation(Vector3(0, 1, 0), m_rotation);
+    Vector3 tube(std::abs(m_minorRadius), std::abs(m_minorRadius), std::abs(m_minorRadius));
+    AABB box;
+    box.expandDisk(m_center, axis, std::abs(m_majorRadius));
+    return AABB(box.min - tube, box.max + tube);
+}
+
 Vector3 Torus::getBaseCenter() const
 {
     return m_center;
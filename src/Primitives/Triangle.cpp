@@ -16,29 +16,82 @@ Triangle::Triangle(const Vector3& a, const Vector3& b, const Vector3& c, const M
       m_normal(m_edge1.cross(m_edge2).normalized()) 
 {}
 
-bool Triangle::intersect(const Ray& ray, float& t) const
+// Möller–Trumbore : renvoie aussi les coordonnées barycentriques (u, v)
+bool Triangle::hitDistance(const Ray& ray, const Vector3& a, const Vector3& edge1,
+    const Vector3& edge2, float& t, float& u, float& v)
 {
     constexpr float EPSILON = 1e-6f;
     const Vector3& dir = ray.getDirection();
     const Vector3& orig = ray.getOrigin();
 
-    Vector3 h = dir.cross(m_edge2);
-    float a = m_edge1.dot(h);
-    if (std::abs(a) < EPSILON)
+    Vector3 h = dir.cross(edge2);
+    float det = edge1.dot(h);
+    if (std::abs(det) < EPSILON)
         return false;
-    float f = 1.0f / a;
-    Vector3 s = orig - m_a;
-    float u = f * s.dot(h);
+    float f = 1.0f / det;
+    Vector3 s = orig - a;
+    u = f * s.dot(h);
     if (u < 0.0f || u > 1.0f)
         return false;
-    Vector3 q = s.cross(m_edge1);
-    float v = f * dir.dot(q);
+    Vector3 q = s.cross(edge1);
+    v = f * dir.dot(q);
     if (v < 0.0f || u + v > 1.0f)
         return false;
-    t = f * m_edge2.dot(q);
+    t = f * edge2.dot(q);
     return t > EPSILON;
 }
 
+bool Triangle::intersect(const Ray& ray, float& t) const
+{
+    float u, v;
+    return hitDistance(ray, m_a, m_edge1, m_edge2, t, u, v);
+}
+
+bool Triangle::intersect(const Ray& ray, HitRecord& hit) const
+{
+    float t, u, v;
+    if (!hitDistance(ray, m_a, m_edge1, m_edge2, t, u, v))
+        return false;
+    hit.t = t;
+    hit.point = ray.at(t);
+    hit.normal = m_normal;
+    hit.primitive = this;
+    hit.u = u;
+    hit.v = v;
+    hit.hasUV = true;
+    return true;
+}
+
+void Triangle::intersectPacket(const RayPacket& packet, uint32_t mask, PacketHit& hits) const
+{
+    FloatV u, v;
+    uint32_t closer = hits.closer(intersectTrianglePacket(packet, m_a, m_edge1, m_edge2, u, v), mask, OCCLUSION_EPSILON);
+    if (closer == 0)
+        return;
+    float us[PACKET_SIZE], vs[PACKET_SIZE];
+    u.store(us);
+    v.store(vs);
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        if (!(closer & (1u << i)))
+            continue;
+        HitRecord& hit = hits.records[i];
+        hit.t = hits.t[i];
+        hit.point = packet.rays[i].at(hit.t);
+        hit.normal = m_normal;
+        hit.primitive = this;
+        hit.u = us[i];
+        hit.v = vs[i];
+        hit.hasUV = true;
+    }
+}
+
+uint32_t Triangle::occludesPacket(const RayPacket& packet, uint32_t mask, const float* tMax) const
+{
+    FloatV u, v;
+    FloatV t = intersectTrianglePacket(packet, m_a, m_edge1, m_edge2, u, v);
+    return movemask((t > FloatV::broadcast(OCCLUSION_EPSILON)) & (t < FloatV::load(tMax)) & laneMask(mask));
+}
+
 Vector3 Triangle::getNormal(const Vector3&) const
 {
     return m_normal;
@@ -63,9 +116,28 @@ Vector3 Triangle::getCenter() const
     );
 }
 
+bool Triangle::isBounded() const
+{
+    return true;
+}
+
+AABB Triangle::getBoundingBox() const
+{
+    AABB box;
+    box.expand(m_a);
+    box.expand(m_b);
+    box.expand(m_c);
+    return box;
+}
+
 Vector3 Triangle::getBaseCenter() const
 {
     return getCenter();
 }
 
+const Vector3& Triangle::getVertex(int index) const
+{
+    return index == 0 ? m_a : (index == 1 ? m_b : m_c);
+}
+
 }
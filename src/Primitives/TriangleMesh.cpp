@@ -0,0 +1,268 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** TriangleMesh
+*/
+
+#include "Primitives/TriangleMesh.hpp"
+#include <cmath>
+#include <limits>
+#include <string>
+#include "GlobalException.hpp"
+
+// Même seuil que CompositePrimitive : un impact trop proche est une auto-intersection
+// et ne doit pas masquer les triangles situés derrière
+constexpr float MESH_EPSILON = 0.001f;
+
+namespace Raytracer {
+
+TriangleMesh::TriangleMesh(std::vector<Vector3> vertices, std::vector<uint32_t> indices, const Material& material)
+    : m_material(material)
+{
+    std::shared_ptr<MeshData> data = makeData(std::move(vertices), std::move(indices));
+    std::vector<AABB> bounds(data->indices.size() / 3);
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        bounds[i].expand(data->vertices[data->indices[3 * i]]);
+        bounds[i].expand(data->vertices[data->indices[3 * i + 1]]);
+        bounds[i].expand(data->vertices[data->indices[3 * i + 2]]);
+    }
+    data->bvh.build(bounds);
+    m_data = std::move(data);
+}
+
+TriangleMesh::TriangleMesh(std::vector<Vector3> vertices, std::vector<uint32_t> indices, const Material& material, BVH bvh)
+    : m_material(material)
+{
+    std::shared_ptr<MeshData> data = makeData(std::move(vertices), std::move(indices));
+    data->bvh = std::move(bvh);
+    m_data = std::move(data);
+}
+
+TriangleMesh::TriangleMesh(std::shared_ptr<const MeshData> data, const Material& material)
+    : m_data(std::move(data)), m_material(material)
+{
+}
+
+std::shared_ptr<MeshData> TriangleMesh::makeData(std::vector<Vector3> vertices, std::vector<uint32_t> indices)
+{
+    if (indices.size() % 3 != 0)
+        throw GlobalException("TriangleMesh: index count " + std::to_string(indices.size()) + " is not a multiple of 3");
+    for (uint32_t index : indices) {
+        if (index >= vertices.size())
+            throw GlobalException("TriangleMesh: vertex index " + std::to_string(index) + " out of range");
+    }
+    auto data = std::make_shared<MeshData>();
+    data->vertices = std::move(vertices);
+    data->indices = std::move(indices);
+    return data;
+}
+
+bool TriangleMesh::intersectTriangle(const Ray& ray, uint32_t triangle, float& t, float& u, float& v) const
+{
+    // Möller–Trumbore, mêmes opérations que Triangle::intersect
+    constexpr float EPSILON = 1e-6f;
+    const std::vector<Vector3>& vertices = m_data->vertices;
+    const std::vector<uint32_t>& indices = m_data->indices;
+    const Vector3& a = vertices[indices[3 * triangle]];
+    Vector3 edge1 = vertices[indices[3 * triangle + 1]] - a;
+    Vector3 edge2 = vertices[indices[3 * triangle + 2]] - a;
+    const Vector3& dir = ray.getDirection();
+
+    Vector3 h = dir.cross(edge2);
+    float det = edge1.dot(h);
+    if (std::abs(det) < EPSILON)
+        return false;
+    float f = 1.0f / det;
+    Vector3 s = ray.getOrigin() - a;
+    u = f * s.dot(h);
+    if (u < 0.0f || u > 1.0f)
+        return false;
+    Vector3 q = s.cross(edge1);
+    v = f * dir.dot(q);
+    if (v < 0.0f || u + v > 1.0f)
+        return false;
+    t = f * edge2.dot(q);
+    return t > EPSILON;
+}
+
+int64_t TriangleMesh::findClosest(const Ray& ray, float& t, float& u, float& v) const
+{
+    float closestT = std::numeric_limits<float>::infinity();
+    int64_t closest = -1;
+    m_data->bvh.intersect(ray, closestT, [&](uint32_t triangle, float& tMax) {
+        float tt, uu, vv;
+        if (!intersectTriangle(ray, triangle, tt, uu, vv) || tt <= MESH_EPSILON || tt >= tMax)
+            return false;
+        tMax = tt;
+        u = uu;
+        v = vv;
+        closest = triangle;
+        return true;
+    });
+    if (closest >= 0)
+        t = closestT;
+    return closest;
+}
+
+bool TriangleMesh::intersect(const Ray& ray, float& t) const
+{
+    float u, v;
+    return findClosest(ray, t, u, v) >= 0;
+}
+
+bool TriangleMesh::intersect(const Ray& ray, HitRecord& hit) const
+{
+    float t, u, v;
+    int64_t triangle = findClosest(ray, t, u, v);
+    if (triangle < 0)
+        return false;
+    const std::vector<Vector3>& vertices = m_data->vertices;
+    const std::vector<uint32_t>& indices = m_data->indices;
+    const Vector3& a = vertices[indices[3 * triangle]];
+    Vector3 edge1 = vertices[indices[3 * triangle + 1]] - a;
+    Vector3 edge2 = vertices[indices[3 * triangle + 2]] - a;
+    hit.t = t;
+    hit.point = ray.at(t);
+    hit.normal = edge1.cross(edge2).normalized();
+    hit.primitive = this;
+    hit.u = u;
+    hit.v = v;
+    hit.hasUV = true;
+    return true;
+}
+
+bool TriangleMesh::occludes(const Ray& ray, float tMax) const
+{
+    return m_data->bvh.occluded(ray, tMax, [&](uint32_t triangle) {
+        float t, u, v;
+        return intersectTriangle(ray, triangle, t, u, v) && t > MESH_EPSILON && t < tMax;
+    });
+}
+
+void TriangleMesh::intersectPacket(const RayPacket& packet, uint32_t mask, PacketHit& hits) const
+{
+    if (!packet.isCoherent(mask)) {
+        IPrimitive::intersectPacket(packet, mask, hits);
+        return;
+    }
+    const std::vector<Vector3>& vertices = m_data->vertices;
+    const std::vector<uint32_t>& indices = m_data->indices;
+    int64_t closest[PACKET_SIZE];
+    float u[PACKET_SIZE], v[PACKET_SIZE];
+    for (int i = 0; i < PACKET_SIZE; ++i)
+        closest[i] = -1;
+    m_data->bvh.intersectPacket(packet, mask, hits.t, [&](uint32_t triangle, uint32_t lanes) {
+        const Vector3& a = vertices[indices[3 * triangle]];
+        Vector3 edge1 = vertices[indices[3 * triangle + 1]] - a;
+        Vector3 edge2 = vertices[indices[3 * triangle + 2]] - a;
+        FloatV uu, vv;
+        uint32_t closer = hits.closer(intersectTrianglePacket(packet, a, edge1, edge2, uu, vv), lanes, MESH_EPSILON);
+        if (closer == 0)
+            return;
+        float us[PACKET_SIZE], vs[PACKET_SIZE];
+        uu.store(us);
+        vv.store(vs);
+        for (int i = 0; i < PACKET_SIZE; ++i) {
+            if (closer & (1u << i)) {
+                closest[i] = triangle;
+                u[i] = us[i];
+                v[i] = vs[i];
+            }
+        }
+    });
+    // Les records ne sont remplis qu'une fois, pour le triangle finalement retenu
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        if (closest[i] < 0)
+            continue;
+        const Vector3& a = vertices[indices[3 * closest[i]]];
+        Vector3 edge1 = vertices[indices[3 * closest[i] + 1]] - a;
+        Vector3 edge2 = vertices[indices[3 * closest[i] + 2]] - a;
+        HitRecord& hit = hits.records[i];
+        hit.t = hits.t[i];
+        hit.point = packet.rays[i].at(hit.t);
+        hit.normal = edge1.cross(edge2).normalized();
+        hit.primitive = this;
+        hit.u = u[i];
+        hit.v = v[i];
+        hit.hasUV = true;
+    }
+}
+
+uint32_t TriangleMesh::occludesPacket(const RayPacket& packet, uint32_t mask, const float* tMax) const
+{
+    if (!packet.isCoherent(mask))
+        return IPrimitive::occludesPacket(packet, mask, tMax);
+    const std::vector<Vector3>& vertices = m_data->vertices;
+    const std::vector<uint32_t>& indices = m_data->indices;
+    const FloatV bound = FloatV::load(tMax);
+    return m_data->bvh.occludedPacket(packet, mask, tMax, [&](uint32_t triangle, uint32_t lanes) {
+        const Vector3& a = vertices[indices[3 * triangle]];
+        FloatV u, v;
+        FloatV t = intersectTrianglePacket(packet, a, vertices[indices[3 * triangle + 1]] - a,
+            vertices[indices[3 * triangle + 2]] - a, u, v);
+        return movemask((t > FloatV::broadcast(MESH_EPSILON)) & (t < bound) & laneMask(lanes));
+    });
+}
+
+Vector3 TriangleMesh::getNormal(const Vector3&) const
+{
+    return Vector3(0, 1, 0);
+}
+
+Color TriangleMesh::getColor() const
+{
+    return m_material.getColor();
+}
+
+const Material& TriangleMesh::getMaterial() const
+{
+    return m_material;
+}
+
+Vector3 TriangleMesh::getCenter() const
+{
+    return m_data->bvh.getBounds().centroid();
+}
+
+bool TriangleMesh::isBounded() const
+{
+    return !m_data->bvh.empty();
+}
+
+AABB TriangleMesh::getBoundingBox() const
+{
+    return m_data->bvh.getBounds();
+}
+
+size_t TriangleMesh::getTriangleCount() const
+{
+    return m_data->indices.size() / 3;
+}
+
+size_t TriangleMesh::getVertexCount() const
+{
+    return m_data->vertices.size();
+}
+
+const std::vector<Vector3>& TriangleMesh::getVertices() const
+{
+    return m_data->vertices;
+}
+
+const std::vector<uint32_t>& TriangleMesh::getIndices() const
+{
+    return m_data->indices;
+}
+
+const BVH& TriangleMesh::getBVH() const
+{
+    return m_data->bvh;
+}
+
+const std::shared_ptr<const MeshData>& TriangleMesh::getData() const
+{
+    return m_data;
+}
+
+}
@@ -0,0 +1,160 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** AdaptiveSampler
+*/
+
+#include "Renderer/AdaptiveSampler.hpp"
+#include <algorithm>
+#include <cmath>
+#include "Maths/RayPacket.hpp"
+
+namespace Raytracer {
+
+// Luminance relative (Rec. 709) de valeurs linéaires, 1.0 = 255
+static float luminance(float r, float g, float b)
+{
+    return 0.2126f * r + 0.7152f * g + 0.0722f * b;
+}
+
+static float radicalInverse(int index, int base)
+{
+    const float invBase = 1.0f / static_cast<float>(base);
+    float scale = invBase;
+    float result = 0.0f;
+    while (index > 0) {
+        result += static_cast<float>(index % base) * scale;
+        index /= base;
+        scale *= invBase;
+    }
+    return result;
+}
+
+AdaptiveSampler::AdaptiveSampler(const Renderer& renderer, const CameraRayGenerator& rayGenerator)
+    : m_renderer(renderer), m_rayGenerator(rayGenerator),
+      m_luminance(static_cast<size_t>(renderer.m_width) * renderer.m_height)
+{
+    const Framebuffer& image = renderer.m_image;
+    for (int y = 0; y < renderer.m_height; ++y) {
+        for (int x = 0; x < renderer.m_width; ++x) {
+            float r, g, b;
+            image.getPixel(x, y, r, g, b);
+            m_luminance[static_cast<size_t>(y) * renderer.m_width + x] = luminance(r, g, b);
+        }
+    }
+}
+
+void AdaptiveSampler::getSampleOffset(int index, float& u, float& v)
+{
+    if (index == 0) {
+        u = 0.5f;
+        v = 0.5f;
+        return;
+    }
+    u = radicalInverse(index, 2);
+    v = radicalInverse(index, 3);
+}
+
+bool AdaptiveSampler::hasContrast(int x, int y) const
+{
+    const int width = m_renderer.m_width;
+    const int height = m_renderer.m_height;
+    const float center = m_luminance[static_cast<size_t>(y) * width + x];
+    for (int ny = std::max(y - 1, 0); ny <= std::min(y + 1, height - 1); ++ny) {
+        for (int nx = std::max(x - 1, 0); nx <= std::min(x + 1, width - 1); ++nx) {
+            if (std::fabs(m_luminance[static_cast<size_t>(ny) * width + nx] - center) > m_renderer.m_noiseThreshold)
+                return true;
+        }
+    }
+    return false;
+}
+
+void AdaptiveSampler::sample(std::vector<PixelState>& pixels, const std::vector<uint32_t>& active, int target) const
+{
+    constexpr float scale = 1.0f / 255.0f;
+    Ray rays[PACKET_SIZE];
+    uint32_t owners[PACKET_SIZE];
+    int count = 0;
+
+    auto flush = [&]() {
+        Color colors[PACKET_SIZE];
+        m_renderer.tracePacket(RayPacket(rays, count), RayPacket::maskOf(count), colors);
+        for (int i = 0; i < count; ++i) {
+            PixelState& state = pixels[owners[i]];
+            const float r = colors[i].getR() * scale;
+            const float g = colors[i].getG() * scale;
+            const float b = colors[i].getB() * scale;
+            const double l = luminance(r, g, b);
+            state.r += r;
+            state.g += g;
+            state.b += b;
+            state.sum += l;
+            state.sumSquares += l * l;
+            ++state.count;
+        }
+        count = 0;
+    };
+
+    // Les échantillons d'un même pixel se suivent : chaque paquet reste très cohérent
+    for (uint32_t index : active) {
+        const PixelState& state = pixels[index];
+        for (int i = state.count; i < target; ++i) {
+            float u, v;
+            getSampleOffset(i, u, v);
+            rays[count] = Ray(m_rayGenerator.getOrigin(), m_rayGenerator.getDirection(state.x + u, state.y + v));
+            owners[count] = index;
+            if (++count == PACKET_SIZE)
+                flush();
+        }
+    }
+    if (count > 0)
+        flush();
+}
+
+uint64_t AdaptiveSampler::refineTile(Framebuffer::TileView& view) const
+{
+    const Tile& tile = view.getTile();
+    const int maxSamples = m_renderer.m_maxSamples;
+    const double threshold = m_renderer.m_noiseThreshold;
+
+    // L'échantillon central du premier passage compte comme échantillon 0
+    std::vector<PixelState> pixels;
+    for (int y = tile.y0; y < tile.y1; ++y) {
+        for (int x = tile.x0; x < tile.x1; ++x) {
+            if (!hasContrast(x, y))
+                continue;
+            float r, g, b;
+            m_renderer.m_image.getPixel(x, y, r, g, b);
+            const double l = luminance(r, g, b);
+            pixels.push_back({x, y, 1, r, g, b, l, l * l});
+        }
+    }
+    std::vector<uint32_t> active(pixels.size());
+    for (uint32_t i = 0; i < active.size(); ++i)
+        active[i] = i;
+
+    uint64_t added = 0;
+    for (int target = std::min(FIRST_ROUND, maxSamples); !active.empty(); target = std::min(target * 2, maxSamples)) {
+        for (uint32_t index : active)
+            added += static_cast<uint64_t>(target - pixels[index].count);
+        sample(pixels, active, target);
+        if (target == maxSamples)
+            break;
+        // Erreur type de la luminance moyenne : on s'arrête sous le seuil
+        std::erase_if(active, [&](uint32_t index) {
+            const PixelState& state = pixels[index];
+            const double n = state.count;
+            const double variance = std::max(0.0, (state.sumSquares - state.sum * state.sum / n) / (n - 1.0));
+            return std::sqrt(variance / n) <= threshold;
+        });
+    }
+
+    for (const PixelState& state : pixels) {
+        const float inverse = 1.0f / static_cast<float>(state.count);
+        view.setPixel(state.x, state.y, state.r * inverse, state.g * inverse, state.b * inverse);
+    }
+    return added;
+}
+
+}
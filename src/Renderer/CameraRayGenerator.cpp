@@ -0,0 +1,74 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** CameraRayGenerator
+*/
+
+#include "Renderer/CameraRayGenerator.hpp"
+#include <cmath>
+
+namespace Raytracer {
+
+// Rotation X puis Y puis Z (degrés), calculée en double une seule fois par image
+static Vector3 rotateDirection(const Vector3& v, const Vector3& rotation)
+{
+    const double pitch = rotation.x * M_PI / 180.0;
+    const double yaw = rotation.y * M_PI / 180.0;
+    const double roll = rotation.z * M_PI / 180.0;
+    double x = v.x, y = v.y, z = v.z;
+    double y1 = y * std::cos(pitch) - z * std::sin(pitch);
+    double z1 = y * std::sin(pitch) + z * std::cos(pitch);
+    double x2 = x * std::cos(yaw) + z1 * std::sin(yaw);
+    double z2 = -x * std::sin(yaw) + z1 * std::cos(yaw);
+    double x3 = x2 * std::cos(roll) - y1 * std::sin(roll);
+    double y3 = x2 * std::sin(roll) + y1 * std::cos(roll);
+    return Vector3(static_cast<float>(x3), static_cast<float>(y3), static_cast<float>(z2));
+}
+
+CameraRayGenerator::CameraRayGenerator(const Camera& camera, int width, int height)
+    : m_origin(camera.getPosition())
+{
+    const double aspect = double(width) / height;
+    const double fovScale = std::tan(camera.getFieldOfView() * 0.5 * M_PI / 180.0);
+    const double halfWidth = aspect * fovScale;
+    const double halfHeight = fovScale;
+
+    // Plan image à z = 1 : x va de -halfWidth à +halfWidth, y de +halfHeight à -halfHeight
+    const Vector3& rotation = camera.getRotation();
+    Vector3 right = rotateDirection(Vector3(1.0f, 0.0f, 0.0f), rotation);
+    Vector3 up = rotateDirection(Vector3(0.0f, 1.0f, 0.0f), rotation);
+    Vector3 forward = rotateDirection(Vector3(0.0f, 0.0f, 1.0f), rotation);
+    m_stepX = right * static_cast<float>(2.0 * halfWidth / width);
+    m_stepY = up * static_cast<float>(-2.0 * halfHeight / height);
+    m_topLeft = forward + right * static_cast<float>(-halfWidth) + up * static_cast<float>(halfHeight);
+}
+
+Ray CameraRayGenerator::generate(int x, int y) const
+{
+    return Ray(m_origin, getDirection(x + 0.5f, y + 0.5f));
+}
+
+void CameraRayGenerator::generateRow(int y, int x0, int count, float* dirX, float* dirY, float* dirZ) const
+{
+    // La colonne absolue est utilisée (pas x0 + i cumulé) : un pixel reçoit la même
+    // direction quel que soit le découpage en tuiles
+    const Vector3 rowStart = m_topLeft + m_stepY * (y + 0.5f);
+    for (int i = 0; i < count; ++i) {
+        const float u = static_cast<float>(x0 + i) + 0.5f;
+        const float dx = rowStart.x + m_stepX.x * u;
+        const float dy = rowStart.y + m_stepX.y * u;
+        const float dz = rowStart.z + m_stepX.z * u;
+        const float invLength = 1.0f / std::sqrt(dx * dx + dy * dy + dz * dz);
+        dirX[i] = dx * invLength;
+        dirY[i] = dy * invLength;
+        dirZ[i] = dz * invLength;
+    }
+}
+
+const Vector3& CameraRayGenerator::getOrigin() const
+{
+    return m_origin;
+}
+
+}
@@ -0,0 +1,80 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** CostMap
+*/
+
+#include "Renderer/CostMap.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "Utils/ImageEncoder.hpp"
+
+namespace Raytracer {
+
+CostMap::CostMap(int width, int height)
+    : m_costs(width, height, Framebuffer::RGB_FLOAT32)
+{
+}
+
+float CostMap::getCost(int x, int y, Channel channel) const
+{
+    float values[CHANNEL_COUNT];
+    m_costs.getPixel(x, y, values[TIME], values[TESTS], values[STEPS]);
+    return values[channel];
+}
+
+const Framebuffer& CostMap::getCosts() const
+{
+    return m_costs;
+}
+
+Framebuffer CostMap::getFalseColor(Channel channel) const
+{
+    const int width = m_costs.getWidth();
+    const int height = m_costs.getHeight();
+    std::vector<float> sorted;
+    sorted.reserve(static_cast<size_t>(width) * height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x)
+            sorted.push_back(getCost(x, y, channel));
+    }
+    float scale = 0.0f;
+    if (!sorted.empty()) {
+        auto percentile = sorted.begin() + (sorted.size() - 1) * 99 / 100;
+        std::nth_element(sorted.begin(), percentile, sorted.end());
+        scale = *percentile;
+    }
+
+    Framebuffer image(width, height, Framebuffer::RGB8);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x)
+            image.setPixel(x, y, getHeatColor(scale > 0.0f ? getCost(x, y, channel) / scale : 0.0f));
+    }
+    return image;
+}
+
+Color CostMap::getHeatColor(float value)
+{
+    static constexpr int STOPS = 5;
+    static constexpr float colors[STOPS][3] = {
+        {0.0f, 0.0f, 0.0f}, {40.0f, 0.0f, 140.0f}, {190.0f, 30.0f, 120.0f}, {250.0f, 140.0f, 20.0f}, {255.0f, 255.0f, 210.0f}
+    };
+    float position = std::clamp(value, 0.0f, 1.0f) * (STOPS - 1);
+    int index = std::min(static_cast<int>(position), STOPS - 2);
+    float blend = position - index;
+    const float* low = colors[index];
+    const float* high = colors[index + 1];
+    return Color(static_cast<int>(low[0] + (high[0] - low[0]) * blend + 0.5f),
+        static_cast<int>(low[1] + (high[1] - low[1]) * blend + 0.5f),
+        static_cast<int>(low[2] + (high[2] - low[2]) * blend + 0.5f));
+}
+
+bool CostMap::write(const std::string& imageFile, const std::string& rawFile, Channel channel) const
+{
+    bool image = ImageEncoder::write(imageFile, getFalseColor(channel));
+    return ImageEncoder::write(rawFile, m_costs) && image;
+}
+
+}
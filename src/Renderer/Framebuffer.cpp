@@ -0,0 +1,271 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** Framebuffer
+*/
+
+#include "Renderer/Framebuffer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include "GlobalException.hpp"
+
+namespace Raytracer {
+
+static uint8_t toByte(float value)
+{
+    return static_cast<uint8_t>(std::clamp(std::lround(value * 255.0f), 0L, 255L));
+}
+
+Framebuffer::TileView::TileView(Framebuffer& framebuffer, const Tile& tile)
+    : m_framebuffer(framebuffer), m_tile(tile)
+{
+}
+
+const Tile& Framebuffer::TileView::getTile() const
+{
+    return m_tile;
+}
+
+Framebuffer::Framebuffer(int width, int height, Format format, size_t stride)
+    : m_width(width), m_height(height), m_format(format), m_stride(stride), m_data(nullptr)
+{
+    if (width < 0 || height < 0)
+        throw GlobalException("Framebuffer: invalid size " + std::to_string(width) + "x" + std::to_string(height));
+    size_t rowSize = static_cast<size_t>(width) * getPixelSize(format);
+    if (m_stride == 0)
+        m_stride = (rowSize + ROW_ALIGNMENT - 1) / ROW_ALIGNMENT * ROW_ALIGNMENT;
+    else if (m_stride < rowSize)
+        throw GlobalException("Framebuffer: stride " + std::to_string(stride) + " is smaller than a row (" + std::to_string(rowSize) + " bytes)");
+    m_storage.assign(m_stride * height + ROW_ALIGNMENT, 0);
+    alignData();
+    clear();
+}
+
+Framebuffer::Framebuffer(const Framebuffer& other)
+    : m_width(other.m_width), m_height(other.m_height), m_format(other.m_format), m_stride(other.m_stride),
+      m_storage(other.m_storage.size()), m_data(nullptr)
+{
+    // Le décalage d'alignement dépend de l'allocation : les pixels sont recopiés à partir de m_data
+    alignData();
+    std::memcpy(m_data, other.m_data, m_stride * m_height);
+}
+
+Framebuffer& Framebuffer::operator=(const Framebuffer& other)
+{
+    if (this != &other)
+        *this = Framebuffer(other);
+    return *this;
+}
+
+void Framebuffer::alignData()
+{
+    uintptr_t address = reinterpret_cast<uintptr_t>(m_storage.data());
+    size_t offset = (ROW_ALIGNMENT - address % ROW_ALIGNMENT) % ROW_ALIGNMENT;
+    m_data = m_storage.data() + offset;
+}
+
+int Framebuffer::getWidth() const
+{
+    return m_width;
+}
+
+int Framebuffer::getHeight() const
+{
+    return m_height;
+}
+
+Framebuffer::Format Framebuffer::getFormat() const
+{
+    return m_format;
+}
+
+size_t Framebuffer::getStride() const
+{
+    return m_stride;
+}
+
+size_t Framebuffer::getPixelSize(Format format)
+{
+    switch (format) {
+        case RGB_FLOAT32:
+            return 3 * sizeof(float);
+        case RGBA_HALF:
+            return 4 * sizeof(uint16_t);
+        case RGB8:
+            return 3;
+    }
+    return 0;
+}
+
+void Framebuffer::setPixel(int x, int y, float r, float g, float b)
+{
+    uint8_t* pixel = getRow(y) + static_cast<size_t>(x) * getPixelSize(m_format);
+    switch (m_format) {
+        case RGB_FLOAT32: {
+            const float values[3] = {r, g, b};
+            std::memcpy(pixel, values, sizeof(values));
+            break;
+        }
+        case RGBA_HALF: {
+            const uint16_t values[4] = {toHalf(r), toHalf(g), toHalf(b), toHalf(1.0f)};
+            std::memcpy(pixel, values, sizeof(values));
+            break;
+        }
+        case RGB8:
+            pixel[0] = toByte(r);
+            pixel[1] = toByte(g);
+            pixel[2] = toByte(b);
+            break;
+    }
+}
+
+void Framebuffer::setPixel(int x, int y, const Color& color)
+{
+    if (m_format == RGB8) {
+        uint8_t* pixel = getRow(y) + static_cast<size_t>(x) * 3;
+        pixel[0] = static_cast<uint8_t>(std::clamp(color.getR(), 0, 255));
+        pixel[1] = static_cast<uint8_t>(std::clamp(color.getG(), 0, 255));
+        pixel[2] = static_cast<uint8_t>(std::clamp(color.getB(), 0, 255));
+        return;
+    }
+    constexpr float scale = 1.0f / 255.0f;
+    setPixel(x, y, color.getR() * scale, color.getG() * scale, color.getB() * scale);
+}
+
+void Framebuffer::getPixel(int x, int y, float& r, float& g, float& b) const
+{
+    const uint8_t* pixel = getRow(y) + static_cast<size_t>(x) * getPixelSize(m_format);
+    switch (m_format) {
+        case RGB_FLOAT32: {
+            float values[3];
+            std::memcpy(values, pixel, sizeof(values));
+            r = values[0];
+            g = values[1];
+            b = values[2];
+            break;
+        }
+        case RGBA_HALF: {
+            uint16_t values[4];
+            std::memcpy(values, pixel, sizeof(values));
+            r = fromHalf(values[0]);
+            g = fromHalf(values[1]);
+            b = fromHalf(values[2]);
+            break;
+        }
+        case RGB8:
+            r = pixel[0] / 255.0f;
+            g = pixel[1] / 255.0f;
+            b = pixel[2] / 255.0f;
+            break;
+    }
+}
+
+Color Framebuffer::getColor(int x, int y) const
+{
+    if (m_format == RGB8) {
+        const uint8_t* pixel = getRow(y) + static_cast<size_t>(x) * 3;
+        return Color(pixel[0], pixel[1], pixel[2]);
+    }
+    float r = 0.0f, g = 0.0f, b = 0.0f;
+    getPixel(x, y, r, g, b);
+    return Color(toByte(r), toByte(g), toByte(b));
+}
+
+void Framebuffer::readRow(int y, uint8_t* rgb) const
+{
+    const uint8_t* row = getRow(y);
+    if (m_format == RGB8) {
+        std::memcpy(rgb, row, static_cast<size_t>(m_width) * 3);
+        return;
+    }
+    for (int x = 0; x < m_width; ++x) {
+        float r = 0.0f, g = 0.0f, b = 0.0f;
+        getPixel(x, y, r, g, b);
+        rgb[3 * x] = toByte(r);
+        rgb[3 * x + 1] = toByte(g);
+        rgb[3 * x + 2] = toByte(b);
+    }
+}
+
+void Framebuffer::readRow(int y, float* rgb) const
+{
+    if (m_format == RGB_FLOAT32) {
+        std::memcpy(rgb, getRow(y), static_cast<size_t>(m_width) * 3 * sizeof(float));
+        return;
+    }
+    for (int x = 0; x < m_width; ++x)
+        getPixel(x, y, rgb[3 * x], rgb[3 * x + 1], rgb[3 * x + 2]);
+}
+
+void Framebuffer::clear()
+{
+    // Tous les formats valent 0 bit à bit pour le noir, sauf l'alpha des demi-flottants
+    std::memset(m_data, 0, m_stride * m_height);
+    if (m_format != RGBA_HALF)
+        return;
+    for (int y = 0; y < m_height; ++y) {
+        for (int x = 0; x < m_width; ++x)
+            setPixel(x, y, 0.0f, 0.0f, 0.0f);
+    }
+}
+
+Framebuffer::TileView Framebuffer::getTileView(const Tile& tile)
+{
+    return TileView(*this, tile);
+}
+
+uint16_t Framebuffer::toHalf(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    const uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+    if (magnitude >= 0x7F800000u) // Infini ou NaN (le NaN reste un NaN silencieux)
+        return static_cast<uint16_t>(sign | 0x7C00u | (magnitude > 0x7F800000u ? 0x200u : 0u));
+    if (magnitude >= 0x477FF000u) // 65520 et plus s'arrondissent à l'infini
+        return static_cast<uint16_t>(sign | 0x7C00u);
+    if (magnitude < 0x38800000u) { // Sous 2^-14 : dénormalisé ou zéro
+        if (magnitude < 0x33000000u)
+            return static_cast<uint16_t>(sign);
+        const uint32_t exponent = magnitude >> 23;
+        const uint32_t mantissa = (magnitude & 0x7FFFFFu) | 0x800000u;
+        const uint32_t shift = 126 - exponent;
+        uint32_t half = mantissa >> shift;
+        const uint32_t rest = mantissa & ((1u << shift) - 1);
+        const uint32_t halfway = 1u << (shift - 1);
+        if (rest > halfway || (rest == halfway && (half & 1u)))
+            ++half;
+        return static_cast<uint16_t>(sign | half);
+    }
+    // Normalisé : changement de biais 127 -> 15, arrondi au pair le plus proche
+    uint32_t half = ((magnitude >> 23) - 112) << 10 | ((magnitude & 0x7FFFFFu) >> 13);
+    const uint32_t rest = magnitude & 0x1FFFu;
+    if (rest > 0x1000u || (rest == 0x1000u && (half & 1u)))
+        ++half;
+    return static_cast<uint16_t>(sign | half);
+}
+
+float Framebuffer::fromHalf(uint16_t half)
+{
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1Fu;
+    const uint32_t mantissa = half & 0x3FFu;
+    uint32_t bits;
+    if (exponent == 0x1F) {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    } else if (exponent == 0) {
+        float value = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -value : value;
+    } else {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    }
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+}
@@ -2,10 +2,15 @@
 
 #include "Renderer/Renderer.hpp"
 #include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cmath>
-#include "Lights/AmbientLight.hpp"
-#include "Lights/CompositeLight.hpp"
-#include "Primitives/CompositePrimitive.hpp"
+#include <utility>
+#include "Renderer/AdaptiveSampler.hpp"
+#include "Renderer/CameraRayGenerator.hpp"
+#include "Renderer/TileScheduler.hpp"
+#include "Renderer/WavefrontIntegrator.hpp"
+#include "Utils/RenderStats.hpp"
 
 constexpr float EPSILON = 0.001f;
 
@@ -15,38 +20,10 @@ constexpr float EPSILON = 0.001f;
  * @param scene Reference to the scene to render
  * @param width Width of the output image in pixels
  * @param height Height of the output image in pixels
+ * @param format Pixel format of the framebuffer
  */
-Raytracer::Renderer::Renderer(const Scene& scene, int width, int height) : m_scene(scene), m_width(width), m_height(height) {
-  m_image.resize(m_height, std::vector<Color>(m_width, Color(0, 0, 0)));
-}
-
-/**
- * @brief Computes the ray direction for a given pixel
- * 
- * This method converts pixel coordinates to a ray direction vector in world space,
- * taking into account the camera's field of view, aspect ratio, and orientation.
- * 
- * @param x X-coordinate of the pixel (0 to width-1)
- * @param y Y-coordinate of the pixel (0 to height-1)
- * @return Vector3 Normalized ray direction in world space
- */
-Raytracer::Vector3 Raytracer::Renderer::computeRayDirection(int x, int y) const {
-  float aspect = float(m_width) / m_height;
-  float fovScale = std::tan(m_scene.getCamera().getFieldOfView() * 0.5f * M_PI / 180.0f);
-  float px = (2.0f * (x + 0.5f) / m_width - 1.0f) * aspect * fovScale;
-  float py = (1.0f - 2.0f * (y + 0.5f) / m_height) * fovScale;
-  Vector3 dir(px, py, 1.0f);
-  dir = dir.normalized();
-
-  auto rot = m_scene.getCamera().getRotation();
-  float pitch = rot.x * M_PI / 180.0f;
-  float yaw = rot.y * M_PI / 180.0f;
-  float roll = rot.z * M_PI / 180.0f;
-
-  dir = rotateX(dir, pitch);
-  dir = rotateY(dir, yaw);
-  dir = rotateZ(dir, roll);
-  return dir.normalized();
+Raytracer::Renderer::Renderer(const Scene& scene, int width, int height, Framebuffer::Format format)
+  : m_scene(scene), m_camera(scene.getCamera()), m_width(width), m_height(height), m_image(width, height, format) {
 }
 
 /**
@@ -61,42 +38,89 @@ Raytracer::Vector3 Raytracer::Renderer::computeRayDirection(int x, int y) const
  * @return Color The computed color for this ray
  */
 Raytracer::Color Raytracer::Renderer::traceRay(const Ray& ray, int depth) const {
-  if (depth > 3)
+  if (depth > MAX_DEPTH)
     return {0, 0, 0};
+  // Les rayons primaires passent par tracePacket : ici, seulement des rebonds
+  RenderStats::count(RenderStats::REFLECTION_RAYS);
   
-  float closestT = std::numeric_limits<float>::infinity();
-  std::shared_ptr<IPrimitive> hitPrim = nullptr;
-  
-  auto rootComposite = m_scene.getRootCompositePrimitive();
-  if (rootComposite && rootComposite->intersect(ray, closestT)) {
-    Vector3 point = ray.at(closestT);
-    Vector3 normal = rootComposite->getNormal(point);
-    const Material& material = rootComposite->getMaterial();
-    Color base = material.getColor();
-    Color refl = getReflectionColor(point, normal, ray, depth);
-    return shadeHit(point, normal, base, refl, material);
+  // La scène compilée contient toutes les primitives et passe par sa BVH
+  HitRecord hit;
+  if (m_geometry->intersect(ray, hit)) {
+    Color refl = getReflectionColor(hit, ray, depth);
+    return shadeHit(hit, refl);
   }
   
-  for (const auto& prim : m_scene.getPrimitives()) {
-    float t;
-    if (prim->intersect(ray, t) && t > EPSILON && t < closestT) {
-      closestT = t;
-      hitPrim = prim;
+  return getSkyColor(ray);
+}
+
+/**
+ * @brief Gets the sky color seen by a ray that hits nothing
+ * 
+ * @param ray The ray
+ * @return Color Gradient from the ray's vertical direction
+ */
+Raytracer::Color Raytracer::Renderer::getSkyColor(const Ray& ray) {
+  float t = 0.5f * (ray.getDirection().y + 1.0f);
+  return Color(int(255 * (1 - t)), int(255 * t), 255);
+}
+
+/**
+ * @brief Traces a packet of primary rays
+ * 
+ * The closest hits of the packet are searched together, then one shadow
+ * packet per light tells which hit points see that light. Shading and
+ * reflections reuse the scalar code with those visibility bits.
+ * 
+ * @param packet Primary rays
+ * @param mask Lanes holding a ray
+ * @param colors Output color of each lane of mask
+ */
+void Raytracer::Renderer::tracePacket(const RayPacket& packet, uint32_t mask, Color* colors) const {
+  RenderStats::count(RenderStats::PRIMARY_RAYS, std::popcount(mask));
+  PacketHit hits;
+  m_geometry->intersectPacket(packet, mask, hits);
+
+  uint32_t hitMask = 0;
+  for (int i = 0; i < PACKET_SIZE; ++i) {
+    if (!(mask & (1u << i)))
+      continue;
+    if (hits.records[i].primitive)
+      hitMask |= 1u << i;
+    else
+      colors[i] = getSkyColor(packet.rays[i]);
+  }
+  if (hitMask == 0)
+    return;
+
+  // Un paquet d'ombre par lumière : mêmes rayons que ceux que shadeHit construirait
+  uint64_t shadowed[PACKET_SIZE] = {};
+  uint64_t tested = 0;
+  for (size_t l = 0; l < m_lights->getCount() && l < 64; ++l) {
+    Ray shadowRays[PACKET_SIZE];
+    float lightDistance[PACKET_SIZE];
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+      if (!(hitMask & (1u << i)))
+        continue;
+      const HitRecord& hit = hits.records[i];
+      shadowRays[i] = getShadowRay(hit, m_lights->getDirection(l, hit.point));
+      lightDistance[i] = m_lights->getDistance(l, shadowRays[i].getOrigin());
     }
+    RayPacket shadowPacket(shadowRays, PACKET_SIZE);
+    RenderStats::count(RenderStats::SHADOW_RAYS, std::popcount(hitMask));
+    uint32_t occluded = m_geometry->occludesPacket(shadowPacket, hitMask, lightDistance);
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+      if (occluded & (1u << i))
+        shadowed[i] |= uint64_t(1) << l;
+    }
+    tested |= uint64_t(1) << l;
   }
-  
-  if (hitPrim) {
-    Vector3 point = ray.at(closestT);
-    Vector3 normal = hitPrim->getNormal(point);
-    const Material& material = hitPrim->getMaterial();
-    Color base = material.getColor();
-    Color refl = getReflectionColor(point, normal, ray, depth);
-    return shadeHit(point, normal, base, refl, material);
+
+  for (int i = 0; i < PACKET_SIZE; ++i) {
+    if (!(hitMask & (1u << i)))
+      continue;
+    Color refl = getReflectionColor(hits.records[i], packet.rays[i], 1);
+    colors[i] = shadeHit(hits.records[i], refl, shadowed[i], tested);
   }
-  
-  // Couleur du ciel (pas d'intersection)
-  float t = 0.5f * (ray.getDirection().y + 1.0f);
-  return Color(int(255 * (1 - t)), int(255 * t), 255);
 }
 
 /**
@@ -105,16 +129,37 @@ Raytracer::Color Raytracer::Renderer::traceRay(const Ray& ray, int depth) const
  * Creates a reflection ray and traces it to determine what color is reflected
  * at the given point.
  * 
- * @param hitPoint The point of intersection
- * @param normal Surface normal at the hit point
+ * @param hit Description of the intersection
  * @param ray The incoming ray that hit the surface
  * @param depth Current recursion depth
  * @return Color The reflected color
  */
-Raytracer::Color Raytracer::Renderer::getReflectionColor(const Vector3& hitPoint, const Vector3& normal, const Ray& ray, int depth) const {
+Raytracer::Color Raytracer::Renderer::getReflectionColor(const HitRecord& hit, const Ray& ray, int depth) const {
+  return traceRay(getReflectionRay(hit, ray), depth + 1);
+}
+
+/**
+ * @brief Builds the mirror ray leaving a hit point
+ * 
+ * @param hit Description of the intersection
+ * @param ray The incoming ray that hit the surface
+ * @return Ray The reflected ray, starting EPSILON above the surface
+ */
+Raytracer::Ray Raytracer::Renderer::getReflectionRay(const HitRecord& hit, const Ray& ray) {
+  const Vector3& normal = hit.normal;
   Vector3 reflectDir = ray.getDirection() - normal * (2.0f * ray.getDirection().dot(normal));
-  Ray reflectRay(hitPoint + normal * EPSILON, reflectDir.normalized());
-  return traceRay(reflectRay, depth + 1);
+  return Ray(hit.point + normal * EPSILON, reflectDir.normalized());
+}
+
+/**
+ * @brief Builds the ray from a hit point towards a light
+ * 
+ * @param hit Description of the intersection
+ * @param lightDir Normalized direction of the light from the hit point
+ * @return Ray The shadow ray, starting EPSILON above the surface
+ */
+Raytracer::Ray Raytracer::Renderer::getShadowRay(const HitRecord& hit, const Vector3& lightDir) {
+  return Ray(hit.point + hit.normal * EPSILON, lightDir);
 }
 
 /**
@@ -123,93 +168,68 @@ Raytracer::Color Raytracer::Renderer::getReflectionColor(const Vector3& hitPoint
  * Computes the color at a point based on the material properties, light sources,
  * shadows, and reflections.
  * 
- * @param hitPoint The point of intersection
- * @param normal Surface normal at the hit point
- * @param baseColor The base color of the material
+ * @param hit Description of the intersection (point, normal, primitive hit)
  * @param reflectionColor The color from reflections
- * @param material The material properties of the hit surface
+ * @param shadowedLights Lights (bit = index) already known to be hidden from the point
+ * @param testedLights Lights (bit = index) whose visibility is given by shadowedLights
  * @return Color The final shaded color
  */
-Raytracer::Color Raytracer::Renderer::shadeHit(const Vector3& hitPoint, const Vector3& normal, const Color& baseColor, const Color& reflectionColor, const Material& material) const {
-  float ambientStrength = 0;
-
-  // Recherche de la lumière ambiante
-  for (auto light : m_scene.getLights()) {
-    auto ambientLight = dynamic_cast<Raytracer::AmbientLight*>(light.get());
-    if (ambientLight) {
-      ambientStrength = ambientLight->getIntensity();
-      break;
-    }
-  }
+Raytracer::Color Raytracer::Renderer::shadeHit(const HitRecord& hit, const Color& reflectionColor, uint64_t shadowedLights, uint64_t testedLights) const {
+  const Vector3& hitPoint = hit.point;
+  const Vector3& normal = hit.normal;
+  // Termes du matériau précalculés par la palette : une seule ligne de cache lue
+  const MaterialPalette::Entry& material = m_geometry->getPalette()[hit.material];
+  // Terme ambiant déjà sommé par la table des lumières
+  float ambientStrength = m_lights->getAmbient();
 
-  float r = baseColor.getR() * ambientStrength;
-  float g = baseColor.getG() * ambientStrength;
-  float b = baseColor.getB() * ambientStrength;
-  Vector3 viewDir = (m_scene.getCamera().getPosition() - hitPoint).normalized();
+  float r = material.red * ambientStrength;
+  float g = material.green * ambientStrength;
+  float b = material.blue * ambientStrength;
+  Vector3 viewDir = (m_camera.getPosition() - hitPoint).normalized();
 
 
-  for (const auto& light : m_scene.getLights()) {
-    // Ignorer les lumières ambiantes (déjà traitées)
-    if (dynamic_cast<Raytracer::AmbientLight*>(light.get())) {
-      continue;
-    }
-    
-    // Ignorer les composites (nous traitons les lumières directement)
-    if (dynamic_cast<Raytracer::CompositeLight*>(light.get())) {
-      continue;
-    }
-    
-    Vector3 lightDir = light->getDirectionFrom(hitPoint).normalized();
-    Ray shadowRay(hitPoint + normal * EPSILON, lightDir);
-    bool inShadow = false;
-    
-    // Test d'intersection optimisé avec le composite racine
-    auto rootPrimitives = m_scene.getRootCompositePrimitive();
-    float shadowT;
-    if (rootPrimitives && rootPrimitives->intersect(shadowRay, shadowT) && shadowT > EPSILON) {
-      inShadow = true;
+  for (size_t l = 0; l < m_lights->getCount(); ++l) {
+    Vector3 lightDir = m_lights->getDirection(l, hitPoint);
+    uint64_t lightBit = l < 64 ? uint64_t(1) << l : 0;
+    if (testedLights & lightBit) {
+      if (shadowedLights & lightBit)
+        continue;
+    } else {
+      // Requête d'occultation : premier obstacle entre le point et la lumière, pas le plus proche
+      Ray shadowRay = getShadowRay(hit, lightDir);
+      float lightDistance = m_lights->getDistance(l, shadowRay.getOrigin());
+      RenderStats::count(RenderStats::SHADOW_RAYS);
+      if (m_geometry->occludes(shadowRay, lightDistance))
+        continue;
     }
-    
-    if (inShadow)
-      continue;
       
-    float intensity = light->getIntensity();
+    float intensity = m_lights->getIntensity(l);
     float diffuseFactor = 0.7f;
-    float specularFactor = 0.1f;
     
     // Diffuse
     float diff = std::max(0.f, normal.dot(lightDir)) * diffuseFactor * intensity;
 
     // Specular (Blinn-Phong)
     Vector3 halfway = (lightDir + viewDir).normalized();
-    float shininess = 64.0f;
-    if (material.getType() == Material::METAL) {
-      shininess = 128.0f - material.getRoughness() * 120.0f;
-      specularFactor = 0.2f;
-    }
-    float spec = std::pow(std::max(0.f, normal.dot(halfway)), shininess) * intensity;
+    float spec = std::pow(std::max(0.f, normal.dot(halfway)), material.shininess) * intensity;
     
-    r += baseColor.getR() * diff + 255.f * spec * specularFactor;
-    g += baseColor.getG() * diff + 255.f * spec * specularFactor;
-    b += baseColor.getB() * diff + 255.f * spec * specularFactor;
+    r += material.red * diff + 255.f * spec * material.specular;
+    g += material.green * diff + 255.f * spec * material.specular;
+    b += material.blue * diff + 255.f * spec * material.specular;
   }
   
   // Réflexions
-  float reflectivity = material.getReflectivity();
-  if (material.getType() == Material::METAL) {
-    reflectivity = 0.8f - material.getRoughness() * 0.6f;
-  }
+  float reflectivity = material.reflectance;
   
   r = r * (1.0f - reflectivity) + reflectionColor.getR() * reflectivity;
   g = g * (1.0f - reflectivity) + reflectionColor.getG() * reflectivity;
   b = b * (1.0f - reflectivity) + reflectionColor.getB() * reflectivity;
   
   // Ajout de l'émission lumineuse pour les matériaux émissifs
-  if (material.getType() == Material::EMISSIVE && material.getEmissiveIntensity() > 0) {
-    float emission = material.getEmissiveIntensity();
-    r += baseColor.getR() * emission;
-    g += baseColor.getG() * emission;
-    b += baseColor.getB() * emission;
+  if (material.emission > 0) {
+    r += material.red * material.emission;
+    g += material.green * material.emission;
+    b += material.blue * material.emission;
   }
 
   return Color(int(std::clamp(r, 0.f, 255.f)), int(std::clamp(g, 0.f, 255.f)), int(std::clamp(b, 0.f, 255.f)));
@@ -218,69 +238,240 @@ Raytracer::Color Raytracer::Renderer::shadeHit(const Vector3& hitPoint, const Ve
 /**
  * @brief Executes the main rendering process
  * 
- * Iterates over each pixel of the output image, computes the ray direction,
- * traces the ray through the scene, and stores the resulting color.
+ * Cuts the output image into tiles distributed over m_threadCount threads.
+ * Primary ray directions come row by row from a CameraRayGenerator built once
+ * per frame and are traced in packets of PACKET_SIZE neighbouring pixels.
+ * In WAVEFRONT mode, each (larger) tile is handed to a WavefrontIntegrator.
+ * With m_maxSamples above 1, a second pass over the whole image lets an
+ * AdaptiveSampler add samples where the first pass shows contrast.
+ * Each pixel is written by exactly one thread, so the image buffer needs no locking.
+ * The tile callback, if any, is called as soon as a tile is final.
  */
 void Raytracer::Renderer::render() {
-  for (int y = 0; y < m_height; ++y) {
-    for (int x = 0; x < m_width; ++x) {
-      Vector3 dir = computeRayDirection(x, y);
-      Ray ray(m_scene.getCamera().getPosition(), dir);
-      m_image[y][x] = traceRay(ray, 1);
+  // Base de la caméra et incréments par pixel calculés une fois par image
+  RenderStats::ScopedPhase renderPhase(RenderStats::RENDER);
+  const CameraRayGenerator rayGenerator(m_camera, m_width, m_height);
+  {
+    RenderStats::ScopedPhase buildPhase(RenderStats::BUILD);
+    // Tables partagées par setCompiled() : rien à reconstruire
+    m_lights = m_sharedLights ? m_sharedLights : std::make_shared<const LightTable>(m_scene.createLightTable());
+    m_geometry = m_sharedGeometry ? m_sharedGeometry : std::make_shared<const CompiledScene>(m_scene.compile());
+  }
+  const bool refine = m_maxSamples > 1;
+  m_sampleCount = static_cast<uint64_t>(m_width) * m_height;
+  // Avec l'antialiasing, une tuile n'est terminée qu'après le second passage
+  auto tileDone = [this, refine](const Tile& tile) {
+    if (!refine && m_tileCallback)
+      m_tileCallback(tile);
+  };
+
+  if (m_mode == WAVEFRONT) {
+    const WavefrontIntegrator integrator(*this);
+    TileScheduler scheduler(m_width, m_height, WavefrontIntegrator::TILE_SIZE);
+    scheduler.run(m_threadCount, [this, &integrator, &rayGenerator, &tileDone](const Tile& tile) {
+      Framebuffer::TileView view = m_image.getTileView(tile);
+      if (m_costMap)
+        traceTileCosts(rayGenerator, view);
+      else
+        integrator.renderTile(rayGenerator, view);
+      tileDone(tile);
+    });
+  } else {
+    constexpr int tileSize = TileScheduler::DEFAULT_TILE_SIZE;
+    TileScheduler scheduler(m_width, m_height, tileSize);
+    scheduler.run(m_threadCount, [this, &rayGenerator, &tileDone](const Tile& tile) {
+      Framebuffer::TileView view = m_image.getTileView(tile);
+      if (m_costMap) {
+        traceTileCosts(rayGenerator, view);
+        tileDone(tile);
+        return;
+      }
+      float dirX[tileSize], dirY[tileSize], dirZ[tileSize];
+      for (int y = tile.y0; y < tile.y1; ++y) {
+        rayGenerator.generateRow(y, tile.x0, tile.x1 - tile.x0, dirX, dirY, dirZ);
+        for (int x = tile.x0; x < tile.x1; x += PACKET_SIZE) {
+          int count = std::min(PACKET_SIZE, tile.x1 - x);
+          Ray rays[PACKET_SIZE];
+          for (int i = 0; i < count; ++i) {
+            int column = x - tile.x0 + i;
+            rays[i] = Ray(rayGenerator.getOrigin(), Vector3(dirX[column], dirY[column], dirZ[column]));
+          }
+          Color colors[PACKET_SIZE];
+          tracePacket(RayPacket(rays, count), RayPacket::maskOf(count), colors);
+          for (int i = 0; i < count; ++i)
+            view.setPixel(x + i, y, colors[i]);
+        }
+      }
+      tileDone(tile);
+    });
+  }
+  if (!refine)
+    return;
+
+  const AdaptiveSampler sampler(*this, rayGenerator);
+  std::atomic<uint64_t> added{0};
+  TileScheduler scheduler(m_width, m_height);
+  scheduler.run(m_threadCount, [this, &sampler, &added](const Tile& tile) {
+    Framebuffer::TileView view = m_image.getTileView(tile);
+    added += sampler.refineTile(view);
+    if (m_tileCallback)
+      m_tileCallback(tile);
+  });
+  m_sampleCount += added;
+}
+
+/**
+ * @brief Renders a tile pixel by pixel, recording the cost of each into m_costMap
+ * 
+ * Each primary ray goes through tracePacket() alone, so the hits and the
+ * image are those of the packet path; only the grouping changes.
+ * 
+ * @param rayGenerator Primary ray directions of the frame
+ * @param view Pixels to render
+ */
+void Raytracer::Renderer::traceTileCosts(const CameraRayGenerator& rayGenerator, Framebuffer::TileView& view) const {
+  const Tile& tile = view.getTile();
+  const int width = tile.x1 - tile.x0;
+  std::vector<float> dirX(width), dirY(width), dirZ(width);
+  for (int y = tile.y0; y < tile.y1; ++y) {
+    rayGenerator.generateRow(y, tile.x0, width, dirX.data(), dirY.data(), dirZ.data());
+    for (int i = 0; i < width; ++i) {
+      const CostMap::Probe probe;
+      Ray ray(rayGenerator.getOrigin(), Vector3(dirX[i], dirY[i], dirZ[i]));
+      Color color;
+      tracePacket(RayPacket(&ray, 1), RayPacket::maskOf(1), &color);
+      probe.record(*m_costMap, tile.x0 + i, y);
+      view.setPixel(tile.x0 + i, y, color);
     }
   }
 }
 
 /**
- * @brief Gets the rendered image
+ * @brief Sets the number of threads used by render()
  * 
- * @return const std::vector<std::vector<Color>>& 2D array of computed pixel colors
+ * @param threadCount Number of threads, 0 for one per hardware thread
  */
-const std::vector<std::vector<Raytracer::Color>>& Raytracer::Renderer::getImage() const {
-  return m_image;
+void Raytracer::Renderer::setThreadCount(unsigned int threadCount) {
+  m_threadCount = threadCount;
+}
+
+/**
+ * @brief Sets the adaptive antialiasing limits
+ * 
+ * @param maxSamples Largest number of samples per pixel, 1 to disable
+ * @param noiseThreshold Luminance contrast and standard error under which a pixel stops
+ */
+void Raytracer::Renderer::setSampling(int maxSamples, float noiseThreshold) {
+  m_maxSamples = std::max(1, maxSamples);
+  m_noiseThreshold = std::max(0.0f, noiseThreshold);
 }
 
 /**
- * @brief Sets a pixel color in the image buffer
+ * @brief Gets the largest number of samples per pixel
  * 
- * @param x X-coordinate of the pixel
- * @param y Y-coordinate of the pixel
- * @param color Color to set
+ * @return int 1 when adaptive sampling is disabled
  */
-void Raytracer::Renderer::setPixel(int x, int y, const Color& color) {
-  if ((unsigned)x < m_width && (unsigned)y < m_height)
-    m_image[y][x] = color;
+int Raytracer::Renderer::getMaxSamples() const {
+  return m_maxSamples;
 }
 
 /**
- * @brief Rotates a vector around the X axis
+ * @brief Gets the noise threshold of adaptive sampling
  * 
- * @param v Vector to rotate
- * @param a Angle in radians
- * @return Vector3 Rotated vector
+ * @return float Luminance threshold, 1.0 standing for white
  */
-Raytracer::Vector3 Raytracer::Renderer::rotateX(const Vector3& v, float a) const {
-  return {v.x, v.y * std::cos(a) - v.z * std::sin(a), v.y * std::sin(a) + v.z * std::cos(a)};
+float Raytracer::Renderer::getNoiseThreshold() const {
+  return m_noiseThreshold;
 }
 
 /**
- * @brief Rotates a vector around the Y axis
+ * @brief Gets the number of primary samples traced by the last render()
  * 
- * @param v Vector to rotate
- * @param a Angle in radians
- * @return Vector3 Rotated vector
+ * @return uint64_t One per pixel plus the adaptive samples
  */
-Raytracer::Vector3 Raytracer::Renderer::rotateY(const Vector3& v, float a) const {
-  return {v.x * std::cos(a) + v.z * std::sin(a), v.y, -v.x * std::sin(a) + v.z * std::cos(a)};
+uint64_t Raytracer::Renderer::getSampleCount() const {
+  return m_sampleCount;
 }
 
 /**
- * @brief Rotates a vector around the Z axis
+ * @brief Sets a function called by render() after each finished tile
  * 
- * @param v Vector to rotate
- * @param a Angle in radians
- * @return Vector3 Rotated vector
+ * @param callback Thread-safe function receiving the finished tile, empty to disable
  */
-Raytracer::Vector3 Raytracer::Renderer::rotateZ(const Vector3& v, float a) const {
-  return {v.x * std::cos(a) - v.y * std::sin(a), v.x * std::sin(a) + v.y * std::cos(a), v.z};
+void Raytracer::Renderer::setTileCallback(std::function<void(const Tile&)> callback) {
+  m_tileCallback = std::move(callback);
+}
+
+/**
+ * @brief Sets a map receiving the cost of every pixel during render()
+ * 
+ * @param costMap Map of the image size, nullptr to disable
+ */
+void Raytracer::Renderer::setCostMap(CostMap* costMap) {
+  m_costMap = costMap;
+}
+
+/**
+ * @brief Sets the camera of the next frames
+ * 
+ * @param camera The camera, replacing the copy of the scene camera
+ */
+void Raytracer::Renderer::setCamera(const Camera& camera) {
+  m_camera = camera;
+}
+
+/**
+ * @brief Gets the camera of the next frames
+ * 
+ * @return const Camera& The camera used by render()
+ */
+const Raytracer::Camera& Raytracer::Renderer::getCamera() const {
+  return m_camera;
+}
+
+/**
+ * @brief Renders from primitives and lights compiled beforehand
+ * 
+ * @param geometry Compiled primitives, nullptr to compile the scene at each render()
+ * @param lights Light table, nullptr to build it at each render()
+ */
+void Raytracer::Renderer::setCompiled(std::shared_ptr<const CompiledScene> geometry, std::shared_ptr<const LightTable> lights) {
+  m_sharedGeometry = std::move(geometry);
+  m_sharedLights = std::move(lights);
+}
+
+/**
+ * @brief Sets how render() traces rays
+ * 
+ * @param mode RECURSIVE or WAVEFRONT
+ */
+void Raytracer::Renderer::setMode(Mode mode) {
+  m_mode = mode;
+}
+
+/**
+ * @brief Gets how render() traces rays
+ * 
+ * @return Mode The current mode
+ */
+Raytracer::Renderer::Mode Raytracer::Renderer::getMode() const {
+  return m_mode;
+}
+
+/**
+ * @brief Gets the number of threads used by render()
+ * 
+ * @return unsigned int The requested thread count, 0 meaning one per hardware thread
+ */
+unsigned int Raytracer::Renderer::getThreadCount() const {
+  return m_threadCount;
+}
+
+/**
+ * @brief Gets the rendered image
+ * 
+ * @return const Framebuffer& Contiguous image holding the computed pixel colors
+ */
+const Raytracer::Framebuffer& Raytracer::Renderer::getImage() const {
+  return m_image;
 }
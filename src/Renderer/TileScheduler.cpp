@@ -0,0 +1,106 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** TileScheduler
+*/
+
+#include "Renderer/TileScheduler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+namespace Raytracer {
+
+TileScheduler::TileScheduler(int width, int height, int tileSize)
+{
+    tileSize = std::max(1, tileSize);
+    for (int y = 0; y < height; y += tileSize)
+        for (int x = 0; x < width; x += tileSize)
+            m_tiles.push_back({x, y, std::min(x + tileSize, width), std::min(y + tileSize, height)});
+}
+
+size_t TileScheduler::getTileCount() const
+{
+    return m_tiles.size();
+}
+
+unsigned int TileScheduler::getDefaultThreadCount()
+{
+    unsigned int count = std::thread::hardware_concurrency();
+    return count > 0 ? count : 1;
+}
+
+bool TileScheduler::popLocal(WorkQueue& queue, Tile& tile)
+{
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tiles.empty())
+        return false;
+    tile = queue.tiles.back();
+    queue.tiles.pop_back();
+    return true;
+}
+
+bool TileScheduler::steal(std::vector<std::unique_ptr<WorkQueue>>& queues, size_t self, Tile& tile)
+{
+    // Aucune tuile n'est ajoutée pendant le rendu : des files toutes vides signifient la fin
+    for (size_t i = 1; i < queues.size(); ++i) {
+        WorkQueue& victim = *queues[(self + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tiles.empty()) {
+            tile = victim.tiles.front();
+            victim.tiles.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void TileScheduler::run(unsigned int threadCount, const std::function<void(const Tile&)>& renderTile)
+{
+    if (threadCount == 0)
+        threadCount = getDefaultThreadCount();
+    threadCount = static_cast<unsigned int>(std::min<size_t>(threadCount, m_tiles.size()));
+    if (threadCount <= 1) {
+        for (const Tile& tile : m_tiles)
+            renderTile(tile);
+        return;
+    }
+
+    // Distribution entrelacée : chaque thread reçoit des tuiles réparties sur toute l'image
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    for (unsigned int i = 0; i < threadCount; ++i)
+        queues.push_back(std::make_unique<WorkQueue>());
+    for (size_t i = 0; i < m_tiles.size(); ++i)
+        queues[i % threadCount]->tiles.push_front(m_tiles[i]);
+
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    auto worker = [&](size_t self) {
+        Tile tile;
+        while (!failed.load(std::memory_order_relaxed)
+            && (popLocal(*queues[self], tile) || steal(queues, self, tile))) {
+            try {
+                renderTile(tile);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error)
+                    error = std::current_exception();
+                failed = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 1; i < threadCount; ++i)
+        threads.emplace_back(worker, i);
+    worker(0);
+    for (auto& thread : threads)
+        thread.join();
+    if (error)
+        std::rethrow_exception(error);
+}
+
+}
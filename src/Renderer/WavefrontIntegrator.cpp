@@ -0,0 +1,175 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** WavefrontIntegrator
+*/
+
+#include "Renderer/WavefrontIntegrator.hpp"
+#include <algorithm>
+#include "Maths/RayPacket.hpp"
+#include "Utils/RenderStats.hpp"
+
+namespace Raytracer {
+
+// Intercale deux zéros entre les 9 bits de v (code de Morton sur 27 bits)
+static uint32_t spreadBits(uint32_t v)
+{
+    v &= 0x1FF;
+    v = (v | (v << 16)) & 0x030000FF;
+    v = (v | (v << 8)) & 0x0300F00F;
+    v = (v | (v << 4)) & 0x030C30C3;
+    v = (v | (v << 2)) & 0x09249249;
+    return v;
+}
+
+static uint32_t quantize(float component)
+{
+    float scaled = (component + 1.0f) * 0.5f * 511.0f;
+    return static_cast<uint32_t>(std::clamp(scaled, 0.0f, 511.0f));
+}
+
+WavefrontIntegrator::WavefrontIntegrator(const Renderer& renderer)
+    : m_renderer(renderer)
+{
+}
+
+uint32_t WavefrontIntegrator::directionKey(const Vector3& direction)
+{
+    uint32_t octant = (direction.x < 0.0f) | ((direction.y < 0.0f) << 1) | ((direction.z < 0.0f) << 2);
+    uint32_t morton = spreadBits(quantize(direction.x)) | (spreadBits(quantize(direction.y)) << 1)
+        | (spreadBits(quantize(direction.z)) << 2);
+    return (octant << 27) | morton;
+}
+
+void WavefrontIntegrator::sortQueue(std::vector<QueuedRay>& queue)
+{
+    // Clé de tri dans les 32 bits hauts, position d'origine dans les 32 bits bas
+    std::vector<uint64_t> keys(queue.size());
+    for (size_t i = 0; i < queue.size(); ++i)
+        keys[i] = (static_cast<uint64_t>(directionKey(queue[i].ray.getDirection())) << 32) | i;
+    std::sort(keys.begin(), keys.end());
+    std::vector<QueuedRay> sorted;
+    sorted.reserve(queue.size());
+    for (uint64_t key : keys)
+        sorted.push_back(queue[static_cast<uint32_t>(key)]);
+    queue.swap(sorted);
+}
+
+void WavefrontIntegrator::intersect(const std::vector<QueuedRay>& queue, std::vector<PathVertex>& vertices) const
+{
+    const CompiledScene& geometry = *m_renderer.m_geometry;
+    for (size_t first = 0; first < queue.size(); first += PACKET_SIZE) {
+        int count = static_cast<int>(std::min<size_t>(PACKET_SIZE, queue.size() - first));
+        Ray rays[PACKET_SIZE];
+        for (int i = 0; i < count; ++i)
+            rays[i] = queue[first + i].ray;
+        PacketHit hits;
+        geometry.intersectPacket(RayPacket(rays, count), RayPacket::maskOf(count), hits);
+        for (int i = 0; i < count; ++i) {
+            PathVertex& vertex = vertices[queue[first + i].vertex];
+            if (hits.records[i].primitive)
+                vertex.hit = hits.records[i];
+            else
+                vertex.color = Renderer::getSkyColor(rays[i]);
+        }
+    }
+}
+
+uint64_t WavefrontIntegrator::traceShadows(const std::vector<QueuedRay>& queue, std::vector<PathVertex>& vertices) const
+{
+    const CompiledScene& geometry = *m_renderer.m_geometry;
+    const LightTable& lights = *m_renderer.m_lights;
+    uint64_t tested = 0;
+    std::vector<QueuedRay> shadowQueue;
+    shadowQueue.reserve(queue.size());
+    for (size_t l = 0; l < lights.getCount() && l < 64; ++l) {
+        tested |= uint64_t(1) << l;
+        if (geometry.getCount() == 0)
+            continue;
+
+        // Une file par lumière, triée elle aussi : les rayons vers un même point convergent
+        shadowQueue.clear();
+        for (const QueuedRay& queued : queue) {
+            const HitRecord& hit = vertices[queued.vertex].hit;
+            if (hit.primitive)
+                shadowQueue.push_back({Renderer::getShadowRay(hit, lights.getDirection(l, hit.point)), queued.vertex});
+        }
+        sortQueue(shadowQueue);
+        RenderStats::count(RenderStats::SHADOW_RAYS, shadowQueue.size());
+        for (size_t first = 0; first < shadowQueue.size(); first += PACKET_SIZE) {
+            int count = static_cast<int>(std::min<size_t>(PACKET_SIZE, shadowQueue.size() - first));
+            Ray rays[PACKET_SIZE];
+            float lightDistance[PACKET_SIZE];
+            for (int i = 0; i < count; ++i) {
+                rays[i] = shadowQueue[first + i].ray;
+                lightDistance[i] = lights.getDistance(l, rays[i].getOrigin());
+            }
+            uint32_t occluded = geometry.occludesPacket(RayPacket(rays, count), RayPacket::maskOf(count), lightDistance);
+            for (int i = 0; i < count; ++i) {
+                if (occluded & (1u << i))
+                    vertices[shadowQueue[first + i].vertex].shadowedLights |= uint64_t(1) << l;
+            }
+        }
+    }
+    return tested;
+}
+
+void WavefrontIntegrator::renderTile(const CameraRayGenerator& rayGenerator, Framebuffer::TileView& view) const
+{
+    const Tile& tile = view.getTile();
+    const int width = tile.x1 - tile.x0;
+    std::vector<PathVertex> bounces[Renderer::MAX_DEPTH];
+    uint64_t testedLights[Renderer::MAX_DEPTH] = {};
+
+    // Rayons primaires dans l'ordre des lignes : déjà cohérents, pas de tri
+    std::vector<QueuedRay> queue;
+    queue.reserve(static_cast<size_t>(width) * (tile.y1 - tile.y0));
+    float dirX[TILE_SIZE], dirY[TILE_SIZE], dirZ[TILE_SIZE];
+    for (int y = tile.y0; y < tile.y1; ++y) {
+        rayGenerator.generateRow(y, tile.x0, width, dirX, dirY, dirZ);
+        for (int i = 0; i < width; ++i) {
+            uint32_t vertex = static_cast<uint32_t>(queue.size());
+            queue.push_back({Ray(rayGenerator.getOrigin(), Vector3(dirX[i], dirY[i], dirZ[i])), vertex});
+        }
+    }
+    RenderStats::count(RenderStats::PRIMARY_RAYS, queue.size());
+
+    for (int depth = 0; depth < Renderer::MAX_DEPTH && !queue.empty(); ++depth) {
+        std::vector<PathVertex>& vertices = bounces[depth];
+        vertices.resize(queue.size());
+        intersect(queue, vertices);
+        testedLights[depth] = traceShadows(queue, vertices);
+        if (depth + 1 == Renderer::MAX_DEPTH)
+            break;
+
+        // Seules les surfaces réfléchissantes émettent un rayon au rebond suivant
+        std::vector<QueuedRay> next;
+        for (const QueuedRay& queued : queue) {
+            PathVertex& vertex = vertices[queued.vertex];
+            if (!vertex.hit.primitive || m_renderer.m_geometry->getPalette()[vertex.hit.material].reflectance == 0.0f)
+                continue;
+            vertex.child = static_cast<int32_t>(next.size());
+            next.push_back({Renderer::getReflectionRay(vertex.hit, queued.ray), static_cast<uint32_t>(next.size())});
+        }
+        sortQueue(next);
+        RenderStats::count(RenderStats::REFLECTION_RAYS, next.size());
+        queue.swap(next);
+    }
+
+    // Couleurs combinées du rebond le plus profond vers les rayons primaires
+    for (int depth = Renderer::MAX_DEPTH - 1; depth >= 0; --depth) {
+        for (PathVertex& vertex : bounces[depth]) {
+            if (!vertex.hit.primitive)
+                continue;
+            Color reflection = vertex.child >= 0 ? bounces[depth + 1][vertex.child].color : Color(0, 0, 0);
+            vertex.color = m_renderer.shadeHit(vertex.hit, reflection, vertex.shadowedLights, testedLights[depth]);
+        }
+    }
+    for (int y = tile.y0; y < tile.y1; ++y) {
+        for (int x = tile.x0; x < tile.x1; ++x)
+            view.setPixel(x, y, bounces[0][(y - tile.y0) * width + (x - tile.x0)].color);
+    }
+}
+
+}
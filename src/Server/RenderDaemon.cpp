@@ -0,0 +1,308 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** RenderDaemon
+*/
+
+#include "Server/RenderDaemon.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <sstream>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "GlobalException.hpp"
+#include "Parser/MeshCache.hpp"
+#include "Utils/AsyncImageWriter.hpp"
+
+namespace Raytracer {
+
+// Mots séparés par des blancs ; les guillemets permettent des espaces dans une valeur
+static std::vector<std::string> splitWords(const std::string& line)
+{
+    std::vector<std::string> words;
+    std::string word;
+    bool quoted = false;
+    bool started = false;
+    for (char c : line) {
+        if (c == '"') {
+            quoted = !quoted;
+            started = true;
+        } else if (!quoted && std::isspace(static_cast<unsigned char>(c))) {
+            if (started)
+                words.push_back(word);
+            word.clear();
+            started = false;
+        } else {
+            word += c;
+            started = true;
+        }
+    }
+    if (quoted)
+        throw GlobalException("unterminated quote");
+    if (started)
+        words.push_back(word);
+    return words;
+}
+
+// Nombre entier ou réel, sans caractère en trop
+static float toFloat(const std::string& key, const std::string& text)
+{
+    try {
+        size_t end = 0;
+        float value = std::stof(text, &end);
+        if (end == text.size())
+            return value;
+    } catch (const std::exception&) {
+    }
+    throw GlobalException("invalid number '" + text + "' for " + key);
+}
+
+static int toPositiveInt(const std::string& key, const std::string& text)
+{
+    try {
+        size_t end = 0;
+        int value = std::stoi(text, &end);
+        if (end == text.size() && value > 0)
+            return value;
+    } catch (const std::exception&) {
+    }
+    throw GlobalException("invalid positive integer '" + text + "' for " + key);
+}
+
+// "x,y,z"
+static Vector3 toVector(const std::string& key, const std::string& text)
+{
+    const size_t first = text.find(',');
+    const size_t second = first == std::string::npos ? first : text.find(',', first + 1);
+    if (second == std::string::npos || text.find(',', second + 1) != std::string::npos)
+        throw GlobalException("invalid vector '" + text + "' for " + key + ", expected X,Y,Z");
+    return Vector3(toFloat(key, text.substr(0, first)), toFloat(key, text.substr(first + 1, second - first - 1)),
+        toFloat(key, text.substr(second + 1)));
+}
+
+void RenderDaemon::Job::applyTo(Camera& camera) const
+{
+    if (position)
+        camera.setPosition(*position);
+    if (rotation)
+        camera.setRotation(*rotation);
+    if (fieldOfView)
+        camera.setFieldOfView(*fieldOfView);
+    if (width || height)
+        camera.setResolution(width.value_or(camera.getWidth()), height.value_or(camera.getHeight()));
+}
+
+RenderDaemon::RenderDaemon(unsigned int threads, Renderer::Mode mode, int samples, float noise)
+    : m_threads(threads), m_mode(mode), m_samples(samples), m_noise(noise)
+{
+    MeshCache::setMemoryCache(true);
+}
+
+RenderDaemon::Job RenderDaemon::parseJob(const std::string& arguments)
+{
+    Job job;
+    for (const std::string& word : splitWords(arguments)) {
+        const size_t equal = word.find('=');
+        if (equal == std::string::npos)
+            throw GlobalException("expected KEY=VALUE, got '" + word + "'");
+        const std::string key = word.substr(0, equal);
+        const std::string value = word.substr(equal + 1);
+        if (key == "scene") {
+            job.scene = value;
+        } else if (key == "output") {
+            job.output = value;
+        } else if (key == "position") {
+            job.position = toVector(key, value);
+        } else if (key == "rotation") {
+            job.rotation = toVector(key, value);
+        } else if (key == "fov") {
+            job.fieldOfView = toFloat(key, value);
+        } else if (key == "width") {
+            job.width = toPositiveInt(key, value);
+        } else if (key == "height") {
+            job.height = toPositiveInt(key, value);
+        } else if (key == "samples") {
+            job.samples = toPositiveInt(key, value);
+        } else if (key == "noise") {
+            job.noise = toFloat(key, value);
+            if (*job.noise < 0.0f)
+                throw GlobalException("noise must not be negative");
+        } else if (key == "mode") {
+            if (value == "recursive")
+                job.mode = Renderer::RECURSIVE;
+            else if (value == "wavefront")
+                job.mode = Renderer::WAVEFRONT;
+            else
+                throw GlobalException("unknown mode '" + value + "'");
+        } else {
+            throw GlobalException("unknown key '" + key + "'");
+        }
+    }
+    if (job.scene.empty() || job.output.empty())
+        throw GlobalException("render needs scene=FILE and output=FILE");
+    return job;
+}
+
+void RenderDaemon::render(const Job& job, bool& reused)
+{
+    std::shared_ptr<const PreparedScene> prepared = m_scenes.get(job.scene, reused);
+    Camera camera = prepared->scene.getCamera();
+    job.applyTo(camera);
+    if (camera.getWidth() <= 0 || camera.getHeight() <= 0)
+        throw GlobalException("invalid image size for " + job.scene);
+
+    // Scène, tables et BVH partagées : seul le tampon de l'image est alloué par job
+    Renderer renderer(prepared->scene, camera.getWidth(), camera.getHeight());
+    renderer.setCamera(camera);
+    renderer.setCompiled(prepared->geometry, prepared->lights);
+    renderer.setThreadCount(m_threads);
+    renderer.setMode(job.mode.value_or(m_mode));
+    renderer.setSampling(job.samples.value_or(m_samples), job.noise.value_or(m_noise));
+
+    AsyncImageWriter writer(job.output, renderer.getImage());
+    renderer.setTileCallback([&writer](const Tile& tile) { writer.tileDone(tile); });
+    renderer.render();
+    if (!writer.finish())
+        throw GlobalException("failed to write image to " + job.output);
+    ++m_jobs;
+}
+
+std::string RenderDaemon::handle(const std::string& line)
+{
+    std::istringstream stream(line);
+    std::string command;
+    stream >> command;
+    if (command.empty() || command[0] == '#')
+        return "";
+    std::string answer;
+    try {
+        if (command == "render") {
+            std::string arguments;
+            std::getline(stream, arguments);
+            const Job job = parseJob(arguments);
+            const auto start = std::chrono::steady_clock::now();
+            bool reused = false;
+            render(job, reused);
+            const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+            answer = "ok " + job.output + (reused ? " cached " : " loaded ") + std::to_string(elapsed.count()) + "ms";
+        } else if (command == "stats") {
+            answer = "ok scenes=" + std::to_string(m_scenes.getSize()) + " meshes=" + std::to_string(MeshCache::getMemoryCount())
+                + " jobs=" + std::to_string(m_jobs);
+        } else if (command == "quit") {
+            m_stopped = true;
+            answer = "ok bye";
+        } else {
+            throw GlobalException("unknown command '" + command + "'");
+        }
+    } catch (const std::exception& e) {
+        answer = std::string("error ") + e.what();
+    }
+    // Une réponse tient sur une ligne, même si le message d'erreur en avait plusieurs
+    std::replace(answer.begin(), answer.end(), '\n', ' ');
+    return answer;
+}
+
+bool RenderDaemon::isStopped() const
+{
+    return m_stopped;
+}
+
+void RenderDaemon::serve(std::istream& input, std::ostream& output)
+{
+    std::string line;
+    while (!m_stopped && std::getline(input, line)) {
+        const std::string answer = handle(line);
+        if (!answer.empty())
+            output << answer << std::endl;
+    }
+}
+
+// Envoie toute la réponse ; false si le client est parti
+static bool sendAll(int client, const std::string& text)
+{
+    size_t sent = 0;
+    while (sent < text.size()) {
+        ssize_t count = ::send(client, text.data() + sent, text.size() - sent, 0);
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+            return false;
+        sent += static_cast<size_t>(count);
+    }
+    return true;
+}
+
+void RenderDaemon::serveSocket(const std::string& path)
+{
+    sockaddr_un address {};
+    if (path.size() >= sizeof(address.sun_path))
+        throw GlobalException("RenderDaemon: socket path too long: " + path);
+    struct stat info;
+    if (::lstat(path.c_str(), &info) == 0) {
+        if (!S_ISSOCK(info.st_mode))
+            throw GlobalException("RenderDaemon: " + path + " exists and is not a socket");
+        ::unlink(path.c_str());
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    const int server = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (server < 0)
+        throw GlobalException("RenderDaemon: cannot create socket: " + std::string(std::strerror(errno)));
+    if (::bind(server, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0 || ::listen(server, 8) < 0) {
+        const std::string reason = std::strerror(errno);
+        ::close(server);
+        throw GlobalException("RenderDaemon: cannot listen on " + path + ": " + reason);
+    }
+    // Un client parti avant sa réponse ne doit pas arrêter le processus
+    std::signal(SIGPIPE, SIG_IGN);
+
+    while (!m_stopped) {
+        const int client = ::accept(server, nullptr, nullptr);
+        if (client < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        std::string pending;
+        char buffer[4096];
+        bool connected = true;
+        while (connected && !m_stopped) {
+            ssize_t count = ::recv(client, buffer, sizeof(buffer), 0);
+            if (count < 0 && errno == EINTR)
+                continue;
+            if (count <= 0)
+                break;
+            pending.append(buffer, static_cast<size_t>(count));
+            size_t end;
+            // find() donne npos sans fin de ligne : seules les lignes complètes et assez courtes passent
+            while (connected && !m_stopped && (end = pending.find('\n')) <= MAX_LINE_LENGTH) {
+                std::string line = pending.substr(0, end);
+                pending.erase(0, end + 1);
+                if (!line.empty() && line.back() == '\r')
+                    line.pop_back();
+                const std::string answer = handle(line);
+                if (!answer.empty())
+                    connected = sendAll(client, answer + "\n");
+            }
+            // Requête trop longue, terminée ou non : le tampon ne grossit pas indéfiniment
+            if (connected && !m_stopped && std::min(pending.find('\n'), pending.size()) > MAX_LINE_LENGTH) {
+                sendAll(client, "error line too long\n");
+                connected = false;
+            }
+        }
+        ::close(client);
+    }
+    ::close(server);
+    ::unlink(path.c_str());
+}
+
+}
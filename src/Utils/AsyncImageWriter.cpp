@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** AsyncImageWriter
+*/
+
+#include "Utils/AsyncImageWriter.hpp"
+#include <filesystem>
+#include <system_error>
+
+// Fichier temporaire dans le même répertoire que la sortie : le renommage final ne copie rien
+Raytracer::AsyncImageWriter::AsyncImageWriter(const std::string& filename, const Framebuffer& image)
+    : m_filename(filename), m_temporary(filename + ".part"), m_image(image),
+      m_encoder(ImageEncoder::create(ImageEncoder::getType(filename), m_temporary, image.getWidth(), image.getHeight())),
+      m_rowPixels(static_cast<size_t>(image.getHeight()), 0) {
+  m_thread = std::thread(&AsyncImageWriter::run, this);
+}
+
+// Sans finish(), le rendu a échoué : l'image incomplète n'est pas gardée
+Raytracer::AsyncImageWriter::~AsyncImageWriter() {
+  if (!m_thread.joinable())
+    return;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_abandoned = true;
+  }
+  m_ready.notify_one();
+  m_thread.join();
+  m_encoder.reset();
+  std::error_code error;
+  std::filesystem::remove(m_temporary, error);
+}
+
+void Raytracer::AsyncImageWriter::tileDone(const Tile& tile) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (int y = tile.y0; y < tile.y1; ++y)
+    m_rowPixels[y] += tile.x1 - tile.x0;
+  int previous = m_readyRows;
+  while (m_readyRows < m_image.getHeight() && m_rowPixels[m_readyRows] >= m_image.getWidth())
+    ++m_readyRows;
+  if (m_readyRows != previous)
+    m_ready.notify_one();
+}
+
+bool Raytracer::AsyncImageWriter::finish() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_finishing = true;
+    m_readyRows = m_image.getHeight();
+  }
+  m_ready.notify_one();
+  m_thread.join();
+  std::error_code error;
+  if (m_result)
+    std::filesystem::rename(m_temporary, m_filename, error);
+  if (!m_result || error) {
+    std::filesystem::remove(m_temporary, error);
+    m_result = false;
+  }
+  return m_result;
+}
+
+void Raytracer::AsyncImageWriter::run() {
+  int written = 0;
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    m_ready.wait(lock, [&] { return m_readyRows > written || m_finishing || m_abandoned; });
+    if (m_abandoned)
+      return;
+    int ready = m_readyRows;
+    bool finishing = m_finishing;
+    // Les lignes prêtes ne changent plus : encodage sans le verrou pendant que le rendu continue
+    lock.unlock();
+    m_encoder->writeRows(m_image, written, ready);
+    written = ready;
+    if (finishing && written == m_image.getHeight()) {
+      bool result = m_encoder->finish();
+      lock.lock();
+      m_result = result;
+      return;
+    }
+    lock.lock();
+  }
+}
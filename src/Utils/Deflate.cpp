@@ -0,0 +1,214 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** Deflate
+*/
+
+#include "Utils/Deflate.hpp"
+#include <algorithm>
+
+namespace Raytracer {
+
+// Tables de la RFC 1951 : longueurs (symboles 257 à 285) et distances (codes 0 à 29)
+static constexpr uint16_t LENGTH_BASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static constexpr uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static constexpr uint16_t DISTANCE_BASE[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static constexpr uint8_t DISTANCE_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+static uint32_t hash3(const uint8_t* bytes)
+{
+    return ((uint32_t(bytes[0]) << 10) ^ (uint32_t(bytes[1]) << 5) ^ bytes[2]) & ((1u << 15) - 1);
+}
+
+Deflater::Deflater() : m_head(HASH_SIZE, -1), m_chain(WINDOW_SIZE, -1)
+{
+}
+
+uint32_t Deflater::adler32(uint32_t adler, const uint8_t* data, size_t size)
+{
+    constexpr uint32_t MOD = 65521;
+    uint32_t a = adler & 0xFFFFu;
+    uint32_t b = adler >> 16;
+    while (size > 0) {
+        // 5552 octets au plus avant que b ne puisse dépasser 32 bits
+        size_t count = size < 5552 ? size : 5552;
+        size -= count;
+        while (count-- > 0) {
+            a += *data++;
+            b += a;
+        }
+        a %= MOD;
+        b %= MOD;
+    }
+    return (b << 16) | a;
+}
+
+void Deflater::write(const uint8_t* data, size_t size, std::vector<uint8_t>& out)
+{
+    m_adler = adler32(m_adler, data, size);
+    m_window.insert(m_window.end(), data, data + size);
+    compress(false, out);
+}
+
+void Deflater::finish(std::vector<uint8_t>& out)
+{
+    compress(true, out);
+    endBlock(true, out);
+    if (m_bits.count > 0)
+        putBits(m_bits, 0, 8 - m_bits.count, out);
+    for (int shift = 24; shift >= 0; shift -= 8)
+        out.push_back(static_cast<uint8_t>(m_adler >> shift));
+}
+
+void Deflater::compress(bool flush, std::vector<uint8_t>& out)
+{
+    if (!m_started) {
+        // En-tête zlib : deflate, fenêtre de 32 Kio
+        out.push_back(0x78);
+        out.push_back(0x01);
+        m_started = true;
+    }
+    const int64_t end = m_windowStart + static_cast<int64_t>(m_window.size());
+    const int64_t limit = flush ? end : end - static_cast<int64_t>(MAX_MATCH);
+    while (m_position < limit) {
+        if (m_position - m_blockStart >= BLOCK_SIZE)
+            endBlock(false, out);
+        const uint8_t* current = m_window.data() + (m_position - m_windowStart);
+        const size_t available = static_cast<size_t>(end - m_position);
+        size_t bestLength = 0;
+        size_t bestDistance = 0;
+        if (available >= MIN_MATCH) {
+            const size_t maxLength = available < MAX_MATCH ? available : MAX_MATCH;
+            int64_t candidate = m_head[hash3(current)];
+            for (int tries = MAX_CHAIN; candidate >= 0 && tries > 0; --tries) {
+                const size_t distance = static_cast<size_t>(m_position - candidate);
+                if (distance > WINDOW_SIZE)
+                    break;
+                const uint8_t* previous = m_window.data() + (candidate - m_windowStart);
+                if (previous[bestLength] == current[bestLength]) {
+                    size_t length = 0;
+                    while (length < maxLength && previous[length] == current[length])
+                        ++length;
+                    if (length > bestLength) {
+                        bestLength = length;
+                        bestDistance = distance;
+                        if (length == maxLength)
+                            break;
+                    }
+                }
+                const int64_t next = m_chain[static_cast<size_t>(candidate) % WINDOW_SIZE];
+                if (next >= candidate)
+                    break;
+                candidate = next;
+            }
+        }
+        const size_t step = bestLength >= MIN_MATCH ? bestLength : 1;
+        if (bestLength >= MIN_MATCH)
+            putMatch(bestLength, bestDistance);
+        else
+            putSymbol(*current);
+        for (size_t i = 0; i < step; ++i) {
+            if (m_position + static_cast<int64_t>(MIN_MATCH) <= end)
+                insert(m_position);
+            ++m_position;
+        }
+    }
+    // Glissement de la fenêtre : seuls les WINDOW_SIZE derniers octets codés restent utiles,
+    // et les octets du bloc en cours, qui peut encore être stocké tel quel
+    const int64_t keepFrom = std::min(m_position - static_cast<int64_t>(WINDOW_SIZE), m_blockStart);
+    if (keepFrom - m_windowStart >= static_cast<int64_t>(WINDOW_SIZE)) {
+        m_window.erase(m_window.begin(), m_window.begin() + (keepFrom - m_windowStart));
+        m_windowStart = keepFrom;
+    }
+}
+
+void Deflater::insert(int64_t position)
+{
+    const uint32_t hash = hash3(m_window.data() + (position - m_windowStart));
+    m_chain[static_cast<size_t>(position) % WINDOW_SIZE] = m_head[hash];
+    m_head[hash] = position;
+}
+
+void Deflater::endBlock(bool last, std::vector<uint8_t>& out)
+{
+    putSymbol(256);
+    const size_t size = static_cast<size_t>(m_position - m_blockStart);
+    const size_t codedBits = 3 + m_block.size() * 8 + static_cast<size_t>(m_blockBits.count);
+    // Bloc stocké : en-tête de 3 bits, alignement sur l'octet, LEN et NLEN, puis les octets bruts
+    const size_t storedBits = 3 + (8 - (m_bits.count + 3) % 8) % 8 + 32 + size * 8;
+    if (codedBits <= storedBits) {
+        // BTYPE = 01 (Huffman fixe), puis les codes déjà produits
+        putBits(m_bits, last ? 1 : 0, 1, out);
+        putBits(m_bits, 1, 2, out);
+        for (uint8_t byte : m_block)
+            putBits(m_bits, byte, 8, out);
+        putBits(m_bits, static_cast<uint32_t>(m_blockBits.bits), m_blockBits.count, out);
+    } else {
+        // BTYPE = 00 ; size ne dépasse pas BLOCK_SIZE + MAX_MATCH, loin des 65535 octets permis
+        putBits(m_bits, last ? 1 : 0, 1, out);
+        putBits(m_bits, 0, 2, out);
+        if (m_bits.count > 0)
+            putBits(m_bits, 0, 8 - m_bits.count, out);
+        putBits(m_bits, static_cast<uint32_t>(size), 16, out);
+        putBits(m_bits, static_cast<uint32_t>(~size & 0xFFFFu), 16, out);
+        const uint8_t* bytes = m_window.data() + (m_blockStart - m_windowStart);
+        out.insert(out.end(), bytes, bytes + size);
+    }
+    m_block.clear();
+    m_blockBits = BitBuffer();
+    m_blockStart = m_position;
+}
+
+void Deflater::putBits(BitBuffer& buffer, uint32_t value, int count, std::vector<uint8_t>& out)
+{
+    buffer.bits |= static_cast<uint64_t>(value) << buffer.count;
+    buffer.count += count;
+    while (buffer.count >= 8) {
+        out.push_back(static_cast<uint8_t>(buffer.bits));
+        buffer.bits >>= 8;
+        buffer.count -= 8;
+    }
+}
+
+void Deflater::putCode(uint32_t code, int length)
+{
+    uint32_t reversed = 0;
+    for (int i = 0; i < length; ++i)
+        reversed |= ((code >> i) & 1u) << (length - 1 - i);
+    putBits(m_blockBits, reversed, length, m_block);
+}
+
+void Deflater::putSymbol(int symbol)
+{
+    // Codes de Huffman fixes (RFC 1951, 3.2.6)
+    if (symbol < 144)
+        putCode(0x30 + symbol, 8);
+    else if (symbol < 256)
+        putCode(0x190 + symbol - 144, 9);
+    else if (symbol < 280)
+        putCode(symbol - 256, 7);
+    else
+        putCode(0xC0 + symbol - 280, 8);
+}
+
+void Deflater::putMatch(size_t length, size_t distance)
+{
+    int lengthCode = 28;
+    while (LENGTH_BASE[lengthCode] > length)
+        --lengthCode;
+    putSymbol(257 + lengthCode);
+    putBits(m_blockBits, static_cast<uint32_t>(length - LENGTH_BASE[lengthCode]), LENGTH_EXTRA[lengthCode], m_block);
+
+    int distanceCode = 29;
+    while (DISTANCE_BASE[distanceCode] > distance)
+        --distanceCode;
+    putCode(static_cast<uint32_t>(distanceCode), 5);
+    putBits(m_blockBits, static_cast<uint32_t>(distance - DISTANCE_BASE[distanceCode]), DISTANCE_EXTRA[distanceCode], m_block);
+}
+
+}
@@ -0,0 +1,67 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** ImageEncoder
+*/
+
+#include "Utils/ImageEncoder.hpp"
+#include <algorithm>
+#include <cctype>
+#include "GlobalException.hpp"
+#include "Utils/PfmEncoder.hpp"
+#include "Utils/PngEncoder.hpp"
+#include "Utils/PpmEncoder.hpp"
+
+Raytracer::ImageEncoder::ImageEncoder(const std::string& filename, int width, int height)
+    : m_file(filename, std::ios::binary), m_width(width), m_height(height) {
+  if (!m_file.is_open())
+    throw GlobalException("ImageEncoder: Failed to create file: " + filename);
+}
+
+bool Raytracer::ImageEncoder::finish() {
+  m_file.close();
+  return !m_file.fail();
+}
+
+Raytracer::ImageEncoder::Type Raytracer::ImageEncoder::getType(const std::string& filename) {
+  size_t dot = filename.find_last_of('.');
+  std::string extension = dot == std::string::npos ? "" : filename.substr(dot + 1);
+  std::transform(extension.begin(), extension.end(), extension.begin(),
+      [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+  if (extension == "ppm")
+    return PPM;
+  if (extension == "png")
+    return PNG;
+  if (extension == "pfm")
+    return PFM;
+  throw GlobalException("ImageEncoder: Unsupported output format (expected .ppm, .png or .pfm): " + filename);
+}
+
+std::unique_ptr<Raytracer::ImageEncoder> Raytracer::ImageEncoder::create(const std::string& filename, int width,
+    int height) {
+  return create(getType(filename), filename, width, height);
+}
+
+std::unique_ptr<Raytracer::ImageEncoder> Raytracer::ImageEncoder::create(Type type, const std::string& filename,
+    int width, int height) {
+  switch (type) {
+    case PNG:
+      return std::make_unique<PngEncoder>(filename, width, height);
+    case PFM:
+      return std::make_unique<PfmEncoder>(filename, width, height);
+    case PPM:
+      break;
+  }
+  return std::make_unique<PpmEncoder>(filename, width, height);
+}
+
+bool Raytracer::ImageEncoder::write(const std::string& filename, const Framebuffer& image) {
+  try {
+    std::unique_ptr<ImageEncoder> encoder = create(filename, image.getWidth(), image.getHeight());
+    encoder->writeRows(image, 0, image.getHeight());
+    return encoder->finish();
+  } catch (const GlobalException&) {
+    return false;
+  }
+}
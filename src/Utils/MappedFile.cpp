@@ -0,0 +1,55 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** MappedFile
+*/
+
+#include "Utils/MappedFile.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "GlobalException.hpp"
+
+Raytracer::MappedFile::MappedFile(const std::string& filename) {
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw GlobalException("MappedFile: Failed to open file: " + filename);
+
+  struct stat st;
+  if (fstat(fd, &st) < 0) {
+    close(fd);
+    throw GlobalException("MappedFile: Failed to stat file: " + filename);
+  }
+  m_size = static_cast<size_t>(st.st_size);
+  if (m_size > 0) {
+    void* mapping = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+      close(fd);
+      throw GlobalException("MappedFile: Failed to map file: " + filename);
+    }
+    // Lecture séquentielle : on laisse le noyau lire en avance
+    madvise(mapping, m_size, MADV_SEQUENTIAL);
+    m_data = static_cast<const char*>(mapping);
+  }
+  // La projection reste valide après la fermeture du descripteur
+  close(fd);
+}
+
+Raytracer::MappedFile::~MappedFile() {
+  if (m_data)
+    munmap(const_cast<char*>(m_data), m_size);
+}
+
+const char* Raytracer::MappedFile::data() const {
+  return m_data;
+}
+
+size_t Raytracer::MappedFile::size() const {
+  return m_size;
+}
+
+std::string_view Raytracer::MappedFile::view() const {
+  return std::string_view(m_data, m_size);
+}
@@ -0,0 +1,26 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** PfmEncoder
+*/
+
+#include "Utils/PfmEncoder.hpp"
+#include <bit>
+
+Raytracer::PfmEncoder::PfmEncoder(const std::string& filename, int width, int height)
+    : ImageEncoder(filename, width, height), m_row(static_cast<size_t>(width) * 3) {
+  // Échelle négative : flottants petit-boutistes, l'ordre natif de la machine sinon
+  m_file << "PF\n" << width << " " << height << "\n" << (std::endian::native == std::endian::little ? "-1.0" : "1.0")
+         << "\n";
+  m_dataOffset = m_file.tellp();
+}
+
+void Raytracer::PfmEncoder::writeRows(const Framebuffer& image, int y0, int y1) {
+  const std::streamoff rowSize = static_cast<std::streamoff>(m_row.size() * sizeof(float));
+  for (int y = y0; y < y1; ++y) {
+    image.readRow(y, m_row.data());
+    m_file.seekp(m_dataOffset + static_cast<std::streamoff>(m_height - 1 - y) * rowSize);
+    m_file.write(reinterpret_cast<const char*>(m_row.data()), rowSize);
+  }
+}
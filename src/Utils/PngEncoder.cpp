@@ -0,0 +1,135 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** PngEncoder
+*/
+
+#include "Utils/PngEncoder.hpp"
+#include <array>
+#include <cstdlib>
+
+static void putUint32(uint8_t* out, uint32_t value) {
+  out[0] = static_cast<uint8_t>(value >> 24);
+  out[1] = static_cast<uint8_t>(value >> 16);
+  out[2] = static_cast<uint8_t>(value >> 8);
+  out[3] = static_cast<uint8_t>(value);
+}
+
+static uint8_t paeth(uint8_t a, uint8_t b, uint8_t c) {
+  int p = int(a) + int(b) - int(c);
+  int pa = std::abs(p - int(a));
+  int pb = std::abs(p - int(b));
+  int pc = std::abs(p - int(c));
+  if (pa <= pb && pa <= pc)
+    return a;
+  return pb <= pc ? b : c;
+}
+
+Raytracer::PngEncoder::PngEncoder(const std::string& filename, int width, int height)
+    : ImageEncoder(filename, width, height), m_row(static_cast<size_t>(width) * 3),
+      m_previousRow(m_row.size(), 0), m_filtered(m_row.size() + 1), m_candidate(m_row.size()) {
+  static const uint8_t SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  m_file.write(reinterpret_cast<const char*>(SIGNATURE), sizeof(SIGNATURE));
+
+  // 8 bits par canal, RGB, compression deflate, filtrage adaptatif, non entrelacé
+  uint8_t header[13] = {};
+  putUint32(header, static_cast<uint32_t>(width));
+  putUint32(header + 4, static_cast<uint32_t>(height));
+  header[8] = 8;
+  header[9] = 2;
+  writeChunk("IHDR", header, sizeof(header));
+}
+
+uint32_t Raytracer::PngEncoder::crc32(uint32_t crc, const uint8_t* data, size_t size) {
+  static const std::array<uint32_t, 256> TABLE = [] {
+    std::array<uint32_t, 256> table{};
+    for (uint32_t n = 0; n < 256; ++n) {
+      uint32_t c = n;
+      for (int k = 0; k < 8; ++k)
+        c = (c & 1u) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      table[n] = c;
+    }
+    return table;
+  }();
+  crc = ~crc;
+  for (size_t i = 0; i < size; ++i)
+    crc = TABLE[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+  return ~crc;
+}
+
+void Raytracer::PngEncoder::writeChunk(const char* type, const uint8_t* data, size_t size) {
+  uint8_t length[4];
+  putUint32(length, static_cast<uint32_t>(size));
+  uint32_t crc = crc32(0, reinterpret_cast<const uint8_t*>(type), 4);
+  crc = crc32(crc, data, size);
+  uint8_t trailer[4];
+  putUint32(trailer, crc);
+  m_file.write(reinterpret_cast<const char*>(length), 4);
+  m_file.write(type, 4);
+  m_file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+  m_file.write(reinterpret_cast<const char*>(trailer), 4);
+}
+
+void Raytracer::PngEncoder::filterRow() {
+  constexpr size_t bpp = 3;
+  const size_t size = m_row.size();
+  const uint8_t* row = m_row.data();
+  const uint8_t* up = m_previousRow.data();
+  uint64_t bestCost = UINT64_MAX;
+
+  // Heuristique de la spécification : le filtre dont les octets signés ont la plus petite somme absolue
+  for (uint8_t type = 0; type < 5; ++type) {
+    uint64_t cost = 0;
+    for (size_t i = 0; i < size; ++i) {
+      uint8_t left = i >= bpp ? row[i - bpp] : 0;
+      uint8_t upLeft = i >= bpp ? up[i - bpp] : 0;
+      uint8_t predictor = 0;
+      switch (type) {
+        case 1:
+          predictor = left;
+          break;
+        case 2:
+          predictor = up[i];
+          break;
+        case 3:
+          predictor = static_cast<uint8_t>((int(left) + int(up[i])) / 2);
+          break;
+        case 4:
+          predictor = paeth(left, up[i], upLeft);
+          break;
+        default:
+          break;
+      }
+      uint8_t value = static_cast<uint8_t>(row[i] - predictor);
+      m_candidate[i] = value;
+      cost += static_cast<uint64_t>(std::abs(static_cast<int8_t>(value)));
+    }
+    if (cost < bestCost) {
+      bestCost = cost;
+      m_filtered[0] = type;
+      std::copy(m_candidate.begin(), m_candidate.end(), m_filtered.begin() + 1);
+    }
+  }
+}
+
+void Raytracer::PngEncoder::writeRows(const Framebuffer& image, int y0, int y1) {
+  for (int y = y0; y < y1; ++y) {
+    image.readRow(y, m_row.data());
+    filterRow();
+    m_row.swap(m_previousRow);
+    m_deflater.write(m_filtered.data(), m_filtered.size(), m_compressed);
+    if (m_compressed.size() >= CHUNK_SIZE) {
+      writeChunk("IDAT", m_compressed.data(), m_compressed.size());
+      m_compressed.clear();
+    }
+  }
+}
+
+bool Raytracer::PngEncoder::finish() {
+  m_deflater.finish(m_compressed);
+  writeChunk("IDAT", m_compressed.data(), m_compressed.size());
+  m_compressed.clear();
+  writeChunk("IEND", nullptr, 0);
+  return ImageEncoder::finish();
+}
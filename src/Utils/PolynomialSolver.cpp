@@ -2,10 +2,11 @@
 ** EPITECH PROJECT, 2025
 ** raytracer
 ** File description:
-** Cone
+** PolynomialSolver
 */
 
 #include "Utils/PolynomialSolver.hpp"
+#include "Utils/RenderStats.hpp"
 #include <ostream>
 #include <iostream>
 
@@ -35,37 +36,140 @@ namespace Raytracer {
     }
 
 
+    int PolynomialSolver::solveQuadratic(double a, double b, double c, double roots[2]) {
+        if (a == 0.0) {
+            if (b == 0.0)
+                return 0;
+            roots[0] = -c / b;
+            return 1;
+        }
+
+        double discriminant = b * b - 4.0 * a * c;
+        if (discriminant < 0.0)
+            return 0;
+        if (discriminant == 0.0) {
+            roots[0] = -b / (2.0 * a);
+            return 1;
+        }
+
+        // Forme sans soustraction de deux valeurs proches
+        double q = -0.5 * (b + std::copysign(std::sqrt(discriminant), b));
+        roots[0] = q / a;
+        roots[1] = c / q;
+        if (roots[0] > roots[1])
+            std::swap(roots[0], roots[1]);
+        return 2;
+    }
+
     int PolynomialSolver::solveCubic(float a, float b, float c, float d, float roots[3]) {
         if (std::abs(a) < EPSILON)
             return solveQuadratic(b, c, d, roots);
 
+        double found[3];
+        int count = solveCubic(static_cast<double>(a), b, c, d, found);
+        for (int i = 0; i < count; ++i)
+            roots[i] = static_cast<float>(found[i]);
+        return count;
+    }
+
+    int PolynomialSolver::solveCubic(double a, double b, double c, double d, double roots[3]) {
+        if (a == 0.0)
+            return solveQuadratic(b, c, d, roots);
+
         b /= a;
         c /= a;
         d /= a;
-        a = 1.0f;
 
-        float Q = (b * b - 3 * c) / 9.0f;
-        float R = (2 * b * b * b - 9 * b * c + 27 * d) / 54.0f;
-        float Q3 = Q * Q * Q;
-        float D = Q3 - R * R;
+        double Q = (b * b - 3.0 * c) / 9.0;
+        double R = (2.0 * b * b * b - 9.0 * b * c + 27.0 * d) / 54.0;
+        double Q3 = Q * Q * Q;
+        double shift = b / 3.0;
 
-        if (D < -EPSILON)  // Ensure small negative discriminant values are treated as no real roots
-            return 0;  // No real roots
+        if (R * R < Q3) {
+            double theta = std::acos(std::clamp(R / std::sqrt(Q3), -1.0, 1.0));
+            double sqrtQ = std::sqrt(Q);
+            roots[0] = -2.0 * sqrtQ * std::cos((theta + 2.0 * M_PI) / 3.0) - shift;
+            roots[1] = -2.0 * sqrtQ * std::cos((theta - 2.0 * M_PI) / 3.0) - shift;
+            roots[2] = -2.0 * sqrtQ * std::cos(theta / 3.0) - shift;
+            return 3;  // Three real roots, the largest first
+        }
+
+        // Une seule racine réelle (ou racines multiples)
+        double A = -std::copysign(std::cbrt(std::abs(R) + std::sqrt(R * R - Q3)), R);
+        double B = (A == 0.0) ? 0.0 : Q / A;
+        roots[0] = (A + B) - shift;
+        return 1;
+    }
+
+    int PolynomialSolver::solveQuartic(float a, float b, float c, float d, float e, float roots[4]) {
+        double found[4];
+        int count = solveQuartic(static_cast<double>(a), b, c, d, e, found);
+        for (int i = 0; i < count; ++i)
+            roots[i] = static_cast<float>(found[i]);
+        return count;
+    }
 
-        if (D >= 0) {
-            float theta = std::acos(std::clamp(R / std::sqrt(Q3), -1.0f, 1.0f));
-            float sqrtQ = std::sqrt(Q);
-            roots[0] = -2 * sqrtQ * std::cos(theta / 3) - b / 3;
-            roots[1] = -2 * sqrtQ * std::cos((theta + 2 * M_PI) / 3) - b / 3;
-            roots[2] = -2 * sqrtQ * std::cos((theta - 2 * M_PI) / 3) - b / 3;
-            return 3;  // Three real roots
+    int PolynomialSolver::solveQuartic(double a, double b, double c, double d, double e, double roots[4]) {
+        if (a == 0.0)
+            return solveCubic(b, c, d, e, roots);
+
+        // Quartique réduite y⁴ + py² + qy + r = 0 avec x = y - B/4
+        double B = b / a, C = c / a, D = d / a, E = e / a;
+        double B2 = B * B;
+        double p = C - 3.0 * B2 / 8.0;
+        double q = D - B * C / 2.0 + B2 * B / 8.0;
+        double r = E - B * D / 4.0 + B2 * C / 16.0 - 3.0 * B2 * B2 / 256.0;
+
+        // Plus grande racine de la résolvante m³ + pm² + (p²/4 - r)m - q²/8 = 0
+        double resolvent[3];
+        solveCubic(1.0, p, p * p / 4.0 - r, -q * q / 8.0, resolvent);
+        double m = resolvent[0];
+
+        double found[4];
+        int count = 0;
+        if (m <= 1e-14 * (std::abs(p) + std::sqrt(std::abs(r)))) {
+            // q ~ 0 : quartique bicarrée z² + pz + r = 0 avec z = y²
+            double z[2];
+            int zCount = solveQuadratic(1.0, p, r, z);
+            for (int i = 0; i < zCount; ++i) {
+                if (z[i] < 0.0)
+                    continue;
+                double y = std::sqrt(z[i]);
+                found[count++] = y;
+                found[count++] = -y;
+            }
         } else {
-            float A = -std::cbrt(std::abs(R) + std::sqrt(-D));
-            if (R < 0) A = -A;
-            float B = (std::abs(A) < EPSILON) ? 0.0f : Q / A;
+            // (y² + p/2 + m)² = (sy - q/2s)² avec s = √(2m)
+            double s = std::sqrt(2.0 * m);
+            double half = p / 2.0 + m;
+            double offset = q / (2.0 * s);
+            count += solveQuadratic(1.0, -s, half + offset, found);
+            count += solveQuadratic(1.0, s, half - offset, found + count);
+        }
+
+        for (int i = 0; i < count; ++i)
+            roots[i] = newtonRaphson(a, b, c, d, e, found[i] - B / 4.0);
+        std::sort(roots, roots + count);
+        return count;
+    }
 
-            roots[0] = (A + B) - b / 3;
-            return 1;  // One real root
+    double PolynomialSolver::newtonRaphson(double a, double b, double c, double d, double e, double guess) {
+        auto evaluate = [&](double x) { return (((a * x + b) * x + c) * x + d) * x + e; };
+        double x = guess;
+        double fx = evaluate(x);
+        RenderStats::Tally iterations(RenderStats::QUARTIC_ITERATIONS);
+        for (int i = 0; i < MAX_ITERATIONS && fx != 0.0; ++i) {
+            ++iterations;
+            double derivative = ((4.0 * a * x + 3.0 * b) * x + 2.0 * c) * x + d;
+            if (derivative == 0.0)
+                break;
+            double next = x - fx / derivative;
+            double fNext = evaluate(next);
+            if (std::abs(fNext) >= std::abs(fx))
+                break;
+            x = next;
+            fx = fNext;
         }
+        return x;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,20 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** PpmEncoder
+*/
+
+#include "Utils/PpmEncoder.hpp"
+
+Raytracer::PpmEncoder::PpmEncoder(const std::string& filename, int width, int height)
+    : ImageEncoder(filename, width, height), m_row(static_cast<size_t>(width) * 3) {
+  m_file << "P6\n" << width << " " << height << "\n255\n";
+}
+
+void Raytracer::PpmEncoder::writeRows(const Framebuffer& image, int y0, int y1) {
+  for (int y = y0; y < y1; ++y) {
+    image.readRow(y, m_row.data());
+    m_file.write(reinterpret_cast<const char*>(m_row.data()), static_cast<std::streamsize>(m_row.size()));
+  }
+}
@@ -0,0 +1,175 @@
+/*
+** EPITECH PROJECT, 2025
+** raytracer
+** File description:
+** RenderStats
+*/
+
+#include "Utils/RenderStats.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <mutex>
+#include <vector>
+
+namespace Raytracer {
+
+namespace {
+    // Blocs des threads vivants et totaux des threads terminés
+    struct Registry {
+        std::mutex mutex;
+        std::vector<std::atomic<uint64_t>*> live;
+        uint64_t retired[RenderStats::COUNTER_COUNT] = {};
+        double seconds[RenderStats::PHASE_COUNT] = {};
+    };
+
+    Registry& registry()
+    {
+        static Registry instance;
+        return instance;
+    }
+
+    // Détruit avec le thread : reporte son bloc dans les totaux
+    struct Retirer {
+        std::atomic<uint64_t>* values = nullptr;
+
+        ~Retirer()
+        {
+            Registry& shared = registry();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            for (int i = 0; i < RenderStats::COUNTER_COUNT; ++i)
+                shared.retired[i] += values[i].load(std::memory_order_relaxed);
+            shared.live.erase(std::find(shared.live.begin(), shared.live.end(), values));
+        }
+    };
+
+    constexpr const char* COUNTER_NAMES[RenderStats::COUNTER_COUNT] = {
+        "primary_rays", "shadow_rays", "reflection_rays",
+        "sphere_tests", "plane_tests", "triangle_tests", "cylinder_tests", "cone_tests",
+        "torus_tests", "tanglecube_tests", "mesh_tests", "instance_tests", "group_tests", "other_tests",
+        "bvh_nodes", "quartic_iterations", "tanglecube_steps"
+    };
+
+    constexpr const char* PHASE_NAMES[RenderStats::PHASE_COUNT] = {
+        "parse", "obj_load", "build", "render", "write"
+    };
+}
+
+#ifdef USE_STATS
+thread_local RenderStats::ScopedPhase* RenderStats::ScopedPhase::s_current = nullptr;
+#endif
+
+uint64_t RenderStats::Snapshot::getTestCount() const
+{
+    uint64_t total = 0;
+    for (int i = SPHERE_TESTS; i <= OTHER_TESTS; ++i)
+        total += counters[i];
+    return total;
+}
+
+double RenderStats::Snapshot::getAverage(Counter counter, Counter per) const
+{
+    return counters[per] ? static_cast<double>(counters[counter]) / counters[per] : 0.0;
+}
+
+void RenderStats::enroll(Block& block)
+{
+    static thread_local Retirer retirer;
+    Registry& shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    shared.live.push_back(block.values);
+    retirer.values = block.values;
+    block.enrolled = true;
+}
+
+void RenderStats::addTime(Phase phase, double seconds)
+{
+    Registry& shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    shared.seconds[phase] += seconds;
+}
+
+RenderStats::Snapshot RenderStats::collect()
+{
+    Snapshot stats;
+    Registry& shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    for (int i = 0; i < COUNTER_COUNT; ++i) {
+        stats.counters[i] = shared.retired[i];
+        for (const std::atomic<uint64_t>* values : shared.live)
+            stats.counters[i] += values[i].load(std::memory_order_relaxed);
+    }
+    std::copy(shared.seconds, shared.seconds + PHASE_COUNT, stats.seconds);
+    return stats;
+}
+
+void RenderStats::reset()
+{
+    Registry& shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    std::fill(shared.retired, shared.retired + COUNTER_COUNT, 0);
+    std::fill(shared.seconds, shared.seconds + PHASE_COUNT, 0.0);
+    for (std::atomic<uint64_t>* values : shared.live) {
+        for (int i = 0; i < COUNTER_COUNT; ++i)
+            values[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+const char* RenderStats::getName(Counter counter)
+{
+    return COUNTER_NAMES[counter];
+}
+
+const char* RenderStats::getName(Phase phase)
+{
+    return PHASE_NAMES[phase];
+}
+
+void RenderStats::printTable(std::ostream& out, const Snapshot& stats)
+{
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(2);
+
+    double total = 0.0;
+    out << "Phase               Time (ms)" << std::endl;
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        total += stats.seconds[i];
+        out << "  " << std::left << std::setw(16) << PHASE_NAMES[i] << std::right << std::setw(11)
+            << stats.seconds[i] * 1000.0 << std::endl;
+    }
+    out << "  " << std::left << std::setw(16) << "total" << std::right << std::setw(11) << total * 1000.0 << std::endl;
+
+    const uint64_t primary = stats.counters[PRIMARY_RAYS];
+    out << "Counter                   Total   Per primary ray" << std::endl;
+    for (int i = 0; i < COUNTER_COUNT; ++i) {
+        out << "  " << std::left << std::setw(20) << COUNTER_NAMES[i] << std::right << std::setw(14)
+            << stats.counters[i] << std::setw(18) << (primary ? static_cast<double>(stats.counters[i]) / primary : 0.0)
+            << std::endl;
+    }
+    out << "Torus: " << stats.getAverage(QUARTIC_ITERATIONS, TORUS_TESTS) << " Newton iterations per test, tangle cube: "
+        << stats.getAverage(TANGLECUBE_STEPS, TANGLECUBE_TESTS) << " steps per test" << std::endl;
+    out.flags(flags);
+    out.precision(precision);
+}
+
+void RenderStats::printJson(std::ostream& out, const Snapshot& stats)
+{
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << std::setprecision(9);
+
+    out << "{\n  \"phases_ms\": {";
+    for (int i = 0; i < PHASE_COUNT; ++i)
+        out << (i ? ", " : "") << '"' << PHASE_NAMES[i] << "\": " << stats.seconds[i] * 1000.0;
+    out << "},\n  \"counters\": {";
+    for (int i = 0; i < COUNTER_COUNT; ++i)
+        out << (i ? ", " : "") << '"' << COUNTER_NAMES[i] << "\": " << stats.counters[i];
+    out << "},\n  \"intersection_tests\": " << stats.getTestCount()
+        << ",\n  \"torus_iterations_per_test\": " << stats.getAverage(QUARTIC_ITERATIONS, TORUS_TESTS)
+        << ",\n  \"tanglecube_steps_per_test\": " << stats.getAverage(TANGLECUBE_STEPS, TANGLECUBE_TESTS)
+        << "\n}" << std::endl;
+    out.flags(flags);
+    out.precision(precision);
+}
+
+}
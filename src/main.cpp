@@ -5,48 +5,236 @@
 ** main
 */
 
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <string>
 #include "Core/Scene.hpp"
 #include "GlobalException.hpp"
 #include "Parser/SceneParser.hpp"
+#include "Renderer/CostMap.hpp"
 #include "Renderer/Renderer.hpp"
-#include "Utils/PpmWriter.hpp"
+#include "Server/RenderDaemon.hpp"
+#include "Utils/AsyncImageWriter.hpp"
+#include "Utils/ImageEncoder.hpp"
+#include "Utils/RenderStats.hpp"
 
 #ifdef USE_SFML
 #include "Graphics/Graphics.hpp"
 #endif
 
+static constexpr const char *USAGE = "USAGE: ./raytracer <SCENE_FILE> [-t THREADS] [-m recursive|wavefront] "
+    "[-o OUTPUT.ppm|.png|.pfm] [-s MAX_SAMPLES] [-n NOISE_THRESHOLD] [--stats] [--stats-json FILE.json] [--heatmap]\n"
+    "       ./raytracer --serve -|SOCKET [-t THREADS] [-m recursive|wavefront] [-s MAX_SAMPLES] [-n NOISE_THRESHOLD]";
+
+struct Options {
+    const char *sceneFile = nullptr;
+    unsigned int threads = 0;
+    Raytracer::Renderer::Mode mode = Raytracer::Renderer::RECURSIVE;
+    std::string output;
+    int samples = 1;
+    float noise = Raytracer::Renderer::DEFAULT_NOISE_THRESHOLD;
+    bool stats = false;
+    std::string statsJson;
+    bool heatmap = false;
+    std::string serve;
+};
+
+// Lit un entier positif ou nul, sans caractère en trop
+static bool parseInt(const char *text, int &value) {
+    try {
+        size_t end = 0;
+        value = std::stoi(text, &end);
+        return text[end] == '\0' && value >= 0;
+    } catch (const std::exception &) {
+        return false;
+    }
+}
+
+// Lit un flottant positif ou nul, sans caractère en trop
+static bool parseFloat(const char *text, float &value) {
+    try {
+        size_t end = 0;
+        value = std::stof(text, &end);
+        return text[end] == '\0' && value >= 0.0f;
+    } catch (const std::exception &) {
+        return false;
+    }
+}
+
+// Lit "-t N" / "--threads N" ; 0 (défaut) = un thread par cœur matériel
+// Lit "-m MODE" / "--mode MODE" : recursive (défaut) ou wavefront
+// Lit "-o FICHIER" / "--output FICHIER" : format choisi par l'extension, output.ppm par défaut
+// Lit "-s N" / "--samples N" : échantillons par pixel au plus (antialiasing adaptatif), 1 par défaut
+// Lit "-n SEUIL" / "--noise SEUIL" : écart de luminance (1.0 = blanc) sous lequel un pixel n'est plus affiné
+// Lit "--heatmap" : coût de chaque pixel, en fausses couleurs et en flottants bruts, à côté de l'image
+// Lit "--serve CIBLE" : démon de rendu sur l'entrée standard ("-") ou sur une socket Unix, sans fichier de scène ;
+// chaque job donne sa sortie, donc -o, --heatmap, --stats et --stats-json sont refusés avec lui
+// Lit "--stats" : tableau des compteurs et des temps par phase ; "--stats-json FICHIER" : les mêmes en JSON
+static bool parseArguments(const int argc, const char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (!std::strcmp(argv[i], "-o") || !std::strcmp(argv[i], "--output")) {
+            if (!hasValue)
+                return false;
+            options.output = argv[++i];
+        } else if (!std::strcmp(argv[i], "-m") || !std::strcmp(argv[i], "--mode")) {
+            if (!hasValue)
+                return false;
+            ++i;
+            if (!std::strcmp(argv[i], "recursive"))
+                options.mode = Raytracer::Renderer::RECURSIVE;
+            else if (!std::strcmp(argv[i], "wavefront"))
+                options.mode = Raytracer::Renderer::WAVEFRONT;
+            else
+                return false;
+        } else if (!std::strcmp(argv[i], "-t") || !std::strcmp(argv[i], "--threads")) {
+            int value;
+            if (!hasValue || !parseInt(argv[++i], value))
+                return false;
+            options.threads = static_cast<unsigned int>(value);
+        } else if (!std::strcmp(argv[i], "-s") || !std::strcmp(argv[i], "--samples")) {
+            if (!hasValue || !parseInt(argv[++i], options.samples) || options.samples < 1)
+                return false;
+        } else if (!std::strcmp(argv[i], "-n") || !std::strcmp(argv[i], "--noise")) {
+            if (!hasValue || !parseFloat(argv[++i], options.noise))
+                return false;
+        } else if (!std::strcmp(argv[i], "--heatmap")) {
+            options.heatmap = true;
+        } else if (!std::strcmp(argv[i], "--serve")) {
+            if (!hasValue)
+                return false;
+            options.serve = argv[++i];
+        } else if (!std::strcmp(argv[i], "--stats")) {
+            options.stats = true;
+        } else if (!std::strcmp(argv[i], "--stats-json")) {
+            if (!hasValue)
+                return false;
+            options.statsJson = argv[++i];
+        } else if (!options.sceneFile) {
+            options.sceneFile = argv[i];
+        } else {
+            return false;
+        }
+    }
+    if (!options.serve.empty())
+        return options.sceneFile == nullptr && options.output.empty() && !options.heatmap && !options.stats
+            && options.statsJson.empty();
+    if (options.output.empty())
+        options.output = "output.ppm";
+    return options.sceneFile != nullptr;
+}
+
+// Jobs lus ligne à ligne, réponses sur la sortie standard ou la socket
+static void serve(const Options &options) {
+    Raytracer::RenderDaemon daemon(options.threads, options.mode, options.samples, options.noise);
+    if (options.serve == "-") {
+        daemon.serve(std::cin, std::cout);
+        return;
+    }
+    std::cerr << "raytracer: listening on " << options.serve << std::endl;
+    daemon.serveSocket(options.serve);
+}
+
+// output.png -> output_heatmap.png et output_cost.pfm ; l'image en fausses couleurs n'est jamais en PFM
+static void writeHeatmap(const Options &options, const Raytracer::CostMap &costMap) {
+    std::filesystem::path output(options.output);
+    std::string extension = output.extension().string();
+    if (Raytracer::ImageEncoder::getType(options.output) == Raytracer::ImageEncoder::PFM)
+        extension = ".ppm";
+    std::filesystem::path stem = output.parent_path() / output.stem();
+    const std::string image = stem.string() + "_heatmap" + extension;
+    const std::string raw = stem.string() + "_cost.pfm";
+    if (!costMap.write(image, raw))
+        throw GlobalException("Error [main] Failed to write heatmap to " + image + " and " + raw + ".");
+    std::cout << "Heatmap saved as " << image << " (raw costs: " << raw << ")" << std::endl;
+}
+
+// Compteurs de tous les threads, une fois l'image écrite
+static void printStats(const Options &options) {
+#ifdef USE_STATS
+    const Raytracer::RenderStats::Snapshot stats = Raytracer::RenderStats::collect();
+    if (options.stats)
+        Raytracer::RenderStats::printTable(std::cout, stats);
+    if (!options.statsJson.empty()) {
+        std::ofstream file(options.statsJson);
+        Raytracer::RenderStats::printJson(file, stats);
+        if (!file)
+            throw GlobalException("Error [main] Failed to write statistics to " + options.statsJson + ".");
+    }
+#else
+    (void)options;
+    std::cerr << "raytracer: statistics disabled in this build (USE_STATS=OFF)" << std::endl;
+#endif
+}
+
 int main(const int argc, const char **argv) {
-    if (argc != 2)
-        return std::cerr << "USAGE: ./raytracer <SCENE_FILE>" << std::endl, 84;
+    Options options;
+    if (!parseArguments(argc, argv, options))
+        return std::cerr << USAGE << std::endl, 84;
 
     try {
+        if (!options.serve.empty())
+            return serve(options), 0;
+
         Raytracer::Scene scene;
-        Raytracer::SceneParser parser(argv[1], scene);
+        Raytracer::SceneParser parser(options.sceneFile, scene);
 
-        if (!parser.parse())
-            throw GlobalException("Error [main] Failed to parse scene file.");
+        {
+            Raytracer::RenderStats::ScopedPhase phase(Raytracer::RenderStats::PARSE);
+            if (!parser.parse())
+                throw GlobalException("Error [main] Failed to parse scene file.");
+        }
 
         const Raytracer::Camera &camera = scene.getCamera();
         int width = camera.getWidth();
         int height = camera.getHeight();
 
         Raytracer::Renderer renderer(scene, width, height);
+        renderer.setThreadCount(options.threads);
+        renderer.setMode(options.mode);
+        renderer.setSampling(options.samples, options.noise);
+
+        // Le fichier est encodé par un thread dédié au fil des tuiles terminées
+        Raytracer::AsyncImageWriter writer(options.output, renderer.getImage());
+        renderer.setTileCallback([&writer](const Raytracer::Tile &tile) { writer.tileDone(tile); });
+        std::unique_ptr<Raytracer::CostMap> costMap;
+        if (options.heatmap) {
+            costMap = std::make_unique<Raytracer::CostMap>(width, height);
+            renderer.setCostMap(costMap.get());
+        }
         renderer.render(); // ⬅️ très important, sinon image vide
+        if (options.samples > 1)
+            std::cout << "Adaptive sampling: " << renderer.getSampleCount() << " samples ("
+                      << double(renderer.getSampleCount()) / (double(width) * height) << " per pixel)" << std::endl;
 
-        if (!Raytracer::PPMWriter::write("output.ppm", renderer.getImage()))
-            throw GlobalException("Error [main] Failed to write image to file.");
+        {
+            Raytracer::RenderStats::ScopedPhase phase(Raytracer::RenderStats::WRITE);
+            if (!writer.finish())
+                throw GlobalException("Error [main] Failed to write image to " + options.output + ".");
+        }
+        if (costMap)
+            writeHeatmap(options, *costMap);
+        if (options.stats || !options.statsJson.empty())
+            printStats(options);
 
 #ifdef USE_SFML
         Raytracer::Graphics graphics(width, height);
         graphics.run(scene, renderer);
 #else
-        std::cout << "✅ Image saved as output.ppm (SFML disabled)" << std::endl;
+        std::cout << "✅ Image saved as " << options.output << " (SFML disabled)" << std::endl;
 #endif
 
     } catch (GlobalException &e) {
         std::cerr << "raytracer: " << e.what() << std::endl;
         return 84;
+    } catch (std::exception &e) {
+        // Erreurs de la bibliothèque standard (système de fichiers, allocation...)
+        std::cerr << "raytracer: " << e.what() << std::endl;
+        return 84;
     }
 
     return 0;
@@ -0,0 +1,89 @@
+#include <catch2/catch_all.hpp>
+#include <memory>
+#include <set>
+#include <utility>
+#include "Core/Scene.hpp"
+#include "Lights/AmbientLight.hpp"
+#include "Lights/PointLight.hpp"
+#include "Primitives/Plane.hpp"
+#include "Primitives/Sphere.hpp"
+#include "Renderer/AdaptiveSampler.hpp"
+#include "Renderer/Renderer.hpp"
+
+using namespace Raytracer;
+
+TEST_CASE("Adaptive sample offsets", "[adaptive]") {
+    float u, v;
+    AdaptiveSampler::getSampleOffset(0, u, v);
+    REQUIRE(u == 0.5f);
+    REQUIRE(v == 0.5f);
+    std::set<std::pair<float, float>> offsets;
+    for (int i = 1; i < 64; ++i) {
+        AdaptiveSampler::getSampleOffset(i, u, v);
+        REQUIRE(u >= 0.0f);
+        REQUIRE(u < 1.0f);
+        REQUIRE(v >= 0.0f);
+        REQUIRE(v < 1.0f);
+        offsets.insert({u, v});
+    }
+    REQUIRE(offsets.size() == 63);
+}
+
+TEST_CASE("Adaptive sampling refines edges only", "[adaptive][renderer]") {
+    Scene scene;
+    Camera camera;
+    camera.setPosition(Vector3(0.0f, 1.0f, -6.0f));
+    camera.setFieldOfView(60.0f);
+    camera.setResolution(64, 48);
+    scene.setCamera(camera);
+    scene.addPrimitive(std::make_shared<Sphere>(Vector3(0.0f, 1.0f, 0.0f), 1.0f,
+        Material(Material::LAMBERTIAN, Color(220, 40, 40))));
+    scene.addPrimitive(std::make_shared<Plane>(Vector3(0.0f, 1.0f, 0.0f), 0.0f,
+        Material(Material::LAMBERTIAN, Color(40, 40, 40))));
+    scene.addLight(std::make_shared<AmbientLight>(Vector3(0.0f, 0.0f, 0.0f), 0.3f));
+    scene.addLight(std::make_shared<PointLight>(Vector3(3.0f, 6.0f, -3.0f), 0.8f));
+
+    Renderer single(scene, 64, 48);
+    single.setThreadCount(1);
+    REQUIRE(single.getMaxSamples() == 1);
+    single.render();
+    REQUIRE(single.getSampleCount() == 64u * 48u);
+
+    Renderer adaptive(scene, 64, 48);
+    adaptive.setThreadCount(1);
+    adaptive.setSampling(16, 0.02f);
+    REQUIRE(adaptive.getMaxSamples() == 16);
+    REQUIRE(adaptive.getNoiseThreshold() == 0.02f);
+    adaptive.render();
+    REQUIRE(adaptive.getSampleCount() > 64u * 48u);
+    REQUIRE(adaptive.getSampleCount() < 4u * 64u * 48u);
+
+    // Fond uniforme : un seul échantillon ; bord de la sphère : couleur intermédiaire
+    const Framebuffer& reference = single.getImage();
+    const Framebuffer& image = adaptive.getImage();
+    REQUIRE(image.getColor(2, 2).getR() == reference.getColor(2, 2).getR());
+    int changed = 0;
+    for (int y = 0; y < 48; ++y)
+        for (int x = 0; x < 64; ++x)
+            changed += image.getColor(x, y).getR() != reference.getColor(x, y).getR();
+    REQUIRE(changed > 0);
+    REQUIRE(changed < 64 * 48 / 4);
+
+    SECTION("The result does not depend on the threads") {
+        Renderer threaded(scene, 64, 48);
+        threaded.setThreadCount(3);
+        threaded.setSampling(16, 0.02f);
+        threaded.render();
+        REQUIRE(threaded.getSampleCount() == adaptive.getSampleCount());
+        for (int y = 0; y < 48; ++y) {
+            for (int x = 0; x < 64; ++x) {
+                float r0, g0, b0, r1, g1, b1;
+                image.getPixel(x, y, r0, g0, b0);
+                threaded.getImage().getPixel(x, y, r1, g1, b1);
+                REQUIRE(r0 == r1);
+                REQUIRE(g0 == g1);
+                REQUIRE(b0 == b1);
+            }
+        }
+    }
+}
@@ -0,0 +1,147 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <limits>
+#include <memory>
+#include <random>
+#include "Acceleration/BVH.hpp"
+#include "Primitives/CompositePrimitive.hpp"
+#include "Primitives/Plane.hpp"
+#include "Primitives/Sphere.hpp"
+#include "Maths/Ray.hpp"
+
+using namespace Raytracer;
+
+TEST_CASE("AABB operations", "[aabb]") {
+    SECTION("Empty box") {
+        AABB box;
+        REQUIRE(box.isEmpty());
+        REQUIRE(box.surfaceArea() == 0.0f);
+    }
+
+    SECTION("Expand and surface area") {
+        AABB box;
+        box.expand(Vector3(0.0f, 0.0f, 0.0f));
+        box.expand(Vector3(1.0f, 2.0f, 3.0f));
+        REQUIRE_FALSE(box.isEmpty());
+        REQUIRE_THAT(box.surfaceArea(), Catch::Matchers::WithinRel(22.0f));
+        REQUIRE(box.longestAxis() == 2);
+    }
+
+    SECTION("Ray slab test") {
+        AABB box(Vector3(-1.0f, -1.0f, -1.0f), Vector3(1.0f, 1.0f, 1.0f));
+        REQUIRE(box.intersect(Ray(Vector3(0.0f, 0.0f, -5.0f), Vector3(0.0f, 0.0f, 1.0f)), 100.0f));
+        REQUIRE_FALSE(box.intersect(Ray(Vector3(0.0f, 0.0f, -5.0f), Vector3(0.0f, 0.0f, 1.0f)), 2.0f));
+        REQUIRE_FALSE(box.intersect(Ray(Vector3(0.0f, 3.0f, -5.0f), Vector3(0.0f, 0.0f, 1.0f)), 100.0f));
+        REQUIRE_FALSE(box.intersect(Ray(Vector3(0.0f, 0.0f, 5.0f), Vector3(0.0f, 0.0f, 1.0f)), 100.0f));
+    }
+}
+
+TEST_CASE("BVH matches a linear scan", "[bvh]") {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> rad(0.5f, 3.0f);
+    Material material;
+
+    std::vector<std::shared_ptr<Sphere>> spheres;
+    std::vector<AABB> bounds;
+    for (int i = 0; i < 500; ++i) {
+        auto sphere = std::make_shared<Sphere>(Vector3(pos(rng), pos(rng), pos(rng)), rad(rng), material);
+        spheres.push_back(sphere);
+        bounds.push_back(sphere->getBoundingBox());
+    }
+    BVH bvh;
+    bvh.build(bounds);
+
+    // Plus proche sphère touchée à travers la hiérarchie
+    auto closest = [&](const Ray& ray, float& t) {
+        t = std::numeric_limits<float>::infinity();
+        return bvh.intersect(ray, t, [&](uint32_t index, float& tMax) {
+            float tt;
+            if (!spheres[index]->intersect(ray, tt) || tt <= 0.001f || tt >= tMax)
+                return false;
+            tMax = tt;
+            return true;
+        });
+    };
+
+    SECTION("Closest hit is identical") {
+        for (int i = 0; i < 2000; ++i) {
+            Ray ray(Vector3(pos(rng), pos(rng), -100.0f), Vector3(pos(rng) * 0.01f, pos(rng) * 0.01f, 1.0f));
+            float expected = std::numeric_limits<float>::infinity();
+            for (const auto& sphere : spheres) {
+                float t;
+                if (sphere->intersect(ray, t) && t > 0.001f && t < expected)
+                    expected = t;
+            }
+            float t = 0.0f;
+            bool hit = closest(ray, t);
+            REQUIRE(hit == (expected != std::numeric_limits<float>::infinity()));
+            if (hit)
+                REQUIRE(t == expected);
+        }
+    }
+
+    SECTION("Occlusion agrees with the closest hit") {
+        for (int i = 0; i < 2000; ++i) {
+            Ray ray(Vector3(pos(rng), pos(rng), -100.0f), Vector3(pos(rng) * 0.01f, pos(rng) * 0.01f, 1.0f));
+            float tMax = 100.0f + pos(rng);
+            float t = 0.0f;
+            bool expected = closest(ray, t) && t < tMax;
+            REQUIRE(bvh.occluded(ray, tMax, [&](uint32_t index) {
+                float tt;
+                return spheres[index]->intersect(ray, tt) && tt > 0.001f && tt < tMax;
+            }) == expected);
+        }
+    }
+
+    SECTION("Bounds cover every sphere") {
+        REQUIRE_FALSE(bvh.empty());
+        AABB box = bvh.getBounds();
+        for (const auto& sphere : spheres) {
+            AABB s = sphere->getBoundingBox();
+            REQUIRE(s.min.x >= box.min.x);
+            REQUIRE(s.max.y <= box.max.y);
+        }
+    }
+}
+
+TEST_CASE("CompositePrimitive returns the closest child", "[composite]") {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> rad(0.5f, 3.0f);
+    Material material;
+
+    CompositePrimitive composite;
+    for (int i = 0; i < 100; ++i)
+        composite.addPrimitive(std::make_shared<Sphere>(Vector3(pos(rng), pos(rng), pos(rng)), rad(rng), material));
+
+    SECTION("Hit record points to the closest sphere") {
+        for (int i = 0; i < 500; ++i) {
+            Ray ray(Vector3(pos(rng), pos(rng), -100.0f), Vector3(pos(rng) * 0.01f, pos(rng) * 0.01f, 1.0f));
+            float t = 0.0f;
+            HitRecord hit;
+            bool found = composite.intersect(ray, hit);
+            REQUIRE(found == composite.intersect(ray, t));
+            REQUIRE(found == composite.occludes(ray, std::numeric_limits<float>::infinity()));
+            if (!found)
+                continue;
+            REQUIRE(hit.t == t);
+            REQUIRE(hit.primitive != nullptr);
+            REQUIRE(hit.primitive != &composite);
+            Vector3 expected = hit.primitive->getNormal(ray.at(t));
+            REQUIRE(hit.normal.x == expected.x);
+            REQUIRE(hit.normal.y == expected.y);
+            REQUIRE(hit.normal.z == expected.z);
+        }
+    }
+
+    SECTION("Unbounded primitives make the composite unbounded") {
+        REQUIRE(composite.isBounded());
+        composite.addPrimitive(std::make_shared<Plane>(Vector3(0.0f, 1.0f, 0.0f), -1000.0f, material));
+        REQUIRE_FALSE(composite.isBounded());
+        float t;
+        REQUIRE(composite.intersect(Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, -1.0f, 0.0f)), t));
+        REQUIRE(composite.occludes(Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, -1.0f, 0.0f)), 2000.0f));
+        REQUIRE_FALSE(composite.occludes(Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, -1.0f, 0.0f)), 500.0f));
+    }
+}
@@ -0,0 +1,84 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cmath>
+#include "Renderer/CameraRayGenerator.hpp"
+
+using namespace Raytracer;
+
+// Calcul direct d'une direction, tel que le faisait le Renderer pixel par pixel
+static Vector3 referenceDirection(const Camera& camera, int width, int height, int x, int y)
+{
+    float aspect = float(width) / height;
+    float fovScale = std::tan(camera.getFieldOfView() * 0.5f * M_PI / 180.0f);
+    Vector3 d((2.0f * (x + 0.5f) / width - 1.0f) * aspect * fovScale, (1.0f - 2.0f * (y + 0.5f) / height) * fovScale, 1.0f);
+    d = d.normalized();
+    float pitch = camera.getRotation().x * M_PI / 180.0f;
+    float yaw = camera.getRotation().y * M_PI / 180.0f;
+    float roll = camera.getRotation().z * M_PI / 180.0f;
+    d = Vector3(d.x, d.y * std::cos(pitch) - d.z * std::sin(pitch), d.y * std::sin(pitch) + d.z * std::cos(pitch));
+    d = Vector3(d.x * std::cos(yaw) + d.z * std::sin(yaw), d.y, -d.x * std::sin(yaw) + d.z * std::cos(yaw));
+    d = Vector3(d.x * std::cos(roll) - d.y * std::sin(roll), d.x * std::sin(roll) + d.y * std::cos(roll), d.z);
+    return d.normalized();
+}
+
+TEST_CASE("CameraRayGenerator operations", "[camera]") {
+    Camera camera;
+    camera.setPosition(Vector3(1.0f, 2.0f, 3.0f));
+    camera.setFieldOfView(72.0f);
+    const int width = 64;
+    const int height = 48;
+
+    SECTION("Looks along +Z without rotation") {
+        CameraRayGenerator generator(camera, width, height);
+        Vector3 center = generator.getDirection(width * 0.5f, height * 0.5f);
+        REQUIRE_THAT(center.x, Catch::Matchers::WithinAbs(0.0f, 1e-6));
+        REQUIRE_THAT(center.y, Catch::Matchers::WithinAbs(0.0f, 1e-6));
+        REQUIRE_THAT(center.z, Catch::Matchers::WithinAbs(1.0f, 1e-6));
+        REQUIRE(generator.getOrigin().y == 2.0f);
+
+        // Le coin supérieur gauche est à gauche (-X) et en haut (+Y)
+        Vector3 corner = generator.getDirection(0.0f, 0.0f);
+        REQUIRE(corner.x < 0.0f);
+        REQUIRE(corner.y > 0.0f);
+    }
+
+    SECTION("Matches the per-pixel rotation") {
+        camera.setRotation(Vector3(10.0f, -25.0f, 5.0f));
+        CameraRayGenerator generator(camera, width, height);
+        for (int y = 0; y < height; y += 7) {
+            for (int x = 0; x < width; x += 5) {
+                Vector3 expected = referenceDirection(camera, width, height, x, y);
+                Ray ray = generator.generate(x, y);
+                REQUIRE_THAT(ray.getDirection().x, Catch::Matchers::WithinAbs(expected.x, 1e-5));
+                REQUIRE_THAT(ray.getDirection().y, Catch::Matchers::WithinAbs(expected.y, 1e-5));
+                REQUIRE_THAT(ray.getDirection().z, Catch::Matchers::WithinAbs(expected.z, 1e-5));
+            }
+        }
+    }
+
+    SECTION("Rows agree with single rays") {
+        camera.setRotation(Vector3(-30.0f, 45.0f, 0.0f));
+        CameraRayGenerator generator(camera, width, height);
+        float dirX[16], dirY[16], dirZ[16];
+        generator.generateRow(11, 20, 16, dirX, dirY, dirZ);
+        for (int i = 0; i < 16; ++i) {
+            Vector3 expected = generator.getDirection(20 + i + 0.5f, 11.5f);
+            REQUIRE_THAT(dirX[i], Catch::Matchers::WithinAbs(expected.x, 1e-6));
+            REQUIRE_THAT(dirY[i], Catch::Matchers::WithinAbs(expected.y, 1e-6));
+            REQUIRE_THAT(dirZ[i], Catch::Matchers::WithinAbs(expected.z, 1e-6));
+        }
+    }
+
+    SECTION("Rows do not depend on how the image is tiled") {
+        CameraRayGenerator generator(camera, width, height);
+        float fullX[64], fullY[64], fullZ[64];
+        float partX[32], partY[32], partZ[32];
+        generator.generateRow(5, 0, 64, fullX, fullY, fullZ);
+        generator.generateRow(5, 32, 32, partX, partY, partZ);
+        for (int i = 0; i < 32; ++i) {
+            REQUIRE(partX[i] == fullX[32 + i]);
+            REQUIRE(partY[i] == fullY[32 + i]);
+            REQUIRE(partZ[i] == fullZ[32 + i]);
+        }
+    }
+}
@@ -0,0 +1,162 @@
+#include <catch2/catch_all.hpp>
+#include <memory>
+#include <random>
+#include <vector>
+#include "Core/CompiledScene.hpp"
+#include "Core/Scene.hpp"
+#include "Factory/PrimitiveFactory.hpp"
+#include "Primitives/CompositePrimitive.hpp"
+#include "Primitives/Sphere.hpp"
+
+using namespace Raytracer;
+
+namespace {
+    // Primitive d'un type inconnu de la scène compilée : passe par l'interface IPrimitive
+    class Disc : public IPrimitive {
+    public:
+      explicit Disc(const Material& material) : m_material(material) {}
+
+      bool intersect(const Ray& ray, float& t) const override
+      {
+          if (ray.getDirection().y == 0.0f)
+              return false;
+          t = (-20.0f - ray.getOrigin().y) / ray.getDirection().y;
+          Vector3 point = ray.at(t);
+          return t >= 0.0f && point.x * point.x + point.z * point.z < 400.0f;
+      }
+
+      Vector3 getNormal(const Vector3&) const override { return Vector3(0.0f, 1.0f, 0.0f); }
+      Color getColor() const override { return m_material.getColor(); }
+      const Material& getMaterial() const override { return m_material; }
+      Vector3 getCenter() const override { return Vector3(0.0f, -20.0f, 0.0f); }
+      bool isBounded() const override { return true; }
+      AABB getBoundingBox() const override { return AABB(Vector3(-20.0f, -20.0f, -20.0f), Vector3(20.0f, -20.0f, 20.0f)); }
+
+    private:
+      Material m_material;
+    };
+
+    Material coloredMaterial(int index)
+    {
+        return Material(Material::LAMBERTIAN, Color(index % 256, (index * 7) % 256, (index * 13) % 256));
+    }
+
+    void fillScene(Scene& scene)
+    {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> pos(-15.0f, 15.0f);
+        int index = 0;
+        for (int i = 0; i < 40; ++i)
+            scene.addPrimitive(PrimitiveFactory::createSphere(Vector3(pos(rng), pos(rng), pos(rng)), 1.5f, coloredMaterial(index++)));
+        for (int i = 0; i < 40; ++i) {
+            Vector3 a(pos(rng), pos(rng), pos(rng));
+            scene.addPrimitive(PrimitiveFactory::createTriangle(a, a + Vector3(3.0f, 0.0f, 1.0f), a + Vector3(0.0f, 3.0f, 1.0f), coloredMaterial(index++)));
+        }
+        for (int i = 0; i < 4; ++i) {
+            scene.addPrimitive(PrimitiveFactory::createCylinder(Vector3(pos(rng), pos(rng), pos(rng)), 1.0f, 4.0f, Vector3(0.0f, 0.0f, 30.0f), coloredMaterial(index++)));
+            scene.addPrimitive(PrimitiveFactory::createCone(Vector3(pos(rng), pos(rng), pos(rng)), 1.0f, 3.0f, Vector3(20.0f, 0.0f, 0.0f), coloredMaterial(index++)));
+        }
+        scene.addPrimitive(PrimitiveFactory::createTorus(Vector3(0.0f, 0.0f, 0.0f), 3.0f, 1.0f, Vector3(30.0f, 0.0f, 0.0f), coloredMaterial(index++)));
+        scene.addPrimitive(PrimitiveFactory::createTangleCube(Vector3(8.0f, 8.0f, 0.0f), 1.0f, coloredMaterial(index++)));
+        scene.addPrimitive(PrimitiveFactory::createTriangleMesh({Vector3(-20.0f, 10.0f, 10.0f), Vector3(-10.0f, 10.0f, 10.0f),
+            Vector3(-10.0f, 20.0f, 10.0f), Vector3(-20.0f, 20.0f, 10.0f)}, {0, 1, 2, 0, 2, 3}, coloredMaterial(index++)));
+        scene.addPrimitive(PrimitiveFactory::createPlane(Vector3(0.0f, 1.0f, 0.0f), -25.0f, coloredMaterial(index++)));
+        scene.addPrimitive(std::make_shared<Disc>(coloredMaterial(index++)));
+    }
+
+    Ray randomRay(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> pos(-20.0f, 20.0f);
+        return Ray(Vector3(pos(rng), pos(rng), -60.0f), Vector3(pos(rng) * 0.02f, pos(rng) * 0.02f, 1.0f).normalized());
+    }
+
+    void requireSameHit(const HitRecord& hit, const HitRecord& expected, const CompiledScene& compiled)
+    {
+        REQUIRE(hit.primitive == expected.primitive);
+        if (!hit.primitive)
+            return;
+        REQUIRE(hit.t == expected.t);
+        REQUIRE(hit.normal.x == expected.normal.x);
+        REQUIRE(hit.normal.y == expected.normal.y);
+        REQUIRE(hit.normal.z == expected.normal.z);
+        REQUIRE(hit.hasUV == expected.hasUV);
+        const MaterialPalette::Entry& material = compiled.getPalette()[hit.material];
+        REQUIRE(material.red == hit.primitive->getMaterial().getColor().getR());
+        REQUIRE(material.green == hit.primitive->getMaterial().getColor().getG());
+        REQUIRE(material.blue == hit.primitive->getMaterial().getColor().getB());
+    }
+}
+
+TEST_CASE("CompiledScene classification", "[compiled]") {
+    CompiledScene empty;
+    HitRecord hit;
+    REQUIRE(empty.getCount() == 0);
+    REQUIRE_FALSE(empty.intersect(Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f)), hit));
+    REQUIRE_FALSE(empty.occludes(Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f)), 100.0f));
+
+    Scene scene;
+    fillScene(scene);
+    // Les feuilles d'un groupe sont compilées, pas le groupe lui-même
+    auto group = std::make_shared<CompositePrimitive>();
+    group->addPrimitive(std::make_shared<Sphere>(Vector3(0.0f, 30.0f, 0.0f), 1.0f, Material()));
+    group->addPrimitive(std::make_shared<Sphere>(Vector3(0.0f, 35.0f, 0.0f), 1.0f, Material()));
+    scene.addPrimitive(group);
+
+    CompiledScene compiled = scene.compile();
+    REQUIRE(compiled.getCount(CompiledScene::SPHERE) == 42);
+    REQUIRE(compiled.getCount(CompiledScene::TRIANGLE) == 40);
+    REQUIRE(compiled.getCount(CompiledScene::CYLINDER) == 4);
+    REQUIRE(compiled.getCount(CompiledScene::CONE) == 4);
+    REQUIRE(compiled.getCount(CompiledScene::TORUS) == 1);
+    REQUIRE(compiled.getCount(CompiledScene::TANGLECUBE) == 1);
+    REQUIRE(compiled.getCount(CompiledScene::MESH) == 1);
+    REQUIRE(compiled.getCount(CompiledScene::PLANE) == 1);
+    REQUIRE(compiled.getCount(CompiledScene::OTHER) == 1);
+    REQUIRE(compiled.getCount() == 95);
+}
+
+TEST_CASE("CompiledScene matches the root composite", "[compiled]") {
+    Scene scene;
+    fillScene(scene);
+    const CompiledScene compiled = scene.compile();
+    const auto& root = scene.getRootCompositePrimitive();
+    std::mt19937 rng(42);
+
+    SECTION("Single rays") {
+        int hits = 0;
+        for (int i = 0; i < 3000; ++i) {
+            Ray ray = randomRay(rng);
+            HitRecord hit, expected;
+            bool found = compiled.intersect(ray, hit);
+            REQUIRE(found == root->intersect(ray, expected));
+            requireSameHit(hit, expected, compiled);
+            hits += found;
+            float tMax = 30.0f + 40.0f * (i % 3);
+            REQUIRE(compiled.occludes(ray, tMax) == root->occludes(ray, tMax));
+        }
+        REQUIRE(hits > 300);
+    }
+
+    SECTION("Packets") {
+        for (int i = 0; i < 300; ++i) {
+            // Paquets cohérents (même origine, directions voisines) puis désordonnés
+            Ray rays[PACKET_SIZE];
+            Ray base = randomRay(rng);
+            for (int lane = 0; lane < PACKET_SIZE; ++lane) {
+                Vector3 jitter(0.002f * lane, 0.001f * (lane % 3), 0.0f);
+                rays[lane] = i % 2 ? Ray(base.getOrigin(), (base.getDirection() + jitter).normalized()) : randomRay(rng);
+            }
+            RayPacket packet(rays, PACKET_SIZE);
+            uint32_t mask = RayPacket::maskOf(PACKET_SIZE) & ~(1u << (i % PACKET_SIZE));
+            PacketHit hits, expected;
+            compiled.intersectPacket(packet, mask, hits);
+            root->intersectPacket(packet, mask, expected);
+            float tMax[PACKET_SIZE];
+            for (int lane = 0; lane < PACKET_SIZE; ++lane) {
+                requireSameHit(hits.records[lane], expected.records[lane], compiled);
+                tMax[lane] = 20.0f + 10.0f * lane;
+            }
+            REQUIRE(compiled.occludesPacket(packet, mask, tMax) == root->occludesPacket(packet, mask, tMax));
+        }
+    }
+}
@@ -2,6 +2,7 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include "Primitives/Cone.hpp"
 #include "Maths/Ray.hpp"
+#include <limits>
 
 using namespace Raytracer;
 
@@ -81,4 +82,18 @@ TEST_CASE("Cone operations", "[cone]") {
         REQUIRE(normal.y < 0.0f);
         REQUIRE_THAT(normal.length(), Catch::Matchers::WithinRel(1.0f));
     }
-} 
\ No newline at end of file
+    
+    SECTION("Bounding box") {
+        REQUIRE(cone.isBounded());
+        AABB box = cone.getBoundingBox();
+        REQUIRE_THAT(box.min.x, Catch::Matchers::WithinAbs(-radius, 1e-5));
+        REQUIRE_THAT(box.max.z, Catch::Matchers::WithinAbs(radius, 1e-5));
+        REQUIRE_THAT(box.min.y, Catch::Matchers::WithinAbs(0.0f, 1e-5));
+        REQUIRE_THAT(box.max.y, Catch::Matchers::WithinAbs(height, 1e-5));
+    }
+    
+    SECTION("Infinite cone is unbounded") {
+        Cone infinite(baseCenter, radius, std::numeric_limits<float>::infinity(), rotation, material);
+        REQUIRE_FALSE(infinite.isBounded());
+    }
+}
@@ -0,0 +1,97 @@
+#include <catch2/catch_all.hpp>
+#include <memory>
+#include "Core/Scene.hpp"
+#include "Lights/AmbientLight.hpp"
+#include "Lights/PointLight.hpp"
+#include "Primitives/Plane.hpp"
+#include "Primitives/Sphere.hpp"
+#include "Primitives/Torus.hpp"
+#include "Renderer/CostMap.hpp"
+#include "Renderer/Renderer.hpp"
+
+using namespace Raytracer;
+
+TEST_CASE("CostMap heat palette", "[costmap]") {
+    Color cold = CostMap::getHeatColor(0.0f);
+    REQUIRE(cold.getR() == 0);
+    REQUIRE(cold.getG() == 0);
+    REQUIRE(cold.getB() == 0);
+
+    Color hot = CostMap::getHeatColor(1.0f);
+    REQUIRE(hot.getR() == 255);
+    REQUIRE(hot.getG() == 255);
+    REQUIRE(hot.getB() == 210);
+
+    // Hors de [0, 1] : bornée
+    REQUIRE(CostMap::getHeatColor(-2.0f).getR() == 0);
+    REQUIRE(CostMap::getHeatColor(5.0f).getB() == 210);
+    REQUIRE(CostMap::getHeatColor(0.6f).getR() > CostMap::getHeatColor(0.3f).getR());
+}
+
+TEST_CASE("CostMap stores and colors the costs", "[costmap]") {
+    CostMap map(100, 1);
+    for (int x = 0; x < 100; ++x)
+        map.setCost(x, 0, static_cast<float>(x), 2.0f * x, 0.5f);
+    map.setCost(99, 0, 1e9f, 0.0f, 0.0f);
+
+    REQUIRE(map.getCost(10, 0, CostMap::TIME) == 10.0f);
+    REQUIRE(map.getCost(10, 0, CostMap::TESTS) == 20.0f);
+    REQUIRE(map.getCost(10, 0, CostMap::STEPS) == 0.5f);
+    REQUIRE(map.getCosts().getFormat() == Framebuffer::RGB_FLOAT32);
+
+    // L'échelle s'arrête au 99e centile : la valeur aberrante ne noircit pas le reste
+    Framebuffer image = map.getFalseColor(CostMap::TIME);
+    REQUIRE(image.getFormat() == Framebuffer::RGB8);
+    REQUIRE(image.getColor(0, 0).getR() == 0);
+    REQUIRE(image.getColor(98, 0).getR() == 255);
+    REQUIRE(image.getColor(99, 0).getG() == 255);
+    REQUIRE(image.getColor(50, 0).getR() > 0);
+}
+
+TEST_CASE("CostMap records every pixel without changing the image", "[costmap][renderer]") {
+    Scene scene;
+    Camera camera;
+    camera.setPosition(Vector3(0.0f, 2.0f, -10.0f));
+    camera.setFieldOfView(60.0f);
+    camera.setResolution(48, 32);
+    scene.setCamera(camera);
+    scene.addPrimitive(std::make_shared<Sphere>(Vector3(-1.5f, 1.0f, 0.0f), 1.0f, Material()));
+    scene.addPrimitive(std::make_shared<Torus>(Vector3(1.5f, 1.0f, 0.0f), 1.0f, 0.3f, Vector3(60.0f, 0.0f, 0.0f), Material()));
+    scene.addPrimitive(std::make_shared<Plane>(Vector3(0.0f, 1.0f, 0.0f), 0.0f, Material()));
+    scene.addLight(std::make_shared<AmbientLight>(Vector3(0.0f, 0.0f, 0.0f), 0.3f));
+    scene.addLight(std::make_shared<PointLight>(Vector3(4.0f, 8.0f, -4.0f), 0.8f));
+
+    for (Renderer::Mode mode : {Renderer::RECURSIVE, Renderer::WAVEFRONT}) {
+        Renderer expected(scene, 48, 32);
+        expected.setMode(mode);
+        expected.render();
+
+        CostMap map(48, 32);
+        Renderer measured(scene, 48, 32);
+        measured.setThreadCount(2);
+        measured.setMode(mode);
+        measured.setCostMap(&map);
+        measured.render();
+
+        for (int y = 0; y < 32; ++y) {
+            for (int x = 0; x < 48; ++x) {
+                REQUIRE(measured.getImage().getColor(x, y).getR() == expected.getImage().getColor(x, y).getR());
+                REQUIRE(measured.getImage().getColor(x, y).getG() == expected.getImage().getColor(x, y).getG());
+                REQUIRE(measured.getImage().getColor(x, y).getB() == expected.getImage().getColor(x, y).getB());
+                REQUIRE(map.getCost(x, y, CostMap::TIME) > 0.0f);
+#ifdef USE_STATS
+                REQUIRE(map.getCost(x, y, CostMap::TESTS) > 0.0f);
+#endif
+            }
+        }
+#ifdef USE_STATS
+        // Le tore polit ses racines par Newton : au moins un pixel a des pas
+        float steps = 0.0f;
+        for (int y = 0; y < 32; ++y) {
+            for (int x = 0; x < 48; ++x)
+                steps += map.getCost(x, y, CostMap::STEPS);
+        }
+        REQUIRE(steps > 0.0f);
+#endif
+    }
+}
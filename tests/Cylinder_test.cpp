@@ -2,6 +2,7 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include "Primitives/Cylinder.hpp"
 #include "Maths/Ray.hpp"
+#include <limits>
 
 using namespace Raytracer;
 
@@ -105,4 +106,26 @@ TEST_CASE("Cylinder operations", "[cylinder]") {
         // La normale du haut pointe vers le haut
         REQUIRE_THAT(normal.y, Catch::Matchers::WithinRel(1.0f));
     }
-} 
\ No newline at end of file
+    
+    SECTION("Bounding box") {
+        REQUIRE(cylinder.isBounded());
+        AABB box = cylinder.getBoundingBox();
+        REQUIRE_THAT(box.min.x, Catch::Matchers::WithinAbs(-radius, 1e-5));
+        REQUIRE_THAT(box.max.x, Catch::Matchers::WithinAbs(radius, 1e-5));
+        REQUIRE_THAT(box.min.y, Catch::Matchers::WithinAbs(0.0f, 1e-5));
+        REQUIRE_THAT(box.max.y, Catch::Matchers::WithinAbs(height, 1e-5));
+    }
+    
+    SECTION("Bounding box - rotated") {
+        // Couché le long de X : la hauteur se retrouve sur l'axe X
+        Cylinder lying(baseCenter, radius, height, Vector3(0.0f, 0.0f, -90.0f), material);
+        AABB box = lying.getBoundingBox();
+        REQUIRE_THAT(box.max.x, Catch::Matchers::WithinAbs(height, 1e-4));
+        REQUIRE_THAT(box.max.y, Catch::Matchers::WithinAbs(radius, 1e-4));
+    }
+    
+    SECTION("Infinite cylinder is unbounded") {
+        Cylinder infinite(baseCenter, radius, std::numeric_limits<float>::infinity(), rotation, material);
+        REQUIRE_FALSE(infinite.isBounded());
+    }
+}
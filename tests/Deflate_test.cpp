@@ -0,0 +1,202 @@
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "Utils/Deflate.hpp"
+
+using namespace Raytracer;
+
+namespace {
+    // Décodeur minimal des blocs stockés et à codes fixes, suffisant pour relire la sortie du Deflater
+    class FixedInflater {
+    public:
+      explicit FixedInflater(const std::vector<uint8_t>& data) : m_data(data) {}
+
+      bool inflate(std::vector<uint8_t>& out)
+      {
+          static const int LENGTH_BASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+              35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+          static const int LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+              3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+          static const int DISTANCE_BASE[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+              257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+          static const int DISTANCE_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+              7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+          if (m_data.size() < 6 || ((m_data[0] << 8) | m_data[1]) % 31 != 0 || (m_data[0] & 0x0F) != 8)
+              return false;
+          m_position = 16;
+          bool last = false;
+          while (!last) {
+              last = bits(1);
+              int type = bits(2);
+              if (type == 0) {
+                  m_position = (m_position + 7) / 8 * 8;
+                  size_t byte = m_position / 8;
+                  if (byte + 4 > m_data.size())
+                      return false;
+                  size_t length = m_data[byte] | (m_data[byte + 1] << 8);
+                  if ((length ^ (m_data[byte + 2] | (m_data[byte + 3] << 8))) != 0xFFFF || byte + 4 + length > m_data.size())
+                      return false;
+                  out.insert(out.end(), m_data.begin() + byte + 4, m_data.begin() + byte + 4 + length);
+                  m_position = (byte + 4 + length) * 8;
+                  ++m_storedBlocks;
+                  continue;
+              }
+              if (type != 1)
+                  return false;
+              while (true) {
+                  int symbol = symbolCode();
+                  if (symbol < 256) {
+                      out.push_back(static_cast<uint8_t>(symbol));
+                      continue;
+                  }
+                  if (symbol == 256)
+                      break;
+                  symbol -= 257;
+                  if (symbol >= 29)
+                      return false;
+                  int length = LENGTH_BASE[symbol] + bits(LENGTH_EXTRA[symbol]);
+                  int code = reversed(5);
+                  if (code >= 30)
+                      return false;
+                  size_t distance = DISTANCE_BASE[code] + bits(DISTANCE_EXTRA[code]);
+                  if (distance > out.size() || distance > 32768)
+                      return false;
+                  for (int i = 0; i < length; ++i)
+                      out.push_back(out[out.size() - distance]);
+              }
+          }
+          m_position = (m_position + 7) / 8 * 8;
+          size_t byte = m_position / 8;
+          if (byte + 4 != m_data.size())
+              return false;
+          uint32_t adler = (uint32_t(m_data[byte]) << 24) | (uint32_t(m_data[byte + 1]) << 16)
+              | (uint32_t(m_data[byte + 2]) << 8) | m_data[byte + 3];
+          return adler == Deflater::adler32(1, out.data(), out.size());
+      }
+
+      int getStoredBlocks() const { return m_storedBlocks; }
+
+    private:
+      const std::vector<uint8_t>& m_data;
+      size_t m_position = 0;
+      int m_storedBlocks = 0;
+
+      int bits(int count)
+      {
+          int value = 0;
+          for (int i = 0; i < count; ++i, ++m_position)
+              value |= ((m_data[m_position / 8] >> (m_position % 8)) & 1) << i;
+          return value;
+      }
+
+      int reversed(int count)
+      {
+          int value = 0;
+          for (int i = 0; i < count; ++i)
+              value = (value << 1) | bits(1);
+          return value;
+      }
+
+      int symbolCode()
+      {
+          int code = reversed(7);
+          if (code <= 23)
+              return 256 + code;
+          code = (code << 1) | bits(1);
+          if (code >= 0x30 && code <= 0xBF)
+              return code - 0x30;
+          if (code >= 0xC0 && code <= 0xC7)
+              return 280 + code - 0xC0;
+          code = (code << 1) | bits(1);
+          return 144 + code - 0x190;
+      }
+    };
+
+    std::vector<uint8_t> compress(const std::vector<uint8_t>& input, size_t chunk)
+    {
+        Deflater deflater;
+        std::vector<uint8_t> out;
+        for (size_t i = 0; i < input.size(); i += chunk)
+            deflater.write(input.data() + i, std::min(chunk, input.size() - i), out);
+        deflater.finish(out);
+        return out;
+    }
+}
+
+TEST_CASE("Adler-32 checksum", "[deflate]") {
+    const std::string text = "Wikipedia";
+    REQUIRE(Deflater::adler32(1, reinterpret_cast<const uint8_t*>(text.data()), text.size()) == 0x11E60398u);
+    REQUIRE(Deflater::adler32(1, nullptr, 0) == 1u);
+}
+
+TEST_CASE("Deflater round trip", "[deflate]") {
+    std::mt19937 random(42);
+    std::vector<uint8_t> input;
+
+    SECTION("Empty stream") {
+        std::vector<uint8_t> compressed = compress(input, 1);
+        std::vector<uint8_t> output;
+        REQUIRE(FixedInflater(compressed).inflate(output));
+        REQUIRE(output.empty());
+    }
+
+    SECTION("Repetitive data shrinks") {
+        for (int i = 0; i < 200000; ++i)
+            input.push_back(static_cast<uint8_t>((i % 300) < 150 ? i % 7 : 200 + i % 13));
+        for (size_t chunk : {size_t(1) << 20, size_t(1000), size_t(17)}) {
+            std::vector<uint8_t> compressed = compress(input, chunk);
+            REQUIRE(compressed.size() < input.size() / 20);
+            std::vector<uint8_t> output;
+            REQUIRE(FixedInflater(compressed).inflate(output));
+            REQUIRE(output == input);
+        }
+    }
+
+    SECTION("Random data with matches beyond the window") {
+        std::vector<uint8_t> block(50000);
+        for (auto& byte : block)
+            byte = static_cast<uint8_t>(random());
+        input = block;
+        input.insert(input.end(), block.begin(), block.end());
+        for (int i = 0; i < 1000; ++i)
+            input.push_back(static_cast<uint8_t>(random() % 4));
+        std::vector<uint8_t> compressed = compress(input, 4096);
+        std::vector<uint8_t> output;
+        REQUIRE(FixedInflater(compressed).inflate(output));
+        REQUIRE(output == input);
+    }
+
+    SECTION("Incompressible data is stored") {
+        for (int i = 0; i < 100000; ++i)
+            input.push_back(static_cast<uint8_t>(random()));
+        for (size_t chunk : {size_t(1) << 20, size_t(333)}) {
+            std::vector<uint8_t> compressed = compress(input, chunk);
+            // Blocs de 16 Kio : 5 octets d'en-tête par bloc, plus l'en-tête zlib et la somme de contrôle
+            REQUIRE(compressed.size() <= input.size() + 64);
+            std::vector<uint8_t> output;
+            FixedInflater inflater(compressed);
+            REQUIRE(inflater.inflate(output));
+            REQUIRE(inflater.getStoredBlocks() >= 6);
+            REQUIRE(output == input);
+        }
+    }
+
+    SECTION("Stored and coded blocks mix") {
+        for (int i = 0; i < 40000; ++i)
+            input.push_back(static_cast<uint8_t>(random()));
+        input.insert(input.end(), 40000, 7);
+        for (int i = 0; i < 20000; ++i)
+            input.push_back(static_cast<uint8_t>(random()));
+        std::vector<uint8_t> compressed = compress(input, 5000);
+        REQUIRE(compressed.size() < 62000);
+        std::vector<uint8_t> output;
+        FixedInflater inflater(compressed);
+        REQUIRE(inflater.inflate(output));
+        REQUIRE(inflater.getStoredBlocks() >= 3);
+        REQUIRE(output == input);
+    }
+}
@@ -0,0 +1,104 @@
+#include <catch2/catch_all.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include "GlobalException.hpp"
+#include "Renderer/Framebuffer.hpp"
+
+using namespace Raytracer;
+
+TEST_CASE("Framebuffer layout", "[framebuffer]") {
+    SECTION("Aligned rows") {
+        for (auto format : {Framebuffer::RGB_FLOAT32, Framebuffer::RGBA_HALF, Framebuffer::RGB8}) {
+            Framebuffer image(37, 5, format);
+            REQUIRE(image.getStride() % Framebuffer::ROW_ALIGNMENT == 0);
+            REQUIRE(image.getStride() >= 37 * Framebuffer::getPixelSize(format));
+            for (int y = 0; y < 5; ++y)
+                REQUIRE(reinterpret_cast<uintptr_t>(image.getRow(y)) % Framebuffer::ROW_ALIGNMENT == 0);
+        }
+        REQUIRE(Framebuffer::getPixelSize(Framebuffer::RGB_FLOAT32) == 12);
+        REQUIRE(Framebuffer::getPixelSize(Framebuffer::RGBA_HALF) == 8);
+        REQUIRE(Framebuffer::getPixelSize(Framebuffer::RGB8) == 3);
+    }
+
+    SECTION("Custom stride") {
+        Framebuffer image(10, 3, Framebuffer::RGB8, 100);
+        REQUIRE(image.getStride() == 100);
+        image.setPixel(2, 1, Color(1, 2, 3));
+        REQUIRE(image.getRow(1)[6] == 1);
+        REQUIRE(image.getRow(0) + 100 == image.getRow(1));
+        REQUIRE_THROWS_AS(Framebuffer(10, 3, Framebuffer::RGB8, 29), GlobalException);
+        REQUIRE_THROWS_AS(Framebuffer(-1, 3), GlobalException);
+    }
+}
+
+TEST_CASE("Framebuffer pixels", "[framebuffer]") {
+    SECTION("8-bit colors survive every format") {
+        for (auto format : {Framebuffer::RGB_FLOAT32, Framebuffer::RGBA_HALF, Framebuffer::RGB8}) {
+            Framebuffer image(256, 2, format);
+            for (int x = 0; x < 256; ++x)
+                image.setPixel(x, 1, Color(x, 255 - x, x / 2));
+            for (int x = 0; x < 256; ++x) {
+                Color color = image.getColor(x, 1);
+                REQUIRE(color.getR() == x);
+                REQUIRE(color.getG() == 255 - x);
+                REQUIRE(color.getB() == x / 2);
+                REQUIRE(image.getColor(x, 0).getR() == 0);
+            }
+        }
+    }
+
+    SECTION("Float formats keep values above white") {
+        Framebuffer image(4, 4);
+        image.setPixel(3, 3, 2.5f, 0.25f, 1.0f);
+        float r, g, b;
+        image.getPixel(3, 3, r, g, b);
+        REQUIRE(r == 2.5f);
+        REQUIRE(g == 0.25f);
+        REQUIRE(image.getColor(3, 3).getR() == 255);
+
+        Framebuffer clamped(4, 4, Framebuffer::RGB8);
+        clamped.setPixel(0, 0, 2.5f, -1.0f, 0.5f);
+        REQUIRE(clamped.getColor(0, 0).getR() == 255);
+        REQUIRE(clamped.getColor(0, 0).getG() == 0);
+        REQUIRE(clamped.getColor(0, 0).getB() == 128);
+    }
+
+    SECTION("Tile views and copies") {
+        Framebuffer image(64, 64, Framebuffer::RGBA_HALF);
+        Framebuffer::TileView view = image.getTileView(Tile{32, 0, 64, 32});
+        REQUIRE(view.getTile().x0 == 32);
+        view.setPixel(40, 10, Color(10, 20, 30));
+        Framebuffer copy(image);
+        REQUIRE(copy.getColor(40, 10).getB() == 30);
+        image.clear();
+        REQUIRE(image.getColor(40, 10).getB() == 0);
+        REQUIRE(copy.getColor(40, 10).getG() == 20);
+        // L'alpha des demi-flottants reste à 1 après effacement
+        uint16_t alpha;
+        std::memcpy(&alpha, image.getRow(0) + 6, sizeof(alpha));
+        REQUIRE(alpha == 0x3C00);
+    }
+}
+
+TEST_CASE("Half float conversion", "[framebuffer][half]") {
+    REQUIRE(Framebuffer::toHalf(0.0f) == 0x0000);
+    REQUIRE(Framebuffer::toHalf(-0.0f) == 0x8000);
+    REQUIRE(Framebuffer::toHalf(1.0f) == 0x3C00);
+    REQUIRE(Framebuffer::toHalf(-2.0f) == 0xC000);
+    REQUIRE(Framebuffer::toHalf(65504.0f) == 0x7BFF);
+    REQUIRE(Framebuffer::toHalf(65520.0f) == 0x7C00);
+    REQUIRE(Framebuffer::toHalf(std::numeric_limits<float>::infinity()) == 0x7C00);
+    REQUIRE(std::isnan(Framebuffer::fromHalf(Framebuffer::toHalf(std::numeric_limits<float>::quiet_NaN()))));
+    // Plus petit dénormalisé, et arrondi au pair entre 1 et 1 + 2^-10
+    REQUIRE(Framebuffer::toHalf(std::ldexp(1.0f, -24)) == 0x0001);
+    REQUIRE(Framebuffer::toHalf(1.0f + std::ldexp(1.0f, -11)) == 0x3C00);
+    REQUIRE(Framebuffer::toHalf(1.0f + 3.0f * std::ldexp(1.0f, -11)) == 0x3C02);
+
+    // Toute valeur finie représentable fait l'aller-retour exactement
+    for (uint32_t bits = 0; bits < 0x7C00; ++bits) {
+        uint16_t half = static_cast<uint16_t>(bits);
+        REQUIRE(Framebuffer::toHalf(Framebuffer::fromHalf(half)) == half);
+    }
+}
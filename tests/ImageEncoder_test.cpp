@@ -0,0 +1,160 @@
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "GlobalException.hpp"
+#include "Renderer/Framebuffer.hpp"
+#include "Renderer/TileScheduler.hpp"
+#include "Utils/AsyncImageWriter.hpp"
+#include "Utils/ImageEncoder.hpp"
+#include "Utils/PngEncoder.hpp"
+
+using namespace Raytracer;
+
+namespace {
+    std::vector<uint8_t> readFile(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    uint32_t readUint32(const std::vector<uint8_t>& data, size_t offset)
+    {
+        return (uint32_t(data[offset]) << 24) | (uint32_t(data[offset + 1]) << 16)
+            | (uint32_t(data[offset + 2]) << 8) | data[offset + 3];
+    }
+
+    Framebuffer makeImage(int width, int height)
+    {
+        Framebuffer image(width, height);
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x)
+                image.setPixel(x, y, Color(x * 255 / width, y * 255 / height, (x * y) % 256));
+        return image;
+    }
+}
+
+TEST_CASE("Image format from the file extension", "[encoder]") {
+    REQUIRE(ImageEncoder::getType("output.ppm") == ImageEncoder::PPM);
+    REQUIRE(ImageEncoder::getType("dir.v2/render.PNG") == ImageEncoder::PNG);
+    REQUIRE(ImageEncoder::getType("hdr.pfm") == ImageEncoder::PFM);
+    REQUIRE_THROWS_AS(ImageEncoder::getType("output.jpg"), GlobalException);
+    REQUIRE_THROWS_AS(ImageEncoder::getType("output"), GlobalException);
+    REQUIRE_THROWS_AS(ImageEncoder::create("missing_dir/output.ppm", 4, 4), GlobalException);
+}
+
+TEST_CASE("Image encoders", "[encoder]") {
+    const std::string path = "encoder_test";
+    Framebuffer image = makeImage(5, 3);
+    image.setPixel(4, 2, 2.0f, 0.5f, -1.0f);
+
+    SECTION("Binary PPM") {
+        REQUIRE(ImageEncoder::write(path + ".ppm", image));
+        std::vector<uint8_t> data = readFile(path + ".ppm");
+        const std::string header = "P6\n5 3\n255\n";
+        REQUIRE(data.size() == header.size() + 5 * 3 * 3);
+        REQUIRE(std::equal(header.begin(), header.end(), data.begin()));
+        std::vector<uint8_t> row(15);
+        image.readRow(1, row.data());
+        REQUIRE(std::equal(row.begin(), row.end(), data.begin() + header.size() + 15));
+        REQUIRE(data.back() == 0);
+        std::filesystem::remove(path + ".ppm");
+    }
+
+    SECTION("PFM stores linear values bottom row first") {
+        REQUIRE(ImageEncoder::write(path + ".pfm", image));
+        std::vector<uint8_t> data = readFile(path + ".pfm");
+        const std::string header = "PF\n5 3\n-1.0\n";
+        REQUIRE(data.size() == header.size() + 5 * 3 * 3 * sizeof(float));
+        REQUIRE(std::equal(header.begin(), header.end(), data.begin()));
+        float pixel[3];
+        std::memcpy(pixel, data.data() + header.size() + 4 * 3 * sizeof(float), sizeof(pixel));
+        REQUIRE(pixel[0] == 2.0f);
+        REQUIRE(pixel[1] == 0.5f);
+        REQUIRE(pixel[2] == -1.0f);
+        std::filesystem::remove(path + ".pfm");
+    }
+
+    SECTION("PNG chunks") {
+        REQUIRE(ImageEncoder::write(path + ".png", image));
+        std::vector<uint8_t> data = readFile(path + ".png");
+        const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        REQUIRE(std::equal(signature, signature + 8, data.begin()));
+        std::vector<std::string> types;
+        size_t offset = 8;
+        while (offset + 12 <= data.size()) {
+            uint32_t length = readUint32(data, offset);
+            REQUIRE(offset + 12 + length <= data.size());
+            types.emplace_back(data.begin() + offset + 4, data.begin() + offset + 8);
+            REQUIRE(PngEncoder::crc32(0, data.data() + offset + 4, length + 4) == readUint32(data, offset + 8 + length));
+            if (types.back() == "IHDR") {
+                REQUIRE(readUint32(data, offset + 8) == 5);
+                REQUIRE(readUint32(data, offset + 12) == 3);
+            }
+            offset += 12 + length;
+        }
+        REQUIRE(offset == data.size());
+        REQUIRE(types == std::vector<std::string>{"IHDR", "IDAT", "IEND"});
+        std::filesystem::remove(path + ".png");
+    }
+}
+
+TEST_CASE("PNG checksum", "[encoder]") {
+    const std::string text = "123456789";
+    REQUIRE(PngEncoder::crc32(0, reinterpret_cast<const uint8_t*>(text.data()), text.size()) == 0xCBF43926u);
+}
+
+TEST_CASE("Asynchronous writer matches a direct write", "[encoder][async]") {
+    Framebuffer image = makeImage(100, 70);
+    for (const std::string extension : {".ppm", ".png", ".pfm"}) {
+        const std::string direct = "async_direct" + extension;
+        const std::string streamed = "async_streamed" + extension;
+        REQUIRE(ImageEncoder::write(direct, image));
+
+        // Tuiles terminées dans le désordre, comme avec plusieurs threads de rendu
+        Framebuffer rendering(100, 70);
+        AsyncImageWriter writer(streamed, rendering);
+        TileScheduler scheduler(100, 70, 32);
+        scheduler.run(3, [&](const Tile& tile) {
+            for (int y = tile.y0; y < tile.y1; ++y)
+                for (int x = tile.x0; x < tile.x1; ++x)
+                    rendering.setPixel(x, y, image.getColor(x, y));
+            writer.tileDone(tile);
+        });
+        REQUIRE(writer.finish());
+        REQUIRE(readFile(streamed) == readFile(direct));
+        REQUIRE_FALSE(std::filesystem::exists(streamed + ".part"));
+        std::filesystem::remove(direct);
+        std::filesystem::remove(streamed);
+    }
+}
+
+TEST_CASE("Asynchronous writer without finish leaves no file", "[encoder][async]") {
+    const std::string path = "async_abandoned.png";
+    Framebuffer rendering(64, 48);
+    {
+        AsyncImageWriter writer(path, rendering);
+        writer.tileDone(Tile{0, 0, 64, 16});
+        REQUIRE(std::filesystem::exists(path + ".part"));
+        REQUIRE_FALSE(std::filesystem::exists(path));
+    }
+    REQUIRE_FALSE(std::filesystem::exists(path + ".part"));
+    REQUIRE_FALSE(std::filesystem::exists(path));
+
+    SECTION("An older image stays untouched") {
+        REQUIRE(ImageEncoder::write(path, makeImage(8, 8)));
+        const std::vector<uint8_t> older = readFile(path);
+        {
+            AsyncImageWriter writer(path, rendering);
+            writer.tileDone(Tile{0, 0, 64, 48});
+        }
+        REQUIRE(readFile(path) == older);
+        REQUIRE_FALSE(std::filesystem::exists(path + ".part"));
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,76 @@
+#include <catch2/catch_all.hpp>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "Core/Scene.hpp"
+#include "Lights/AmbientLight.hpp"
+#include "Lights/CompositeLight.hpp"
+#include "Lights/DirectionalLight.hpp"
+#include "Lights/LightTable.hpp"
+#include "Lights/PointLight.hpp"
+
+using namespace Raytracer;
+
+namespace {
+    // Lumière d'un type inconnu de la table : passe par l'interface ILight
+    class SpotLight : public ILight {
+    public:
+      Vector3 getDirectionFrom(const Vector3& point) const override
+      {
+          return Vector3(0.0f, 10.0f, 0.0f) - point;
+      }
+
+      float getDistanceFrom(const Vector3& point) const override
+      {
+          return (Vector3(0.0f, 10.0f, 0.0f) - point).length();
+      }
+
+      float getIntensity() const override
+      {
+          return 0.25f;
+      }
+    };
+}
+
+TEST_CASE("LightTable classification", "[lights]") {
+    LightTable empty;
+    REQUIRE(empty.getAmbient() == 0.0f);
+    REQUIRE(empty.getCount() == 0);
+
+    Scene scene;
+    scene.addLight(std::make_shared<DirectionalLight>(Vector3(0, 0, 0), Vector3(0, -2, 0), 0.5f));
+    scene.addLight(std::make_shared<AmbientLight>(Vector3(0, 0, 0), 0.2f));
+    scene.addLight(std::make_shared<SpotLight>());
+    scene.addLight(std::make_shared<PointLight>(Vector3(3, 4, 0), 0.8f));
+    scene.addLight(std::make_shared<AmbientLight>(Vector3(0, 0, 0), 0.1f));
+    scene.addLight(std::make_shared<CompositeLight>());
+
+    LightTable table = scene.createLightTable();
+    REQUIRE_THAT(table.getAmbient(), Catch::Matchers::WithinAbs(0.3f, 1e-5));
+    REQUIRE(table.getCount() == 3);
+    REQUIRE(table.getPointCount() == 1);
+    REQUIRE(table.getDirectionalCount() == 1);
+
+    SECTION("Point lights come first") {
+        const Vector3 origin(0, 0, 0);
+        REQUIRE(table.getIntensity(0) == 0.8f);
+        Vector3 direction = table.getDirection(0, origin);
+        REQUIRE_THAT(direction.x, Catch::Matchers::WithinAbs(0.6f, 1e-5));
+        REQUIRE_THAT(direction.y, Catch::Matchers::WithinAbs(0.8f, 1e-5));
+        REQUIRE_THAT(table.getDistance(0, origin), Catch::Matchers::WithinAbs(5.0f, 1e-5));
+    }
+
+    SECTION("Then directional lights, with unit directions") {
+        REQUIRE(table.getIntensity(1) == 0.5f);
+        Vector3 direction = table.getDirection(1, Vector3(7, 7, 7));
+        REQUIRE_THAT(direction.y, Catch::Matchers::WithinAbs(-1.0f, 1e-5));
+        REQUIRE(std::isinf(table.getDistance(1, Vector3(0, 0, 0))));
+    }
+
+    SECTION("Then other lights through ILight") {
+        REQUIRE(table.getIntensity(2) == 0.25f);
+        Vector3 direction = table.getDirection(2, Vector3(0, 0, 0));
+        REQUIRE_THAT(direction.y, Catch::Matchers::WithinAbs(1.0f, 1e-5));
+        REQUIRE_THAT(table.getDistance(2, Vector3(0, 4, 0)), Catch::Matchers::WithinAbs(6.0f, 1e-5));
+    }
+}
@@ -0,0 +1,86 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "GlobalException.hpp"
+#include "Material/MaterialPalette.hpp"
+
+using namespace Raytracer;
+
+TEST_CASE("MaterialPalette interning", "[material][palette]") {
+    MaterialPalette palette;
+    Material red(Material::LAMBERTIAN, Color(255, 0, 0));
+    Material metal(Material::METAL, Color(200, 200, 200));
+    metal.setRoughness(0.25);
+
+    REQUIRE(palette.add(red) == 0);
+    REQUIRE(palette.add(metal) == 1);
+    REQUIRE(palette.add(Material(Material::LAMBERTIAN, Color(255, 0, 0))) == 0);
+    REQUIRE(palette.getSize() == 2);
+
+    // Une seule propriété différente suffit à créer une nouvelle entrée
+    Material rougher = metal;
+    rougher.setRoughness(0.5);
+    REQUIRE(palette.add(rougher) == 2);
+    Material emissive = red;
+    emissive.setType(Material::EMISSIVE);
+    REQUIRE(palette.add(emissive) == 3);
+    REQUIRE(palette.getSize() == 4);
+
+    SECTION("Too many materials") {
+        MaterialPalette full;
+        Material material;
+        for (size_t i = 0; i < MaterialPalette::MAX_SIZE; ++i) {
+            material.setReflectivity(static_cast<double>(i) / MaterialPalette::MAX_SIZE);
+            full.add(material);
+        }
+        REQUIRE(full.getSize() == MaterialPalette::MAX_SIZE);
+        REQUIRE(full.add(Material()) == 0);
+        material.setReflectivity(2.0);
+        REQUIRE_THROWS_AS(full.add(material), GlobalException);
+    }
+}
+
+TEST_CASE("MaterialPalette shading terms", "[material][palette]") {
+    MaterialPalette palette;
+    Material metal(Material::METAL, Color(10, 20, 30));
+    metal.setRoughness(0.25);
+    Material emissive(Material::EMISSIVE, Color(255, 128, 0));
+    emissive.setEmissiveIntensity(1.5);
+    emissive.setReflectivity(0.3);
+
+    const MaterialPalette::Entry& shiny = palette[palette.add(metal)];
+    REQUIRE(shiny.type == Material::METAL);
+    REQUIRE(shiny.red == 10.0f);
+    REQUIRE(shiny.blue == 30.0f);
+    REQUIRE(shiny.shininess == 98.0f);
+    REQUIRE(shiny.specular == 0.2f);
+    REQUIRE(shiny.reflectance == 0.65f);
+    REQUIRE(shiny.emission == 0.0f);
+
+    const MaterialPalette::Entry& glowing = palette[palette.add(emissive)];
+    REQUIRE(glowing.shininess == 64.0f);
+    REQUIRE(glowing.specular == 0.1f);
+    REQUIRE(glowing.reflectance == 0.3f);
+    REQUIRE(glowing.emission == 1.5f);
+    REQUIRE(sizeof(MaterialPalette::Entry) == 32);
+
+    SECTION("Float32 copy") {
+        Material copy = palette.getMaterial(1);
+        REQUIRE(copy.getType() == Material::EMISSIVE);
+        REQUIRE(copy.getColor().getG() == 128);
+        REQUIRE_THAT(copy.getReflectivity(), Catch::Matchers::WithinAbs(0.3, 1e-7));
+        REQUIRE_THAT(copy.getEmissiveIntensity(), Catch::Matchers::WithinAbs(1.5, 1e-7));
+        REQUIRE_THAT(copy.getRefractiveIndex(), Catch::Matchers::WithinAbs(1.0, 1e-7));
+    }
+
+    SECTION("Materials of another palette") {
+        // 0.3 n'est pas représentable en float : une copie float32 ne retrouverait pas le matériau
+        MaterialPalette scene;
+        uint16_t same = scene.add(emissive);
+        REQUIRE(scene.add(palette, 1) == same);
+        uint16_t copied = scene.add(palette, 0);
+        REQUIRE(scene.getSize() == 2);
+        REQUIRE(scene.add(metal) == copied);
+        REQUIRE(scene[copied].shininess == palette[0].shininess);
+        REQUIRE(scene[copied].reflectance == palette[0].reflectance);
+    }
+}
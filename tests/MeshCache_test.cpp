@@ -0,0 +1,101 @@
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "Parser/MeshCache.hpp"
+#include "Maths/Ray.hpp"
+
+using namespace Raytracer;
+
+TEST_CASE("MeshCache operations", "[meshcache]") {
+    namespace fs = std::filesystem;
+    std::string directory = "meshcache_test_dir";
+    std::string path = "meshcache_test.obj";
+    fs::remove_all(directory);
+    {
+        std::ofstream file(path);
+        file << "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 0.5 0.5 1\n"
+             << "f 1 2 3 4\nf 1 2 5\nf 2 3 5\nf 3 4 5\nf 4 1 5\n";
+    }
+    std::string previous = MeshCache::getDirectory();
+    MeshCache::setDirectory(directory);
+    Material material;
+    Vector3 offset(1.0f, 2.0f, 3.0f);
+    Vector3 rotation(0.0f, 30.0f, 0.0f);
+
+    auto countFiles = [&]() {
+        size_t count = 0;
+        for (const auto& entry : fs::directory_iterator(directory)) {
+            (void)entry;
+            count++;
+        }
+        return count;
+    };
+
+    SECTION("Second load comes from the cache and is identical") {
+        auto parsed = MeshCache::loadObj(path, 2.0f, offset, rotation, material);
+        REQUIRE(countFiles() == 1);
+        auto cached = MeshCache::loadObj(path, 2.0f, offset, rotation, material);
+        REQUIRE(cached->getTriangleCount() == 6);
+        REQUIRE(cached->getIndices() == parsed->getIndices());
+        REQUIRE(cached->getBVH().getNodes().size() == parsed->getBVH().getNodes().size());
+        for (size_t i = 0; i < parsed->getVertexCount(); ++i) {
+            REQUIRE(cached->getVertices()[i].x == parsed->getVertices()[i].x);
+            REQUIRE(cached->getVertices()[i].y == parsed->getVertices()[i].y);
+            REQUIRE(cached->getVertices()[i].z == parsed->getVertices()[i].z);
+        }
+        Ray ray(Vector3(2.0f, 10.0f, 4.0f), Vector3(0.0f, -1.0f, 0.0f));
+        float t1, t2;
+        REQUIRE(parsed->intersect(ray, t1) == cached->intersect(ray, t2));
+    }
+
+    SECTION("Another transform uses another entry") {
+        MeshCache::loadObj(path, 2.0f, offset, rotation, material);
+        MeshCache::loadObj(path, 3.0f, offset, rotation, material);
+        REQUIRE(countFiles() == 2);
+        REQUIRE(MeshCache::computeKey("abc", 1.0f, offset, rotation) != MeshCache::computeKey("abd", 1.0f, offset, rotation));
+    }
+
+    SECTION("A corrupted cache file is ignored") {
+        MeshCache::loadObj(path, 2.0f, offset, rotation, material);
+        for (const auto& entry : fs::directory_iterator(directory))
+            fs::resize_file(entry.path(), fs::file_size(entry.path()) - 4);
+        auto mesh = MeshCache::loadObj(path, 2.0f, offset, rotation, material);
+        REQUIRE(mesh->getTriangleCount() == 6);
+    }
+
+    SECTION("A mesh still alive is reused from memory until its file changes") {
+        MeshCache::setMemoryCache(true);
+        auto first = MeshCache::loadObj(path, 2.0f, offset, rotation, material);
+        REQUIRE(MeshCache::getMemoryCount() == 1);
+        fs::remove_all(directory);
+        Material red;
+        red.setColor(Color(255, 0, 0));
+        // Ni lecture ni écriture du cache disque : la géométrie en mémoire est partagée
+        auto second = MeshCache::loadObj(path, 2.0f, offset, rotation, red);
+        REQUIRE_FALSE(fs::exists(directory));
+        REQUIRE(second != first);
+        REQUIRE(second->getData() == first->getData());
+        REQUIRE(second->getMaterial().getColor().getR() == 255);
+        REQUIRE(first->getMaterial().getColor().getG() == material.getColor().getG());
+
+        {
+            std::ofstream file(path, std::ios::app);
+            file << "f 1 3 5\n";
+        }
+        fs::last_write_time(path, fs::last_write_time(path) + std::chrono::seconds(2));
+        auto changed = MeshCache::loadObj(path, 2.0f, offset, rotation, material);
+        REQUIRE(changed->getTriangleCount() == 7);
+        REQUIRE(changed->getData() != first->getData());
+        first.reset();
+        second.reset();
+        changed.reset();
+        REQUIRE(MeshCache::getMemoryCount() == 0);
+        MeshCache::setMemoryCache(false);
+    }
+
+    MeshCache::setDirectory(previous);
+    fs::remove_all(directory);
+    fs::remove(path);
+}
@@ -0,0 +1,192 @@
+#include <catch2/catch_all.hpp>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include "Core/Scene.hpp"
+#include "Maths/Transform.hpp"
+#include "Parser/MeshCache.hpp"
+#include "Parser/ObjParser.hpp"
+#include "Parser/SceneParser.hpp"
+#include "Primitives/MeshInstance.hpp"
+#include "Primitives/TriangleMesh.hpp"
+
+using namespace Raytracer;
+
+static bool near(const Vector3& a, const Vector3& b, float epsilon)
+{
+    return std::abs(a.x - b.x) < epsilon && std::abs(a.y - b.y) < epsilon && std::abs(a.z - b.z) < epsilon;
+}
+
+// Pyramide à base carrée : 5 sommets, 6 triangles
+static void writePyramid(const std::string& path)
+{
+    std::ofstream file(path);
+    file << "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 0.5 0.5 1\n"
+         << "f 1 2 3 4\nf 1 2 5\nf 2 3 5\nf 3 4 5\nf 4 1 5\n";
+}
+
+TEST_CASE("Transform", "[transform]") {
+    const std::string path = "mesh_instance_transform.obj";
+    writePyramid(path);
+    const Vector3 rotation(20.0f, 35.0f, -50.0f);
+    const Vector3 offset(3.0f, -1.0f, 7.0f);
+    ParsedMesh local = ObjParser::loadMesh(path);
+    ParsedMesh placed = ObjParser::loadMesh(path, 2.5f, offset, rotation);
+    std::filesystem::remove(path);
+
+    SECTION("Placement follows the OBJ loader") {
+        Transform transform = Transform::fromPlacement(2.5f, rotation, offset);
+        for (size_t i = 0; i < local.vertices.size(); ++i)
+            REQUIRE(near(transform.applyToPoint(local.vertices[i]), placed.vertices[i], 1e-4f));
+    }
+
+    SECTION("Inverse and composition") {
+        Transform transform = Transform::fromPlacement(2.5f, rotation, offset);
+        Transform inverse = transform.inverse();
+        Vector3 point(1.0f, -2.0f, 0.5f);
+        REQUIRE(near(inverse.applyToPoint(transform.applyToPoint(point)), point, 1e-5f));
+        REQUIRE(near((inverse * transform).applyToPoint(point), point, 1e-5f));
+        Transform shift(Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f), Vector3(0.0f, 5.0f, 0.0f));
+        REQUIRE(near((shift * transform).applyToPoint(point), transform.applyToPoint(point) + Vector3(0.0f, 5.0f, 0.0f), 1e-5f));
+        REQUIRE(near(Transform().applyToVector(point), point, 1e-6f));
+        REQUIRE_THROWS(Transform::fromPlacement(0.0f, rotation, offset).inverse());
+    }
+
+    SECTION("Boxes") {
+        Transform transform = Transform::fromPlacement(1.0f, Vector3(0.0f, 0.0f, 90.0f), Vector3(10.0f, 0.0f, 0.0f));
+        AABB box = transform.applyToBox(AABB(Vector3(0.0f, 0.0f, 0.0f), Vector3(2.0f, 1.0f, 1.0f)));
+        REQUIRE(near(box.min, Vector3(9.0f, 0.0f, 0.0f), 1e-5f));
+        REQUIRE(near(box.max, Vector3(10.0f, 2.0f, 1.0f), 1e-5f));
+        REQUIRE(transform.applyToBox(AABB()).isEmpty());
+    }
+}
+
+TEST_CASE("MeshInstance matches a mesh built in place", "[meshinstance]") {
+    const std::string path = "mesh_instance_match.obj";
+    writePyramid(path);
+    const float scale = 3.0f;
+    const Vector3 rotation(0.0f, 40.0f, 15.0f);
+    const Vector3 offset(-1.0f, 2.0f, 4.0f);
+    ParsedMesh local = ObjParser::loadMesh(path);
+    ParsedMesh placed = ObjParser::loadMesh(path, scale, offset, rotation);
+    std::filesystem::remove(path);
+
+    Material red;
+    red.setColor(Color(255, 0, 0));
+    auto shared = std::make_shared<const TriangleMesh>(local.vertices, local.indices, Material());
+    TriangleMesh baked(placed.vertices, placed.indices, red);
+    MeshInstance instance(shared, Transform::fromPlacement(scale, rotation, offset), red);
+
+    REQUIRE(instance.getMaterial().getColor().getR() == 255);
+    REQUIRE(instance.getMesh() == shared);
+    REQUIRE(instance.isBounded());
+    // Boîte de la boîte tournée : elle contient celle des sommets tournés, sans être aussi serrée
+    AABB bounds = instance.getBoundingBox();
+    AABB exact = baked.getBoundingBox();
+    REQUIRE(bounds.min.x <= exact.min.x + 1e-4f);
+    REQUIRE(bounds.min.y <= exact.min.y + 1e-4f);
+    REQUIRE(bounds.min.z <= exact.min.z + 1e-4f);
+    REQUIRE(bounds.max.x >= exact.max.x - 1e-4f);
+    REQUIRE(bounds.max.y >= exact.max.y - 1e-4f);
+    REQUIRE(bounds.max.z >= exact.max.z - 1e-4f);
+
+    // Rayons tirés depuis une sphère autour du maillage vers des points de sa boîte
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    Vector3 center = exact.centroid();
+    Ray rays[PACKET_SIZE];
+    int hitsFound = 0;
+    int mismatches = 0;
+    for (int i = 0; i < 256; ++i) {
+        Vector3 from = center + Vector3(unit(rng) - 0.5f, unit(rng) - 0.5f, unit(rng) - 0.5f).normalized() * 20.0f;
+        Vector3 to(exact.min.x + (exact.max.x - exact.min.x) * unit(rng), exact.min.y + (exact.max.y - exact.min.y) * unit(rng),
+            exact.min.z + (exact.max.z - exact.min.z) * unit(rng));
+        Ray ray(from, to - from);
+        rays[i % PACKET_SIZE] = ray;
+
+        HitRecord expected, actual;
+        bool hitBaked = baked.intersect(ray, expected);
+        bool hitInstance = instance.intersect(ray, actual);
+        if (hitBaked && hitInstance) {
+            ++hitsFound;
+            REQUIRE(std::abs(actual.t - expected.t) < 1e-3f);
+            REQUIRE(near(actual.point, expected.point, 1e-3f));
+            REQUIRE(near(actual.normal, expected.normal, 1e-3f));
+            REQUIRE(actual.primitive == &instance);
+            REQUIRE(instance.occludes(ray, actual.t + 0.01f));
+            REQUIRE_FALSE(instance.occludes(ray, actual.t - 0.01f));
+        } else if (hitBaked != hitInstance) {
+            // Arrondis différents : seuls des rayons rasant une arête peuvent changer de camp
+            ++mismatches;
+        }
+
+        if (i % PACKET_SIZE != PACKET_SIZE - 1)
+            continue;
+        RayPacket packet(rays, PACKET_SIZE);
+        PacketHit packetHits;
+        instance.intersectPacket(packet, PACKET_FULL_MASK, packetHits);
+        float tMax[PACKET_SIZE];
+        for (int lane = 0; lane < PACKET_SIZE; ++lane) {
+            HitRecord scalar;
+            bool found = instance.intersect(rays[lane], scalar);
+            REQUIRE((packetHits.records[lane].primitive != nullptr) == found);
+            if (found) {
+                REQUIRE(std::abs(packetHits.t[lane] - scalar.t) < 1e-4f);
+                REQUIRE(near(packetHits.records[lane].normal, scalar.normal, 1e-4f));
+            }
+            tMax[lane] = found ? scalar.t + 0.01f : 1000.0f;
+        }
+        uint32_t occluded = instance.occludesPacket(packet, PACKET_FULL_MASK, tMax);
+        for (int lane = 0; lane < PACKET_SIZE; ++lane)
+            REQUIRE(((occluded >> lane) & 1u) == (packetHits.records[lane].primitive != nullptr ? 1u : 0u));
+    }
+    REQUIRE(hitsFound > 64);
+    REQUIRE(mismatches <= 2);
+}
+
+TEST_CASE("SceneParser instances an OBJ file placed several times", "[meshinstance][parser]") {
+    const std::string obj = "mesh_instance_scene.obj";
+    const std::string cfg = "mesh_instance_scene.cfg";
+    writePyramid(obj);
+    {
+        std::ofstream file(cfg);
+        file << "camera = { resolution = { width = 32; height = 24; }; position = { x = 0; y = 0; z = -10; };\n"
+             << "  rotation = { x = 0; y = 0; z = 0; }; fieldOfView = 60.0; };\n"
+             << "primitives = { obj = (\n"
+             << "  { file = \"" << obj << "\"; offset = { x = -2; y = 0; z = 0; }; color = { r = 255; g = 0; b = 0; }; },\n"
+             << "  { file = \"" << obj << "\"; scale = 2; offset = { x = 2; y = 0; z = 0; }; },\n"
+             << "  { file = \"" << obj << "\"; rotation = { x = 0; y = 90; z = 0; }; offset = { x = 0; y = 3; z = 0; }; }\n"
+             << "); };\n";
+    }
+    // Sans fichier de cache : le test ne laisse rien dans le répertoire courant
+    std::string previous = MeshCache::getDirectory();
+    MeshCache::setDirectory("");
+    Scene scene;
+    SceneParser parser(cfg, scene);
+    bool parsed = parser.parse();
+    MeshCache::setDirectory(previous);
+    std::filesystem::remove(obj);
+    std::filesystem::remove(cfg);
+    REQUIRE(parsed);
+
+    REQUIRE(scene.getPrimitives().size() == 3);
+    auto first = std::dynamic_pointer_cast<MeshInstance>(scene.getPrimitives()[0]);
+    auto second = std::dynamic_pointer_cast<MeshInstance>(scene.getPrimitives()[1]);
+    REQUIRE(first);
+    REQUIRE(second);
+    REQUIRE(first->getMesh() == second->getMesh());
+    REQUIRE(first->getMaterial().getColor().getG() == 0);
+    REQUIRE(second->getMaterial().getColor().getG() == 255);
+
+    CompiledScene compiled = scene.compile();
+    REQUIRE(compiled.getCount(CompiledScene::INSTANCE) == 3);
+    // Base de la pyramide mise à l'échelle, vue par-dessous
+    HitRecord hit;
+    REQUIRE(compiled.intersect(Ray(Vector3(3.5f, 0.5f, -10.0f), Vector3(0.0f, 0.0f, 1.0f)), hit));
+    REQUIRE(hit.primitive == second.get());
+    REQUIRE(std::abs(hit.t - 10.0f) < 1e-4f);
+    REQUIRE(near(hit.normal, Vector3(0.0f, 0.0f, 1.0f), 1e-4f));
+}
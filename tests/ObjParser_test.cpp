@@ -0,0 +1,52 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include "GlobalException.hpp"
+#include "Parser/ObjParser.hpp"
+
+using namespace Raytracer;
+
+TEST_CASE("ObjParser operations", "[objparser]") {
+    std::string path = "objparser_test.obj";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "# commentaire\n"
+             << "o Quad\n"
+             << "v 0 0 0\r\n"
+             << "v 1.5 0 0\n"
+             << "v 1.5\t 2.25 -0.125\n"
+             << "v 0 2.25 1e-1\n"
+             << "vt 0.5 0.5\n"
+             << "vn 0 0 1\n"
+             << "f 1/1/1 2/1/1 3/1/1 4/1/1\n"
+             << "f 1//1 3//1 9//1\n"
+             << "f 2 3 4";
+    }
+
+    SECTION("Indexed mesh") {
+        ParsedMesh mesh = ObjParser::loadMesh(path);
+        REQUIRE(mesh.vertices.size() == 4);
+        // Le quad est découpé en éventail, la face hors limites est ignorée
+        REQUIRE(mesh.indices == std::vector<uint32_t>{0, 1, 2, 0, 2, 3, 1, 2, 3});
+        REQUIRE(mesh.vertices[2].x == 1.5f);
+        REQUIRE(mesh.vertices[2].y == 2.25f);
+        REQUIRE(mesh.vertices[2].z == -0.125f);
+        REQUIRE(mesh.vertices[3].z == 0.1f);
+    }
+
+    SECTION("Transformed triangles") {
+        auto triangles = ObjParser::loadFromFile(path, 2.0f, Vector3(0.0f, 10.0f, 0.0f));
+        REQUIRE(triangles.size() == 3);
+        REQUIRE(triangles[0].b.x == 3.0f);
+        REQUIRE(triangles[0].b.y == 10.0f);
+        REQUIRE(triangles[1].c.y == 14.5f);
+    }
+
+    SECTION("Missing file") {
+        REQUIRE_THROWS_AS(ObjParser::loadMesh("does_not_exist.obj"), GlobalException);
+    }
+
+    std::remove(path.c_str());
+}
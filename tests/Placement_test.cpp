@@ -0,0 +1,226 @@
+#include <catch2/catch_all.hpp>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "Core/CompiledScene.hpp"
+#include "Core/Placement.hpp"
+#include "Core/Scene.hpp"
+#include "Factory/PrimitiveFactory.hpp"
+#include "GlobalException.hpp"
+#include "Parser/SceneParser.hpp"
+
+using namespace Raytracer;
+
+static bool near(const Vector3& a, const Vector3& b, float epsilon)
+{
+    return std::abs(a.x - b.x) < epsilon && std::abs(a.y - b.y) < epsilon && std::abs(a.z - b.z) < epsilon;
+}
+
+static Material colored(int r, int g, int b)
+{
+    Material material;
+    material.setColor(Color(r, g, b));
+    return material;
+}
+
+TEST_CASE("Placement generates grids and scatters", "[placement]") {
+    SECTION("Grid") {
+        Transform base = Transform::fromPlacement(2.0f, Vector3(0.0f, 0.0f, 0.0f), Vector3(10.0f, 0.0f, 0.0f));
+        Placement grid = Placement::makeGrid(0, base, 3, 2, 4, Vector3(1.0f, 5.0f, 0.5f));
+        REQUIRE(grid.getKind() == Placement::GRID);
+        REQUIRE(grid.getCount() == 24);
+        // Copie (2, 1, 3) : décalage (2, 5, 1.5) dans le repère de la grille, puis échelle et translation
+        Transform copy = grid.getTransform(2 + 3 * (1 + 2 * 3));
+        REQUIRE(near(copy.applyToPoint(Vector3(0.0f, 0.0f, 0.0f)), Vector3(14.0f, 10.0f, 3.0f), 1e-5f));
+        REQUIRE(near(copy.applyToVector(Vector3(1.0f, 0.0f, 0.0f)), Vector3(2.0f, 0.0f, 0.0f), 1e-5f));
+        REQUIRE(Placement::makeGrid(0, base, 0, 5, 5, Vector3(1.0f, 1.0f, 1.0f)).getCount() == 0);
+        REQUIRE_THROWS_AS(Placement::makeGrid(0, base, -1, 1, 1, Vector3(1.0f, 1.0f, 1.0f)), GlobalException);
+        // Le produit déborderait 64 bits sans vérification facteur par facteur
+        REQUIRE_THROWS_AS(Placement::makeGrid(0, base, 2000000000, 2000000000, 2000000000, Vector3(1.0f, 1.0f, 1.0f)), GlobalException);
+        REQUIRE_THROWS_AS(Placement::makeGrid(0, base, 1 << 14, 1 << 14, 1, Vector3(1.0f, 1.0f, 1.0f)), GlobalException);
+        REQUIRE(Placement::isGridSizeValid(1 << 14, (1 << 14) - 1, 1));
+        REQUIRE(Placement::isGridSizeValid(2000000000, 2000000000, 0));
+    }
+
+    SECTION("Scatter") {
+        const Vector3 min(-10.0f, 0.0f, -5.0f);
+        const Vector3 max(10.0f, 2.0f, 5.0f);
+        Placement scatter = Placement::makeScatter(1, 200, 42, min, max, Vector3(0.0f, 360.0f, 0.0f), 0.5f, 1.5f);
+        Placement same = Placement::makeScatter(1, 200, 42, min, max, Vector3(0.0f, 360.0f, 0.0f), 0.5f, 1.5f);
+        Placement other = Placement::makeScatter(1, 200, 43, min, max, Vector3(0.0f, 360.0f, 0.0f), 0.5f, 1.5f);
+        REQUIRE(scatter.getCount() == 200);
+        REQUIRE(scatter.getGroup() == 1);
+        int moved = 0;
+        // Ordre inverse : chaque copie ne dépend que de la graine et de son numéro
+        for (size_t i = 200; i-- > 0;) {
+            Transform copy = scatter.getTransform(i);
+            Vector3 origin = copy.applyToPoint(Vector3(0.0f, 0.0f, 0.0f));
+            REQUIRE(origin.x >= min.x);
+            REQUIRE(origin.y >= min.y);
+            REQUIRE(origin.z >= min.z);
+            REQUIRE(origin.x <= max.x);
+            REQUIRE(origin.y <= max.y);
+            REQUIRE(origin.z <= max.z);
+            float scale = copy.applyToVector(Vector3(0.0f, 1.0f, 0.0f)).length();
+            REQUIRE(scale >= 0.5f - 1e-5f);
+            REQUIRE(scale <= 1.5f + 1e-5f);
+            // Rotation autour de Y seulement : l'axe Y reste vertical
+            REQUIRE(near(copy.applyToVector(Vector3(0.0f, 1.0f, 0.0f)) / scale, Vector3(0.0f, 1.0f, 0.0f), 1e-5f));
+            REQUIRE(near(same.getTransform(i).applyToPoint(Vector3(0.0f, 0.0f, 0.0f)), origin, 1e-6f));
+            if (!near(other.getTransform(i).applyToPoint(Vector3(0.0f, 0.0f, 0.0f)), origin, 1e-3f))
+                ++moved;
+        }
+        REQUIRE(moved > 190);
+        REQUIRE_THROWS_AS(Placement::makeScatter(0, -1, 0, min, max, Vector3(0.0f, 0.0f, 0.0f), 1.0f, 1.0f), GlobalException);
+        REQUIRE_THROWS_AS(Placement::makeScatter(0, 1, 0, min, max, Vector3(0.0f, 0.0f, 0.0f), 0.0f, 1.0f), GlobalException);
+    }
+}
+
+TEST_CASE("CompiledScene copies of a group match primitives placed by hand", "[placement][compiledscene]") {
+    const Material red = colored(255, 0, 0);
+    const Material blue = colored(0, 0, 255);
+    PrimitiveGroup group{"pair", {PrimitiveFactory::createSphere(Vector3(1.0f, 0.0f, 0.0f), 0.5f, red),
+        PrimitiveFactory::createTriangle(Vector3(-1.0f, -1.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(-2.0f, 1.0f, 0.0f), blue)}};
+    std::vector<Placement> placements = {
+        Placement(0, Transform::fromPlacement(2.0f, Vector3(0.0f, 30.0f, 0.0f), Vector3(0.0f, 0.0f, 5.0f))),
+        Placement::makeGrid(0, Transform::fromPlacement(1.0f, Vector3(10.0f, 0.0f, 45.0f), Vector3(-6.0f, -4.0f, 0.0f)), 2, 2, 1,
+            Vector3(4.0f, 4.0f, 0.0f))};
+
+    // Même scène écrite à la main : chaque copie transformée primitive par primitive
+    std::vector<std::shared_ptr<IPrimitive>> explicitShapes;
+    for (const Placement& placement : placements) {
+        for (size_t i = 0; i < placement.getCount(); ++i) {
+            Transform copy = placement.getTransform(i);
+            float scale = copy.applyToVector(Vector3(1.0f, 0.0f, 0.0f)).length();
+            explicitShapes.push_back(PrimitiveFactory::createSphere(copy.applyToPoint(Vector3(1.0f, 0.0f, 0.0f)), 0.5f * scale, red));
+            explicitShapes.push_back(PrimitiveFactory::createTriangle(copy.applyToPoint(Vector3(-1.0f, -1.0f, 0.0f)),
+                copy.applyToPoint(Vector3(0.0f, 1.0f, 0.0f)), copy.applyToPoint(Vector3(-2.0f, 1.0f, 0.0f)), blue));
+        }
+    }
+    CompiledScene copies({}, {group}, placements);
+    CompiledScene expected(explicitShapes);
+    REQUIRE(copies.getCount(CompiledScene::GROUP) == 5);
+    REQUIRE(copies.getGroupCount() == 1);
+    REQUIRE(copies.getCount() == 5);
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    Ray rays[PACKET_SIZE];
+    int hitsFound = 0;
+    for (int i = 0; i < 512; ++i) {
+        Vector3 target(unit(rng) * 8.0f, unit(rng) * 8.0f, 2.0f + unit(rng) * 4.0f);
+        Vector3 origin(unit(rng) * 2.0f, unit(rng) * 2.0f, -20.0f);
+        Ray ray(origin, target - origin);
+        rays[i % PACKET_SIZE] = ray;
+
+        HitRecord want, got;
+        bool hitExpected = expected.intersect(ray, want);
+        bool hitCopies = copies.intersect(ray, got);
+        REQUIRE(hitExpected == hitCopies);
+        if (hitExpected) {
+            ++hitsFound;
+            REQUIRE(std::abs(got.t - want.t) < 1e-3f);
+            REQUIRE(near(got.point, want.point, 1e-3f));
+            REQUIRE(near(got.normal, want.normal, 1e-3f));
+            REQUIRE(copies.getPalette().getMaterial(got.material).getColor().getR()
+                == expected.getPalette().getMaterial(want.material).getColor().getR());
+            REQUIRE(copies.occludes(ray, got.t + 0.01f));
+            REQUIRE_FALSE(copies.occludes(ray, got.t - 0.01f));
+        }
+
+        if (i % PACKET_SIZE != PACKET_SIZE - 1)
+            continue;
+        RayPacket packet(rays, PACKET_SIZE);
+        PacketHit packetHits;
+        copies.intersectPacket(packet, PACKET_FULL_MASK, packetHits);
+        float tMax[PACKET_SIZE];
+        for (int lane = 0; lane < PACKET_SIZE; ++lane) {
+            HitRecord scalar;
+            bool found = copies.intersect(rays[lane], scalar);
+            REQUIRE((packetHits.records[lane].primitive != nullptr) == found);
+            if (found) {
+                REQUIRE(std::abs(packetHits.t[lane] - scalar.t) < 1e-4f);
+                REQUIRE(near(packetHits.records[lane].normal, scalar.normal, 1e-4f));
+                REQUIRE(packetHits.records[lane].material == scalar.material);
+            }
+            tMax[lane] = found ? scalar.t + 0.01f : 1000.0f;
+        }
+        uint32_t occluded = copies.occludesPacket(packet, PACKET_FULL_MASK, tMax);
+        for (int lane = 0; lane < PACKET_SIZE; ++lane)
+            REQUIRE(((occluded >> lane) & 1u) == (packetHits.records[lane].primitive != nullptr ? 1u : 0u));
+    }
+    REQUIRE(hitsFound > 32);
+}
+
+TEST_CASE("CompiledScene rejects groups it cannot bound", "[placement][compiledscene]") {
+    PrimitiveGroup ground{"ground", {PrimitiveFactory::createPlane(Vector3(0.0f, 1.0f, 0.0f), 0.0f, Material())}};
+    std::vector<Placement> placements = {Placement(0, Transform())};
+    REQUIRE_THROWS_AS(CompiledScene({}, {ground}, placements), GlobalException);
+    REQUIRE_THROWS_AS(CompiledScene({}, {}, placements), GlobalException);
+}
+
+TEST_CASE("SceneParser reads groups, instances, grids and scatters", "[placement][parser]") {
+    const std::string cfg = "placement_scene.cfg";
+    auto write = [&](const std::string& primitives) {
+        std::ofstream file(cfg);
+        file << "camera = { resolution = { width = 32; height = 24; }; position = { x = 0; y = 0; z = -10; };\n"
+             << "  rotation = { x = 0; y = 0; z = 0; }; fieldOfView = 60.0; };\n"
+             << "groups = ( { name = \"tree\";\n"
+             << "  spheres = ( { x = 0; y = 2; z = 0; r = 1; color = { r = 0; g = 255; b = 0; }; } );\n"
+             << "  cylinders = ( { baseCenter = { x = 0; y = 0; z = 0; }; radius = 0.2; height = 1.5; } ); } );\n"
+             << "primitives = {\n" << primitives << "};\n";
+    };
+
+    SECTION("Copies are expanded at compile time") {
+        write("  spheres = ( { x = 0; y = 0; z = 0; r = 1; } );\n"
+              "  instances = ( { group = \"tree\"; scale = 2; offset = { x = 5; y = 0; z = 0; }; } );\n"
+              "  grids = ( { group = \"tree\"; count = { x = 4; y = 1; z = 3; }; spacing = { x = 3; y = 0; z = 3; }; } );\n"
+              "  scatters = ( { group = \"tree\"; count = 50; seed = 7; min = { x = -20; y = 0; z = 10; };\n"
+              "    max = { x = 20; y = 0; z = 30; }; rotation = { x = 0; y = 360; z = 0; }; minScale = 0.5; maxScale = 2.0; } );\n");
+        Scene scene;
+        SceneParser parser(cfg, scene);
+        REQUIRE(parser.parse());
+        std::filesystem::remove(cfg);
+
+        REQUIRE(scene.getPrimitives().size() == 1);
+        REQUIRE(scene.getGroups().size() == 1);
+        REQUIRE(scene.getGroups()[0].primitives.size() == 2);
+        REQUIRE(scene.getPlacements().size() == 3);
+        CompiledScene compiled = scene.compile();
+        REQUIRE(compiled.getCount(CompiledScene::GROUP) == 1 + 12 + 50);
+        REQUIRE(compiled.getCount(CompiledScene::SPHERE) == 1);
+        // Feuillage de l'instance : sphère de rayon 2 centrée en (5, 4, 0)
+        HitRecord hit;
+        REQUIRE(compiled.intersect(Ray(Vector3(5.0f, 4.0f, -10.0f), Vector3(0.0f, 0.0f, 1.0f)), hit));
+        REQUIRE(std::abs(hit.t - 8.0f) < 1e-4f);
+        REQUIRE(near(hit.normal, Vector3(0.0f, 0.0f, -1.0f), 1e-4f));
+        REQUIRE(compiled.getPalette().getMaterial(hit.material).getColor().getG() == 255);
+        REQUIRE(compiled.getPalette().getMaterial(hit.material).getColor().getR() == 0);
+    }
+
+    SECTION("Grid too large") {
+        write("  grids = ( { group = \"tree\"; count = { x = 100000; y = 100000; z = 100000; }; } );\n");
+        Scene scene;
+        SceneParser parser(cfg, scene);
+        std::string message;
+        try {
+            parser.parse();
+        } catch (const GlobalException& e) {
+            message = e.what();
+        }
+        REQUIRE(message.find("'count' trop grand") != std::string::npos);
+        std::filesystem::remove(cfg);
+    }
+
+    SECTION("Unknown group") {
+        write("  instances = ( { group = \"bush\"; } );\n");
+        Scene scene;
+        SceneParser parser(cfg, scene);
+        REQUIRE_THROWS_AS(parser.parse(), GlobalException);
+        std::filesystem::remove(cfg);
+    }
+}
@@ -54,4 +54,9 @@ TEST_CASE("Plane operations", "[plane]") {
         
         REQUIRE(hit == false);
     }
-} 
\ No newline at end of file
+    
+    SECTION("Plane is unbounded") {
+        REQUIRE_FALSE(plane.isBounded());
+        REQUIRE(plane.getBoundingBox().isEmpty());
+    }
+}
@@ -45,6 +45,12 @@ TEST_CASE("PointLight operations", "[point_light]") {
         REQUIRE_THAT(lightDir.z, Catch::Matchers::WithinRel(0.0f));
     }
     
+    SECTION("GetDistanceFrom a point") {
+        Vector3 point(0.0f, 10.0f, 15.0f);
+
+        REQUIRE_THAT(light.getDistanceFrom(point), Catch::Matchers::WithinRel((position - point).length()));
+    }
+    
     SECTION("With different intensity") {
         PointLight dimLight(position, 0.5f);
         
@@ -0,0 +1,59 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "Utils/PolynomialSolver.hpp"
+
+using namespace Raytracer;
+
+TEST_CASE("PolynomialSolver operations", "[polynomial]") {
+    SECTION("Quadratic") {
+        double roots[2];
+        // x² - 3x + 2 = (x - 1)(x - 2)
+        REQUIRE(PolynomialSolver::solveQuadratic(1.0, -3.0, 2.0, roots) == 2);
+        REQUIRE_THAT(roots[0], Catch::Matchers::WithinAbs(1.0, 1e-12));
+        REQUIRE_THAT(roots[1], Catch::Matchers::WithinAbs(2.0, 1e-12));
+        REQUIRE(PolynomialSolver::solveQuadratic(1.0, 0.0, 1.0, roots) == 0);
+    }
+
+    SECTION("Cubic with a single real root") {
+        float roots[3];
+        // x³ + x + 2 = (x + 1)(x² - x + 2)
+        REQUIRE(PolynomialSolver::solveCubic(1.0f, 0.0f, 1.0f, 2.0f, roots) == 1);
+        REQUIRE_THAT(roots[0], Catch::Matchers::WithinAbs(-1.0f, 1e-5));
+    }
+
+    SECTION("Cubic with three real roots") {
+        double roots[3];
+        // (x - 1)(x - 2)(x - 3), la plus grande racine en premier
+        REQUIRE(PolynomialSolver::solveCubic(1.0, -6.0, 11.0, -6.0, roots) == 3);
+        REQUIRE_THAT(roots[0], Catch::Matchers::WithinAbs(3.0, 1e-9));
+    }
+
+    SECTION("Quartic with four real roots") {
+        double roots[4];
+        // (x + 2)(x - 1)(x - 3)(x - 5) = x⁴ - 7x³ + 5x² + 31x - 30
+        REQUIRE(PolynomialSolver::solveQuartic(1.0, -7.0, 5.0, 31.0, -30.0, roots) == 4);
+        REQUIRE_THAT(roots[0], Catch::Matchers::WithinAbs(-2.0, 1e-12));
+        REQUIRE_THAT(roots[1], Catch::Matchers::WithinAbs(1.0, 1e-12));
+        REQUIRE_THAT(roots[2], Catch::Matchers::WithinAbs(3.0, 1e-12));
+        REQUIRE_THAT(roots[3], Catch::Matchers::WithinAbs(5.0, 1e-12));
+    }
+
+    SECTION("Biquadratic quartic") {
+        float roots[4];
+        // x⁴ - 5x² + 4 = (x² - 1)(x² - 4)
+        REQUIRE(PolynomialSolver::solveQuartic(1.0f, 0.0f, -5.0f, 0.0f, 4.0f, roots) == 4);
+        REQUIRE_THAT(roots[0], Catch::Matchers::WithinAbs(-2.0f, 1e-5));
+        REQUIRE_THAT(roots[3], Catch::Matchers::WithinAbs(2.0f, 1e-5));
+    }
+
+    SECTION("Quartic without real roots") {
+        double roots[4];
+        // (x² + 1)(x² + 2x + 5)
+        REQUIRE(PolynomialSolver::solveQuartic(1.0, 2.0, 6.0, 2.0, 5.0, roots) == 0);
+    }
+
+    SECTION("Quartic with a leading coefficient of zero") {
+        double roots[4];
+        REQUIRE(PolynomialSolver::solveQuartic(0.0, 1.0, -6.0, 11.0, -6.0, roots) == 3);
+    }
+}
@@ -0,0 +1,157 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+#include "Maths/RayPacket.hpp"
+#include "Primitives/CompositePrimitive.hpp"
+#include "Primitives/Plane.hpp"
+#include "Primitives/Sphere.hpp"
+#include "Primitives/Triangle.hpp"
+#include "Primitives/TriangleMesh.hpp"
+
+using namespace Raytracer;
+
+// Chaque voie du paquet doit donner le même impact que le rayon tracé seul, à la même distance
+// au bit près : mêmes opérations dans le même ordre, sans FMA implicite (voir Maths/Simd.hpp)
+static void requireSameHits(const IPrimitive& primitive, const RayPacket& packet, uint32_t mask) {
+    PacketHit hits;
+    primitive.intersectPacket(packet, mask, hits);
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        if (!(mask & (1u << i))) {
+            REQUIRE(std::isinf(hits.t[i]));
+            continue;
+        }
+        HitRecord expected;
+        bool hit = primitive.intersect(packet.rays[i], expected);
+        REQUIRE((hits.records[i].primitive != nullptr) == hit);
+        if (!hit)
+            continue;
+        REQUIRE(hits.t[i] == expected.t);
+        REQUIRE(hits.records[i].primitive == expected.primitive);
+        REQUIRE_THAT(hits.records[i].normal.dot(expected.normal), Catch::Matchers::WithinAbs(1.0f, 1e-4f));
+    }
+}
+
+static void requireSameOcclusion(const IPrimitive& primitive, const RayPacket& packet, uint32_t mask, const float* tMax) {
+    uint32_t occluded = primitive.occludesPacket(packet, mask, tMax);
+    for (int i = 0; i < PACKET_SIZE; ++i) {
+        bool expected = (mask & (1u << i)) && primitive.occludes(packet.rays[i], tMax[i]);
+        REQUIRE(((occluded >> i) & 1u) == (expected ? 1u : 0u));
+    }
+}
+
+TEST_CASE("RayPacket layout", "[raypacket]") {
+    Ray rays[3] = {
+        Ray(Vector3(1.0f, 2.0f, 3.0f), Vector3(0.0f, 0.0f, 2.0f)),
+        Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 1.0f, 1.0f)),
+        Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.1f, 0.2f, 1.0f)),
+    };
+    RayPacket packet(rays, 3);
+    float oy[PACKET_SIZE], dz[PACKET_SIZE];
+    packet.oy.store(oy);
+    packet.dz.store(dz);
+    REQUIRE(oy[0] == 2.0f);
+    REQUIRE(dz[0] == 1.0f);
+    REQUIRE(RayPacket::maskOf(3) == 0x7u);
+    REQUIRE(RayPacket::maskOf(PACKET_SIZE) == PACKET_FULL_MASK);
+
+    SECTION("Coherence") {
+        REQUIRE(packet.isCoherent(0x7u));
+        REQUIRE_FALSE(packet.isCoherent(0x3u));
+        Ray mixed[3] = {rays[0], rays[1], Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(-1.0f, 0.0f, 1.0f))};
+        REQUIRE_FALSE(RayPacket(mixed, 3).isCoherent(0x7u));
+    }
+}
+
+TEST_CASE("Packets match single rays", "[raypacket]") {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> radius(0.3f, 1.5f);
+    Material material;
+
+    CompositePrimitive scene;
+    for (int i = 0; i < 60; ++i)
+        scene.addPrimitive(std::make_shared<Sphere>(Vector3(position(rng), position(rng), position(rng) + 20.0f), radius(rng), material));
+    for (int i = 0; i < 20; ++i) {
+        Vector3 a(position(rng), position(rng), position(rng) + 20.0f);
+        scene.addPrimitive(std::make_shared<Triangle>(a, a + Vector3(2.0f, 0.0f, 0.5f), a + Vector3(0.0f, 2.0f, -0.5f), material));
+    }
+    scene.addPrimitive(std::make_shared<Plane>(Vector3(0.0f, 1.0f, 0.0f), -8.0f, material));
+
+    std::uniform_real_distribution<float> jitter(-0.6f, 0.6f);
+    std::uniform_real_distribution<float> spread(-1.0f, 1.0f);
+    SECTION("Coherent primary rays") {
+        for (int n = 0; n < 200; ++n) {
+            Vector3 center(jitter(rng), jitter(rng), 1.0f);
+            Ray rays[PACKET_SIZE];
+            for (auto& ray : rays)
+                ray = Ray(Vector3(0.0f, 0.0f, 0.0f), center + Vector3(0.01f * spread(rng), 0.01f * spread(rng), 0.0f));
+            RayPacket packet(rays, PACKET_SIZE);
+            requireSameHits(scene, packet, PACKET_FULL_MASK);
+            requireSameHits(scene, packet, 0x5Au);
+        }
+    }
+
+    SECTION("Incoherent rays fall back to single rays") {
+        for (int n = 0; n < 50; ++n) {
+            Ray rays[PACKET_SIZE];
+            for (auto& ray : rays)
+                ray = Ray(Vector3(0.0f, 0.0f, 20.0f), Vector3(spread(rng), spread(rng), spread(rng)));
+            RayPacket packet(rays, PACKET_SIZE);
+            requireSameHits(scene, packet, PACKET_FULL_MASK);
+        }
+    }
+
+    SECTION("Occlusion") {
+        for (int n = 0; n < 200; ++n) {
+            Vector3 origin(position(rng), position(rng), position(rng) + 20.0f);
+            Vector3 target(position(rng), 20.0f, position(rng) + 20.0f);
+            Ray rays[PACKET_SIZE];
+            float tMax[PACKET_SIZE];
+            for (int i = 0; i < PACKET_SIZE; ++i) {
+                Vector3 from = origin + Vector3(0.05f * spread(rng), 0.05f * spread(rng), 0.05f * spread(rng));
+                rays[i] = Ray(from, target - from);
+                tMax[i] = (i % 2 == 0) ? (target - from).length() : std::numeric_limits<float>::infinity();
+            }
+            RayPacket packet(rays, PACKET_SIZE);
+            requireSameOcclusion(scene, packet, PACKET_FULL_MASK, tMax);
+            requireSameOcclusion(scene, packet, 0xC3u, tMax);
+        }
+    }
+}
+
+TEST_CASE("Mesh packets match single rays", "[raypacket][mesh]") {
+    // Grille ondulée de 40 x 40 quads
+    constexpr int N = 40;
+    std::vector<Vector3> vertices;
+    std::vector<uint32_t> indices;
+    for (int z = 0; z <= N; ++z) {
+        for (int x = 0; x <= N; ++x)
+            vertices.emplace_back(x * 0.5f - 10.0f, std::sin(x * 0.7f) * std::cos(z * 0.4f), z * 0.5f);
+    }
+    for (int z = 0; z < N; ++z) {
+        for (int x = 0; x < N; ++x) {
+            uint32_t i = z * (N + 1) + x;
+            indices.insert(indices.end(), {i, i + N + 1, i + 1, i + 1, i + N + 1, i + N + 2});
+        }
+    }
+    TriangleMesh mesh(vertices, indices, Material());
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> spread(-1.0f, 1.0f);
+    for (int n = 0; n < 200; ++n) {
+        Vector3 center(0.4f * spread(rng), -0.5f, 0.5f + 0.4f * spread(rng));
+        Ray rays[PACKET_SIZE];
+        float tMax[PACKET_SIZE];
+        for (int i = 0; i < PACKET_SIZE; ++i) {
+            rays[i] = Ray(Vector3(0.0f, 5.0f, 0.0f), center + Vector3(0.02f * spread(rng), 0.0f, 0.02f * spread(rng)));
+            tMax[i] = 4.0f + 8.0f * (spread(rng) + 1.0f);
+        }
+        RayPacket packet(rays, PACKET_SIZE);
+        requireSameHits(mesh, packet, PACKET_FULL_MASK);
+        requireSameOcclusion(mesh, packet, PACKET_FULL_MASK, tMax);
+    }
+}
@@ -0,0 +1,187 @@
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "Core/Scene.hpp"
+#include "GlobalException.hpp"
+#include "Parser/MeshCache.hpp"
+#include "Parser/SceneParser.hpp"
+#include "Renderer/Renderer.hpp"
+#include "Server/RenderDaemon.hpp"
+#include "Utils/AsyncImageWriter.hpp"
+
+using namespace Raytracer;
+namespace fs = std::filesystem;
+
+static std::string readFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static void writeScene(const std::string& path, int red)
+{
+    std::ofstream file(path);
+    file << "camera = { resolution = { width = 48; height = 32; }; position = { x = 0; y = 0; z = -10; };\n"
+         << "  rotation = { x = 0; y = 0; z = 0; }; fieldOfView = 60.0; };\n"
+         << "lights = { ambient = 0.2; point = ( { x = 5; y = 5; z = -5; } ); directional = (); };\n"
+         << "primitives = { spheres = ( { x = 0; y = 0; z = 0; r = 2; color = { r = " << red << "; g = 40; b = 40; }; },\n"
+         << "  { x = 3; y = 1; z = 2; r = 1; } ); };\n";
+}
+
+// Client de la socket du démon, réessayé le temps qu'elle soit créée ; -1 en cas d'échec
+static int connectTo(const std::string& path)
+{
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    for (int attempt = 0; attempt < 200; ++attempt) {
+        const int client = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (::connect(client, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0)
+            return client;
+        ::close(client);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return -1;
+}
+
+// Tout ce que le démon envoie jusqu'à ce qu'il ferme la connexion
+static std::string receiveAll(int client)
+{
+    std::string text;
+    char buffer[256];
+    ssize_t count;
+    while ((count = ::recv(client, buffer, sizeof(buffer), 0)) > 0)
+        text.append(buffer, static_cast<size_t>(count));
+    return text;
+}
+
+TEST_CASE("RenderDaemon reads render jobs", "[daemon]") {
+    RenderDaemon::Job job = RenderDaemon::parseJob(
+        " scene=a.cfg output=\"out dir/b.png\" position=1,2.5,-3 rotation=0,90,0 fov=45 width=64 samples=4 mode=wavefront");
+    REQUIRE(job.scene == "a.cfg");
+    REQUIRE(job.output == "out dir/b.png");
+    REQUIRE(job.position->y == 2.5f);
+    REQUIRE(job.rotation->y == 90.0f);
+    REQUIRE(*job.fieldOfView == 45.0f);
+    REQUIRE(*job.width == 64);
+    REQUIRE_FALSE(job.height);
+    REQUIRE(*job.samples == 4);
+    REQUIRE(*job.mode == Renderer::WAVEFRONT);
+
+    Camera camera;
+    camera.setResolution(320, 200);
+    job.applyTo(camera);
+    REQUIRE(camera.getWidth() == 64);
+    REQUIRE(camera.getHeight() == 200);
+    REQUIRE(camera.getFieldOfView() == 45.0f);
+
+    REQUIRE_THROWS_AS(RenderDaemon::parseJob("scene=a.cfg"), GlobalException);
+    REQUIRE_THROWS_AS(RenderDaemon::parseJob("scene=a.cfg output=b.ppm position=1,2"), GlobalException);
+    REQUIRE_THROWS_AS(RenderDaemon::parseJob("scene=a.cfg output=b.ppm width=0"), GlobalException);
+    REQUIRE_THROWS_AS(RenderDaemon::parseJob("scene=a.cfg output=b.ppm color=red"), GlobalException);
+    REQUIRE_THROWS_AS(RenderDaemon::parseJob("scene=a.cfg output=\"b.ppm"), GlobalException);
+}
+
+TEST_CASE("RenderDaemon renders from cached scenes", "[daemon]") {
+    const std::string scene = "daemon_test.cfg";
+    const std::string output = "daemon_test.ppm";
+    const std::string expected = "daemon_test_expected.ppm";
+    writeScene(scene, 200);
+    RenderDaemon daemon(2, Renderer::RECURSIVE, 1, Renderer::DEFAULT_NOISE_THRESHOLD);
+
+    SECTION("Second job reuses the scene until the file changes") {
+        std::string answer = daemon.handle("render scene=" + scene + " output=" + output + " position=1,2,-12 width=40 height=30");
+        REQUIRE(answer.rfind("ok " + output + " loaded ", 0) == 0);
+        answer = daemon.handle("render scene=./" + scene + " output=" + output + " position=1,2,-12 width=40 height=30");
+        REQUIRE(answer.rfind("ok " + output + " cached ", 0) == 0);
+
+        // Même image qu'un rendu direct de la scène avec la caméra modifiée
+        Scene direct;
+        SceneParser parser(scene, direct);
+        REQUIRE(parser.parse());
+        direct.getCamera().setPosition(Vector3(1.0f, 2.0f, -12.0f));
+        Renderer renderer(direct, 40, 30);
+        renderer.setThreadCount(2);
+        {
+            AsyncImageWriter writer(expected, renderer.getImage());
+            renderer.render();
+            REQUIRE(writer.finish());
+        }
+        REQUIRE(readFile(output) == readFile(expected));
+
+        writeScene(scene, 20);
+        fs::last_write_time(scene, fs::last_write_time(scene) + std::chrono::seconds(2));
+        answer = daemon.handle("render scene=" + scene + " output=" + output + " position=1,2,-12 width=40 height=30");
+        REQUIRE(answer.rfind("ok " + output + " loaded ", 0) == 0);
+        REQUIRE(readFile(output) != readFile(expected));
+        REQUIRE(daemon.handle("stats") == "ok scenes=1 meshes=0 jobs=3");
+    }
+
+    SECTION("Failures answer an error and the daemon goes on") {
+        REQUIRE(daemon.handle("render scene=missing.cfg output=" + output).rfind("error ", 0) == 0);
+        REQUIRE(daemon.handle("render scene=" + scene).rfind("error ", 0) == 0);
+        REQUIRE(daemon.handle("rotate").rfind("error ", 0) == 0);
+        REQUIRE(daemon.handle("render scene=" + scene + " output=" + output).rfind("ok ", 0) == 0);
+    }
+
+    SECTION("A stream is served until quit") {
+        std::istringstream input("# jobs\n\nrender scene=" + scene + " output=" + output + "\nstats\nquit\nstats\n");
+        std::ostringstream answers;
+        daemon.serve(input, answers);
+        REQUIRE(daemon.isStopped());
+        const std::string text = answers.str();
+        REQUIRE(text.rfind("ok " + output + " loaded ", 0) == 0);
+        REQUIRE(text.find("\nok scenes=1 meshes=0 jobs=1\nok bye\n") != std::string::npos);
+        REQUIRE(text.find("bye\nok") == std::string::npos);
+    }
+
+    MeshCache::setMemoryCache(false);
+    fs::remove(scene);
+    fs::remove(output);
+    fs::remove(expected);
+}
+
+TEST_CASE("RenderDaemon drops socket clients sending too long lines", "[daemon]") {
+    const std::string path = "daemon_test.sock";
+    RenderDaemon daemon(1, Renderer::RECURSIVE, 1, Renderer::DEFAULT_NOISE_THRESHOLD);
+    std::thread server([&] {
+        try {
+            daemon.serveSocket(path);
+        } catch (const GlobalException&) {
+        }
+    });
+
+    // Sans fin de ligne : le démon répond et ferme au lieu de tout garder en mémoire
+    std::string dropped;
+    int client = connectTo(path);
+    if (client >= 0) {
+        const std::string endless(RenderDaemon::MAX_LINE_LENGTH + 1, 'x');
+        ::send(client, endless.data(), endless.size(), 0);
+        dropped = receiveAll(client);
+        ::close(client);
+    }
+    // Le client suivant est servi normalement
+    std::string served;
+    client = connectTo(path);
+    if (client >= 0) {
+        const std::string requests = "stats\nquit\n";
+        ::send(client, requests.data(), requests.size(), 0);
+        served = receiveAll(client);
+        ::close(client);
+    }
+    server.join();
+    MeshCache::setMemoryCache(false);
+
+    REQUIRE(dropped == "error line too long\n");
+    REQUIRE(served == "ok scenes=0 meshes=0 jobs=0\nok bye\n");
+    REQUIRE_FALSE(fs::exists(path));
+}
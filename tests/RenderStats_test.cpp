@@ -0,0 +1,116 @@
+#include <catch2/catch_all.hpp>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Core/Scene.hpp"
+#include "Lights/AmbientLight.hpp"
+#include "Lights/PointLight.hpp"
+#include "Primitives/Plane.hpp"
+#include "Primitives/Sphere.hpp"
+#include "Primitives/Torus.hpp"
+#include "Renderer/Renderer.hpp"
+#include "Utils/RenderStats.hpp"
+
+using namespace Raytracer;
+
+TEST_CASE("RenderStats merges the counters of every thread", "[stats]") {
+    RenderStats::reset();
+    RenderStats::add(RenderStats::SHADOW_RAYS, 5);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([] {
+            for (int j = 0; j < 1000; ++j)
+                RenderStats::add(RenderStats::SPHERE_TESTS, 1);
+            RenderStats::add(RenderStats::PLANE_TESTS, 10);
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    // Threads terminés : leurs blocs ont été reportés dans les totaux
+    RenderStats::Snapshot stats = RenderStats::collect();
+    REQUIRE(stats.counters[RenderStats::SPHERE_TESTS] == 4000);
+    REQUIRE(stats.counters[RenderStats::PLANE_TESTS] == 40);
+    REQUIRE(stats.counters[RenderStats::SHADOW_RAYS] == 5);
+    REQUIRE(stats.getTestCount() == 4040);
+    REQUIRE(stats.getAverage(RenderStats::PLANE_TESTS, RenderStats::SHADOW_RAYS) == 8.0);
+    REQUIRE(stats.getAverage(RenderStats::PLANE_TESTS, RenderStats::PRIMARY_RAYS) == 0.0);
+
+    RenderStats::reset();
+    REQUIRE(RenderStats::collect().counters[RenderStats::SHADOW_RAYS] == 0);
+    REQUIRE(RenderStats::collect().getTestCount() == 0);
+}
+
+TEST_CASE("RenderStats output", "[stats]") {
+    RenderStats::Snapshot stats;
+    stats.counters[RenderStats::PRIMARY_RAYS] = 100;
+    stats.counters[RenderStats::TANGLECUBE_TESTS] = 4;
+    stats.counters[RenderStats::TANGLECUBE_STEPS] = 50;
+    stats.seconds[RenderStats::RENDER] = 0.25;
+
+    std::ostringstream json;
+    RenderStats::printJson(json, stats);
+    REQUIRE(json.str().find("\"render\": 250") != std::string::npos);
+    REQUIRE(json.str().find("\"primary_rays\": 100") != std::string::npos);
+    REQUIRE(json.str().find("\"tanglecube_steps_per_test\": 12.5") != std::string::npos);
+    REQUIRE(json.str().front() == '{');
+
+    std::ostringstream table;
+    RenderStats::printTable(table, stats);
+    REQUIRE(table.str().find("render") != std::string::npos);
+    REQUIRE(table.str().find("12.50 steps per test") != std::string::npos);
+    REQUIRE(std::string(RenderStats::getName(RenderStats::OBJ_LOAD)) == "obj_load");
+    REQUIRE(std::string(RenderStats::getName(RenderStats::BVH_NODES)) == "bvh_nodes");
+}
+
+#ifdef USE_STATS
+TEST_CASE("RenderStats phases exclude nested phases", "[stats]") {
+    RenderStats::reset();
+    {
+        RenderStats::ScopedPhase outer(RenderStats::PARSE);
+        RenderStats::ScopedPhase inner(RenderStats::OBJ_LOAD);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    RenderStats::Snapshot stats = RenderStats::collect();
+    REQUIRE(stats.seconds[RenderStats::OBJ_LOAD] >= 0.02);
+    REQUIRE(stats.seconds[RenderStats::PARSE] < stats.seconds[RenderStats::OBJ_LOAD]);
+}
+
+TEST_CASE("RenderStats counts the work of a render", "[stats][renderer]") {
+    Scene scene;
+    Camera camera;
+    camera.setPosition(Vector3(0.0f, 2.0f, -10.0f));
+    camera.setFieldOfView(60.0f);
+    camera.setResolution(64, 48);
+    scene.setCamera(camera);
+    scene.addPrimitive(std::make_shared<Sphere>(Vector3(-1.5f, 1.0f, 0.0f), 1.0f, Material()));
+    scene.addPrimitive(std::make_shared<Torus>(Vector3(1.5f, 1.0f, 0.0f), 1.0f, 0.3f, Vector3(60.0f, 0.0f, 0.0f), Material()));
+    scene.addPrimitive(std::make_shared<Plane>(Vector3(0.0f, 1.0f, 0.0f), 0.0f, Material()));
+    scene.addLight(std::make_shared<AmbientLight>(Vector3(0.0f, 0.0f, 0.0f), 0.3f));
+    scene.addLight(std::make_shared<PointLight>(Vector3(4.0f, 8.0f, -4.0f), 0.8f));
+
+    for (Renderer::Mode mode : {Renderer::RECURSIVE, Renderer::WAVEFRONT}) {
+        RenderStats::reset();
+        Renderer renderer(scene, 64, 48);
+        renderer.setThreadCount(2);
+        renderer.setMode(mode);
+        renderer.render();
+
+        RenderStats::Snapshot stats = RenderStats::collect();
+        REQUIRE(stats.counters[RenderStats::PRIMARY_RAYS] == 64 * 48);
+        REQUIRE(stats.counters[RenderStats::SHADOW_RAYS] > 0);
+        REQUIRE(stats.counters[RenderStats::SHADOW_RAYS] <= stats.counters[RenderStats::PRIMARY_RAYS]
+            + stats.counters[RenderStats::REFLECTION_RAYS]);
+        REQUIRE(stats.counters[RenderStats::PLANE_TESTS] > 0);
+        REQUIRE(stats.counters[RenderStats::SPHERE_TESTS] > 0);
+        REQUIRE(stats.counters[RenderStats::TORUS_TESTS] > 0);
+        REQUIRE(stats.counters[RenderStats::BVH_NODES] > 0);
+        REQUIRE(stats.counters[RenderStats::QUARTIC_ITERATIONS] > 0);
+        REQUIRE(stats.seconds[RenderStats::RENDER] > 0.0);
+        REQUIRE(stats.seconds[RenderStats::BUILD] > 0.0);
+    }
+}
+#endif
@@ -47,6 +47,33 @@ TEST_CASE("TangleCube operations", "[tanglecube]") {
         REQUIRE(hit == false);
     }
     
+    SECTION("Ray intersection - exact distance on the diagonal") {
+        // Sur x = y = z = a : 3a⁴ - 15a² + 11.8 = 0, première racine a ≈ 2.005507
+        Ray ray(Vector3(3.0f, 3.0f, 3.0f), Vector3(-1.0f, -1.0f, -1.0f).normalized());
+        float t;
+
+        REQUIRE(tangleCube.intersect(ray, t));
+        REQUIRE_THAT(t, Catch::Matchers::WithinAbs(1.722512f, 1e-4));
+    }
+
+    SECTION("Ray intersection - scaled surface far from the origin") {
+        // Même rayon pour un TangleCube de taille 50 : la marche doit atteindre la surface
+        TangleCube big(Vector3(0.0f, 60.0f, 100.0f), 50.0f, material);
+        Vector3 direction = Vector3(-1.0f, -1.0f, -1.0f).normalized();
+        Ray ray(Vector3(150.0f, 210.0f, 250.0f), direction);
+        float t;
+
+        REQUIRE(big.intersect(ray, t));
+        REQUIRE_THAT(t, Catch::Matchers::WithinAbs(50.0f * 1.722512f, 5e-3));
+    }
+
+    SECTION("Ray intersection - miss the bounding box") {
+        Ray ray(Vector3(0.0f, 3.0f, -10.0f), Vector3(0.0f, 0.0f, 1.0f));
+        float t;
+
+        REQUIRE_FALSE(tangleCube.intersect(ray, t));
+    }
+
     SECTION("Normal calculation") {
         // Un point sur la surface du TangleCube
         // (les coordonnées exactes dépendent de l'équation de la surface)
@@ -78,4 +105,13 @@ TEST_CASE("TangleCube operations", "[tanglecube]") {
         REQUIRE(baseCenter.y == center.y);
         REQUIRE(baseCenter.z == center.z);
     }
-} 
\ No newline at end of file
+    
+    SECTION("Bounding box") {
+        REQUIRE(tangleCube.isBounded());
+        AABB box = tangleCube.getBoundingBox();
+        // La surface atteint |x| ≈ 2.2664 quand y et z minimisent leurs termes
+        REQUIRE(box.max.x >= 2.2664f);
+        REQUIRE(box.max.x < 2.5f);
+        REQUIRE(box.min.z <= -2.2664f);
+    }
+}
@@ -0,0 +1,47 @@
+#include <catch2/catch_all.hpp>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include "Renderer/TileScheduler.hpp"
+
+using namespace Raytracer;
+
+TEST_CASE("TileScheduler operations", "[tilescheduler]") {
+    const int width = 203;
+    const int height = 117;
+
+    SECTION("Tile count") {
+        TileScheduler scheduler(width, height, 32);
+        REQUIRE(scheduler.getTileCount() == 7 * 4);
+        REQUIRE(TileScheduler::getDefaultThreadCount() >= 1);
+    }
+
+    SECTION("Every pixel is visited exactly once") {
+        for (unsigned int threads : {1u, 3u, 8u, 0u}) {
+            std::vector<std::atomic<int>> visits(width * height);
+            TileScheduler scheduler(width, height, 16);
+            scheduler.run(threads, [&](const Tile& tile) {
+                for (int y = tile.y0; y < tile.y1; ++y)
+                    for (int x = tile.x0; x < tile.x1; ++x)
+                        visits[y * width + x]++;
+            });
+            for (const auto& count : visits)
+                REQUIRE(count == 1);
+        }
+    }
+
+    SECTION("Exceptions reach the caller") {
+        TileScheduler scheduler(width, height, 16);
+        REQUIRE_THROWS_AS(scheduler.run(4, [](const Tile& tile) {
+            if (tile.x0 == 0 && tile.y0 == 0)
+                throw std::runtime_error("tile failed");
+        }), std::runtime_error);
+    }
+
+    SECTION("Empty image") {
+        TileScheduler scheduler(0, 0);
+        int calls = 0;
+        scheduler.run(4, [&](const Tile&) { calls++; });
+        REQUIRE(calls == 0);
+    }
+}
@@ -37,6 +37,43 @@ TEST_CASE("Torus operations", "[torus]") {
         REQUIRE(t > 0.0f);
     }
     
+    SECTION("Ray intersection - exact distance") {
+        // Le rayon entre dans le tube en z = -(R + r)
+        Ray ray(Vector3(0.0f, 0.0f, -10.0f), Vector3(0.0f, 0.0f, 1.0f));
+        float t;
+
+        REQUIRE(torus.intersect(ray, t));
+        REQUIRE_THAT(t, Catch::Matchers::WithinAbs(10.0f - majorRadius - minorRadius, 1e-4));
+    }
+
+    SECTION("Ray intersection - grazing hit") {
+        // Rayon qui frôle le dessus du tube, juste sous y = r
+        Ray ray(Vector3(-10.0f, minorRadius - 1e-3f, 0.0f), Vector3(1.0f, 0.0f, 0.0f));
+        float t;
+
+        REQUIRE(torus.intersect(ray, t));
+        Vector3 point = ray.getOrigin() + ray.getDirection() * t;
+        REQUIRE_THAT(point.x, Catch::Matchers::WithinAbs(-majorRadius, 0.1));
+
+        Ray above(Vector3(-10.0f, minorRadius + 1e-3f, 0.0f), Vector3(1.0f, 0.0f, 0.0f));
+        REQUIRE_FALSE(torus.intersect(above, t));
+    }
+
+    SECTION("Ray intersection - through the hole") {
+        Ray ray(Vector3(0.0f, -10.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+        float t;
+
+        REQUIRE_FALSE(torus.intersect(ray, t));
+    }
+
+    SECTION("Ray intersection - from inside the tube") {
+        Ray ray(Vector3(majorRadius, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f));
+        float t;
+
+        REQUIRE(torus.intersect(ray, t));
+        REQUIRE_THAT(t, Catch::Matchers::WithinAbs(minorRadius, 1e-4));
+    }
+
     SECTION("Ray intersection - hit inner") {
         // Rayon qui frappe la partie intérieure du tore
         Ray ray(Vector3(majorRadius - minorRadius/2, 0.0f, -10.0f), Vector3(0.0f, 0.0f, 1.0f));
@@ -100,4 +137,20 @@ TEST_CASE("Torus operations", "[torus]") {
         REQUIRE(baseCenter.y == center.y);
         REQUIRE(baseCenter.z == center.z);
     }
-} 
\ No newline at end of file
+    
+    SECTION("Bounding box") {
+        REQUIRE(torus.isBounded());
+        AABB box = torus.getBoundingBox();
+        REQUIRE_THAT(box.max.x, Catch::Matchers::WithinAbs(majorRadius + minorRadius, 1e-5));
+        REQUIRE_THAT(box.max.z, Catch::Matchers::WithinAbs(majorRadius + minorRadius, 1e-5));
+        REQUIRE_THAT(box.max.y, Catch::Matchers::WithinAbs(minorRadius, 1e-5));
+    }
+    
+    SECTION("Bounding box - rotated") {
+        // Tourné de 90° autour de X : l'anneau se retrouve dans le plan XY
+        Torus standing(center, majorRadius, minorRadius, Vector3(90.0f, 0.0f, 0.0f), material);
+        AABB box = standing.getBoundingBox();
+        REQUIRE_THAT(box.max.y, Catch::Matchers::WithinAbs(majorRadius + minorRadius, 1e-4));
+        REQUIRE_THAT(box.max.z, Catch::Matchers::WithinAbs(minorRadius, 1e-4));
+    }
+}
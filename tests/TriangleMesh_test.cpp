@@ -0,0 +1,114 @@
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <limits>
+#include <random>
+#include "GlobalException.hpp"
+#include "Primitives/Triangle.hpp"
+#include "Primitives/TriangleMesh.hpp"
+#include "Maths/Ray.hpp"
+
+using namespace Raytracer;
+
+TEST_CASE("TriangleMesh operations", "[trianglemesh]") {
+    Material material;
+    material.setColor(Color(0, 255, 0)); // Vert
+
+    // Grille de 20x20 quads dans le plan z = 0, légèrement bosselée
+    const int size = 20;
+    std::vector<Vector3> vertices;
+    std::vector<uint32_t> indices;
+    for (int y = 0; y <= size; ++y)
+        for (int x = 0; x <= size; ++x)
+            vertices.emplace_back(float(x), float(y), 0.1f * float((x * 7 + y * 3) % 5));
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            uint32_t i = y * (size + 1) + x;
+            indices.insert(indices.end(), {i, i + 1, i + size + 1, i + 1, i + size + 2, i + size + 1});
+        }
+    }
+    std::vector<Triangle> triangles;
+    for (size_t i = 0; i < indices.size(); i += 3)
+        triangles.emplace_back(vertices[indices[i]], vertices[indices[i + 1]], vertices[indices[i + 2]], material);
+
+    TriangleMesh mesh(vertices, indices, material);
+
+    SECTION("Getters") {
+        REQUIRE(mesh.getTriangleCount() == 2 * size * size);
+        REQUIRE(mesh.getVertexCount() == (size + 1) * (size + 1));
+        REQUIRE(mesh.getColor().getG() == 255);
+        REQUIRE(mesh.isBounded());
+        AABB box = mesh.getBoundingBox();
+        REQUIRE(box.min.x == 0.0f);
+        REQUIRE(box.max.x == float(size));
+        REQUIRE(box.max.y == float(size));
+    }
+
+    SECTION("Matches the individual triangles") {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> pos(-2.0f, float(size) + 2.0f);
+        for (int i = 0; i < 1000; ++i) {
+            Ray ray(Vector3(pos(rng), pos(rng), -10.0f), Vector3(pos(rng) * 0.02f, pos(rng) * 0.02f, 1.0f).normalized());
+            float expected = std::numeric_limits<float>::infinity();
+            const Triangle* expectedTriangle = nullptr;
+            for (const auto& triangle : triangles) {
+                float t;
+                if (triangle.intersect(ray, t) && t < expected) {
+                    expected = t;
+                    expectedTriangle = &triangle;
+                }
+            }
+            HitRecord hit;
+            bool found = mesh.intersect(ray, hit);
+            REQUIRE(found == (expectedTriangle != nullptr));
+            if (!found)
+                continue;
+            REQUIRE(hit.t == expected);
+            REQUIRE(hit.primitive == &mesh);
+            REQUIRE(hit.hasUV);
+            Vector3 normal = expectedTriangle->getNormal(hit.point);
+            REQUIRE(hit.normal.x == normal.x);
+            REQUIRE(hit.normal.y == normal.y);
+            REQUIRE(hit.normal.z == normal.z);
+        }
+    }
+
+    SECTION("Occlusion stops at the distance bound") {
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<float> pos(-2.0f, float(size) + 2.0f);
+        for (int i = 0; i < 1000; ++i) {
+            Ray ray(Vector3(pos(rng), pos(rng), -10.0f), Vector3(pos(rng) * 0.02f, pos(rng) * 0.02f, 1.0f).normalized());
+            float tMax = 10.0f + pos(rng);
+            float t;
+            bool expected = mesh.intersect(ray, t) && t < tMax;
+            REQUIRE(mesh.occludes(ray, tMax) == expected);
+        }
+    }
+
+    SECTION("Shared geometry") {
+        Material red;
+        red.setColor(Color(255, 0, 0));
+        TriangleMesh other(mesh.getData(), red);
+        REQUIRE(other.getData() == mesh.getData());
+        REQUIRE(&other.getVertices() == &mesh.getVertices());
+        REQUIRE(other.getColor().getR() == 255);
+        REQUIRE(mesh.getColor().getR() == 0);
+        Ray ray(Vector3(5.5f, 5.5f, -5.0f), Vector3(0.0f, 0.0f, 1.0f));
+        HitRecord a, b;
+        REQUIRE(mesh.intersect(ray, a));
+        REQUIRE(other.intersect(ray, b));
+        REQUIRE(a.t == b.t);
+        REQUIRE(b.primitive == &other);
+    }
+
+    SECTION("Invalid indices") {
+        REQUIRE_THROWS_AS(TriangleMesh(vertices, {0, 1}, material), GlobalException);
+        REQUIRE_THROWS_AS(TriangleMesh(vertices, {0, 1, uint32_t(vertices.size())}, material), GlobalException);
+    }
+
+    SECTION("Empty mesh") {
+        TriangleMesh empty({}, {}, material);
+        float t;
+        REQUIRE_FALSE(empty.isBounded());
+        REQUIRE_FALSE(empty.intersect(Ray(Vector3(0.0f, 0.0f, -1.0f), Vector3(0.0f, 0.0f, 1.0f)), t));
+    }
+}
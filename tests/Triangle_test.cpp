@@ -1,5 +1,6 @@
 #include <catch2/catch_all.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cmath>
 #include "Primitives/Triangle.hpp"
 #include "Maths/Ray.hpp"
 
@@ -37,6 +38,21 @@ TEST_CASE("Triangle operations", "[triangle]") {
         REQUIRE_THAT(t, Catch::Matchers::WithinRel(1.0f));
     }
     
+    SECTION("Ray intersection - hit record") {
+        // Point (1, 1) = A + 0.25 * (B - A) + 0.5 * (C - A)
+        Ray ray(Vector3(1.0f, 1.0f, -1.0f), Vector3(0.0f, 0.0f, 1.0f));
+        HitRecord hit;
+        
+        REQUIRE(triangle.intersect(ray, hit));
+        REQUIRE(hit.primitive == &triangle);
+        REQUIRE(hit.hasUV);
+        REQUIRE_THAT(hit.t, Catch::Matchers::WithinRel(1.0f));
+        REQUIRE_THAT(hit.u, Catch::Matchers::WithinRel(0.25f));
+        REQUIRE_THAT(hit.v, Catch::Matchers::WithinRel(0.5f));
+        REQUIRE_THAT(hit.point.z, Catch::Matchers::WithinAbs(0.0f, 1e-6f));
+        REQUIRE_THAT(std::abs(hit.normal.z), Catch::Matchers::WithinRel(1.0f));
+    }
+    
     SECTION("Ray intersection - miss (outside)") {
         // Rayon qui passe à côté du triangle
         Ray ray(Vector3(3.0f, 1.0f, -1.0f), Vector3(0.0f, 0.0f, 1.0f));
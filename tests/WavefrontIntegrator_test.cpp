@@ -0,0 +1,61 @@
+#include <catch2/catch_all.hpp>
+#include <memory>
+#include "Core/Scene.hpp"
+#include "Lights/AmbientLight.hpp"
+#include "Lights/PointLight.hpp"
+#include "Primitives/Plane.hpp"
+#include "Primitives/Sphere.hpp"
+#include "Renderer/Renderer.hpp"
+#include "Renderer/WavefrontIntegrator.hpp"
+
+using namespace Raytracer;
+
+TEST_CASE("WavefrontIntegrator direction keys", "[wavefront]") {
+    // Octant dans les bits hauts : deux directions de signes différents ne se suivent pas
+    uint32_t forward = WavefrontIntegrator::directionKey(Vector3(0.1f, 0.2f, 0.97f));
+    uint32_t left = WavefrontIntegrator::directionKey(Vector3(-0.1f, 0.2f, 0.97f));
+    REQUIRE((forward >> 27) == 0u);
+    REQUIRE((left >> 27) == 1u);
+    REQUIRE(WavefrontIntegrator::directionKey(Vector3(0.1f, 0.2f, 0.97f)) == forward);
+    REQUIRE(WavefrontIntegrator::directionKey(Vector3(0.0f, 0.0f, -1.0f)) >> 27 == 4u);
+}
+
+TEST_CASE("Wavefront and recursive modes render the same image", "[wavefront][renderer]") {
+    Scene scene;
+    Camera camera;
+    camera.setPosition(Vector3(0.0f, 2.0f, -10.0f));
+    camera.setRotation(Vector3(10.0f, 0.0f, 0.0f));
+    camera.setFieldOfView(60.0f);
+    camera.setResolution(96, 72);
+    scene.setCamera(camera);
+
+    Material mirror(Material::METAL, Color(200, 200, 220));
+    mirror.setRoughness(0.1);
+    Material matte(Material::LAMBERTIAN, Color(200, 60, 40));
+    Material floor(Material::LAMBERTIAN, Color(120, 120, 140));
+    floor.setReflectivity(0.3);
+    scene.addPrimitive(std::make_shared<Sphere>(Vector3(-1.5f, 1.0f, 0.0f), 1.0f, mirror));
+    scene.addPrimitive(std::make_shared<Sphere>(Vector3(1.5f, 1.0f, 1.0f), 1.0f, matte));
+    scene.addPrimitive(std::make_shared<Plane>(Vector3(0.0f, 1.0f, 0.0f), 0.0f, floor));
+    scene.addLight(std::make_shared<AmbientLight>(Vector3(0.0f, 0.0f, 0.0f), 0.3f));
+    scene.addLight(std::make_shared<PointLight>(Vector3(4.0f, 8.0f, -4.0f), 0.8f));
+
+    Renderer recursive(scene, 96, 72);
+    recursive.setThreadCount(1);
+    recursive.render();
+    Renderer wavefront(scene, 96, 72);
+    wavefront.setThreadCount(2);
+    wavefront.setMode(Renderer::WAVEFRONT);
+    REQUIRE(wavefront.getMode() == Renderer::WAVEFRONT);
+    wavefront.render();
+
+    const auto& expected = recursive.getImage();
+    const auto& image = wavefront.getImage();
+    for (int y = 0; y < 72; ++y) {
+        for (int x = 0; x < 96; ++x) {
+            REQUIRE(image.getColor(x, y).getR() == expected.getColor(x, y).getR());
+            REQUIRE(image.getColor(x, y).getG() == expected.getColor(x, y).getG());
+            REQUIRE(image.getColor(x, y).getB() == expected.getColor(x, y).getB());
+        }
+    }
+}